@@ -0,0 +1,121 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Wall time and iterations of an implicit `forward` under Newton and under
+// Anderson acceleration (`SolverConfig::method`). Anderson skips the Jacobian
+// assembly and linear solve, so each iteration is cheaper, but it usually
+// needs more of them and fails outright on strongly coupled systems. A method
+// that does not converge within `miters` (raised to 100) is reported as such.
+//
+// Iterations are the largest per-solve count on the `newton` log channel; a
+// substepped segment reports none. To cover the benchmark scenarios, compile
+// each one and run this on every artifact:
+//
+//   for s in benchmark/*/model.i; do
+//     neml2-compile $s --model model --output-dir /tmp/aa/$(basename $(dirname $s))
+//   done
+//   for a in /tmp/aa/*/model; do ./bench_anderson $a; done
+//
+// Usage: bench_anderson <artifact_root> [iters=20] [batch=1024] [depth=5] [beta=1]
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "neml2/csrc/aoti/Exception.h"
+#include "neml2/csrc/aoti/Model.h"
+#include "neml2/csrc/aoti/log.h"
+
+#include "bench_model.h"
+#include "bench_util.h"
+
+using namespace neml2::aoti;
+namespace B = neml2::bench;
+namespace L = neml2::aoti::log;
+
+int
+main(int argc, char ** argv)
+{
+  if (argc < 2)
+  {
+    std::fprintf(stderr, "usage: %s <artifact_root> [iters] [batch] [depth] [beta]\n", argv[0]);
+    return 2;
+  }
+  const std::size_t iters = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20;
+  const int64_t batch = argc > 3 ? std::atoll(argv[3]) : 1024;
+  const std::size_t depth = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 5;
+  const double beta = argc > 5 ? std::atof(argv[5]) : 1.0;
+
+  at::manual_seed(0);
+  Model model(argv[1], at::kCPU, at::kDouble);
+  const auto inputs = B::random_inputs(model, batch);
+  std::printf("%s batch=%lld iters=%zu\n", argv[1], static_cast<long long>(batch), iters);
+
+  std::size_t newton_iters = 0;
+  L::set_default_level(L::Channel::Newton, L::Level::Info);
+  L::set_sink(
+      [&](L::Level, const std::string & line)
+      {
+        const auto pos = line.find("(iters=");
+        if (pos != std::string::npos)
+          newton_iters = std::max<std::size_t>(
+              newton_iters, std::strtoul(line.c_str() + pos + 7, nullptr, 10));
+      });
+
+  auto cfg = model.solver_config();
+  cfg.miters = std::max<std::size_t>(cfg.miters, 100);
+  cfg.anderson_depth = depth;
+  cfg.anderson_beta = beta;
+  double newton_us = 0;
+  for (const char * name : {"NEWTON", "ANDERSON"})
+  {
+    const std::string method = name;
+    cfg.method = method;
+    model.set_solver_config(cfg);
+    newton_iters = 0;
+    try
+    {
+      (void)model.forward(inputs);
+    }
+    catch (const ConvergenceError & e)
+    {
+      std::printf("%-10s did not converge: %s\n", method.c_str(), e.what());
+      continue;
+    }
+    const std::size_t its = newton_iters;
+    const auto s = B::measure([&] { (void)model.forward(inputs); }, 2, iters);
+    B::report(("forward (" + method + ")").c_str(), s);
+    if (method == "NEWTON")
+      newton_us = s.us_per_call;
+    std::printf("  iterations %zu", its);
+    if (newton_us > 0)
+      std::printf(", speedup %.2fx over Newton", newton_us / s.us_per_call);
+    std::printf("\n");
+  }
+
+  L::reset_sink();
+  L::reset_defaults();
+  return 0;
+}
@@ -0,0 +1,77 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+// Wall time of a substepped implicit solve with and without active-set
+// compaction (`SolverConfig::compact_fraction`). Compaction only acts in the
+// masked solve the substep driver runs, so the artifact needs an implicit
+// segment with `max_substepping_level > 0`. The benchmark/tcprandom and
+// benchmark/gtntheig inputs are the intended targets once substepping is set
+// on their ImplicitUpdate. Rows that converge unevenly benefit most.
+//
+// Usage: bench_compaction <artifact_root> [iters=20] [batch=4096] [fraction=0.5]
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "neml2/csrc/aoti/Model.h"
+
+#include "bench_model.h"
+#include "bench_util.h"
+
+using namespace neml2::aoti;
+namespace B = neml2::bench;
+
+int
+main(int argc, char ** argv)
+{
+  if (argc < 2)
+  {
+    std::fprintf(stderr, "usage: %s <artifact_root> [iters] [batch] [fraction]\n", argv[0]);
+    return 2;
+  }
+  const std::size_t iters = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20;
+  const int64_t batch = argc > 3 ? std::atoll(argv[3]) : 4096;
+  const double fraction = argc > 4 ? std::atof(argv[4]) : 0.5;
+
+  at::manual_seed(0);
+  Model model(argv[1], at::kCPU, at::kDouble);
+  const auto inputs = B::random_inputs(model, batch);
+  std::printf("batch=%lld iters=%zu\n", static_cast<long long>(batch), iters);
+
+  auto cfg = model.solver_config();
+  cfg.compact_fraction = 0.0;
+  model.set_solver_config(cfg);
+  const auto full = B::measure([&] { (void)model.forward(inputs); }, 2, iters);
+  B::report("forward (full batch)", full);
+
+  cfg.compact_fraction = fraction;
+  model.set_solver_config(cfg);
+  const auto compact = B::measure([&] { (void)model.forward(inputs); }, 2, iters);
+  B::report("forward (compacted)", compact);
+  std::printf("speedup %.2fx at compact_fraction=%g\n",
+              full.us_per_call / compact.us_per_call,
+              fraction);
+  return 0;
+}
@@ -0,0 +1,136 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+// Throughput of T host threads calling forward at once, on CPU, with the
+// machine's intra-op threads split evenly between them (each caller runs with
+// hardware_concurrency / T). `shared` points every thread at one Model loaded
+// with T runners per graph; `separate` gives each thread its own Model with
+// private loaders, so no graph is ever contended.
+// The us/call column is wall time over all calls of all threads, so a perfect
+// scale-up divides it by T.
+//
+// Usage: bench_concurrent <artifact_root> [iters=200] [batch=64] [threads...]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ATen/Parallel.h>
+
+#include "neml2/csrc/aoti/Model.h"
+
+#include "bench_model.h"
+#include "bench_util.h"
+
+using namespace neml2::aoti;
+namespace B = neml2::bench;
+
+namespace
+{
+// Run `iters` forward calls on each of `models.size()` threads (thread t on
+// models[t]) and return the per-call average over all of them.
+B::Sample
+run(const std::vector<const Model *> & models,
+    const std::map<std::string, at::Tensor> & inputs,
+    std::size_t iters,
+    int intra)
+{
+  // The intra-op thread count is process-wide: set it once, before the
+  // workers start, rather than from each of them.
+  at::set_num_threads(intra);
+  const std::size_t a0 = B::alloc_counter().load(std::memory_order_relaxed);
+  const auto t0 = std::chrono::steady_clock::now();
+  std::vector<std::thread> pool;
+  for (const auto * m : models)
+    pool.emplace_back(
+        [m, &inputs, iters]
+        {
+          for (std::size_t i = 0; i < iters; ++i)
+            (void)m->forward(inputs);
+        });
+  for (auto & th : pool)
+    th.join();
+  const auto t1 = std::chrono::steady_clock::now();
+  const std::size_t a1 = B::alloc_counter().load(std::memory_order_relaxed);
+  const double calls = double(iters * models.size());
+  B::Sample s;
+  s.us_per_call = std::chrono::duration<double, std::micro>(t1 - t0).count() / calls;
+  s.allocs_per_call = double(a1 - a0) / calls;
+  return s;
+}
+} // namespace
+
+int
+main(int argc, char ** argv)
+{
+  if (argc < 2)
+  {
+    std::fprintf(stderr, "usage: %s <artifact_root> [iters] [batch] [threads...]\n", argv[0]);
+    return 2;
+  }
+  const std::size_t iters = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 200;
+  const int64_t batch = argc > 3 ? std::atoll(argv[3]) : 64;
+  const int hw = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  std::vector<int> counts;
+  for (int a = 4; a < argc; ++a)
+    counts.push_back(std::atoi(argv[a]));
+  if (counts.empty())
+    for (int t = 1; t <= hw; t *= 2)
+      counts.push_back(t);
+
+  at::manual_seed(0);
+  std::printf("batch=%lld iters=%zu hw=%d\n", static_cast<long long>(batch), iters, hw);
+  for (const int t : counts)
+  {
+    const int intra = std::max(1, hw / t);
+    std::printf("threads=%d intra-op=%d\n", t, intra);
+
+    LoadOptions shared_load;
+    shared_load.runners = static_cast<std::size_t>(t);
+    Model shared(argv[1], at::kCPU, at::kDouble, shared_load);
+    const auto inputs = B::random_inputs(shared, batch);
+    (void)run({&shared}, inputs, 5, intra); // warm-up
+    B::report("forward (shared)",
+              run(std::vector<const Model *>(t, &shared), inputs, iters, intra));
+
+    LoadOptions private_load;
+    std::vector<std::unique_ptr<Model>> own;
+    std::vector<const Model *> each;
+    for (int k = 0; k < t; ++k)
+    {
+      own.push_back(std::make_unique<Model>(argv[1], at::kCPU, at::kDouble, private_load));
+      each.push_back(own.back().get());
+    }
+    (void)run(each, inputs, 5, intra); // warm-up
+    B::report("forward (separate)", run(each, inputs, iters, intra));
+  }
+  return 0;
+}
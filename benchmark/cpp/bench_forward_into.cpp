@@ -0,0 +1,82 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// forward vs. forward_into at a fixed batch: wall time + host allocations per
+// call. `forward` returns a fresh output map every call; `forward_into` writes
+// into caller-owned outputs preallocated once, and -- with contiguous,
+// full-batch inputs -- skips every input-side materializing copy. `bind` adds
+// the positional route, which also drops the per-call name lookups.
+//
+// Usage: bench_forward_into <artifact_root> [batch=8] [iters=2000]
+//
+// The artifact must be a plain-batch model (inputs at `(B, *base)`), e.g. any
+// tests/aoti/forward_* fixture or a benchmark/<scenario> compile.
+
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <ATen/ATen.h>
+
+#include "neml2/csrc/aoti/Model.h"
+
+#include "bench_model.h"
+#include "bench_util.h"
+
+using namespace neml2::aoti;
+
+int
+main(int argc, char ** argv)
+{
+  if (argc < 2)
+  {
+    std::fprintf(stderr, "usage: %s <artifact_root> [batch] [iters]\n", argv[0]);
+    return 2;
+  }
+  const int64_t b = argc > 2 ? std::atoll(argv[2]) : 8;
+  const std::size_t iters = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 2000;
+
+  at::manual_seed(0);
+  Model model(argv[1], at::kCPU, at::kDouble);
+
+  const auto inputs = neml2::bench::random_inputs(model, b);
+
+  std::map<std::string, at::Tensor> outputs;
+  for (const auto & [name, t] : model.forward(inputs))
+    outputs.emplace(name, at::empty_like(t));
+
+  const auto bound = model.bind(model.input_names());
+  std::vector<at::Tensor> positional;
+  for (const auto & name : model.input_names())
+    positional.push_back(inputs.at(name));
+
+  std::printf("batch=%lld iters=%zu\n", static_cast<long long>(b), iters);
+  neml2::bench::report("forward", neml2::bench::measure([&] { (void)model.forward(inputs); }, 50, iters));
+  neml2::bench::report("forward_into",
+                       neml2::bench::measure([&] { model.forward_into(inputs, outputs); }, 50, iters));
+  neml2::bench::report("bind.forward",
+                       neml2::bench::measure([&] { (void)bound.forward(positional); }, 50, iters));
+  return 0;
+}
@@ -0,0 +1,101 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Wall time and Newton iterations of an implicit `forward` for several Jacobian
+// refresh intervals (`SolverConfig::jacobian_refresh`): 1 assembles every
+// iteration, m > 1 every m-th, 0 once per solve. Reuse saves the `jacobian`
+// graph on the skipped iterations and usually costs extra iterations; the
+// break-even depends on how much of an iteration the assembly takes. `miters`
+// is raised to 100 so the slower modified-Newton runs still converge.
+//
+// Iterations are the largest per-solve count on the `newton` log channel.
+//
+// Usage: bench_jacobian_reuse <artifact_root> [iters=20] [batch=1024]
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "neml2/csrc/aoti/Model.h"
+#include "neml2/csrc/aoti/log.h"
+
+#include "bench_model.h"
+#include "bench_util.h"
+
+using namespace neml2::aoti;
+namespace B = neml2::bench;
+namespace L = neml2::aoti::log;
+
+int
+main(int argc, char ** argv)
+{
+  if (argc < 2)
+  {
+    std::fprintf(stderr, "usage: %s <artifact_root> [iters] [batch]\n", argv[0]);
+    return 2;
+  }
+  const std::size_t iters = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20;
+  const int64_t batch = argc > 3 ? std::atoll(argv[3]) : 1024;
+
+  at::manual_seed(0);
+  Model model(argv[1], at::kCPU, at::kDouble);
+  const auto inputs = B::random_inputs(model, batch);
+  std::printf("batch=%lld iters=%zu\n", static_cast<long long>(batch), iters);
+
+  std::size_t newton_iters = 0;
+  L::set_default_level(L::Channel::Newton, L::Level::Info);
+  L::set_sink(
+      [&](L::Level, const std::string & line)
+      {
+        const auto pos = line.find("(iters=");
+        if (pos != std::string::npos)
+          newton_iters = std::max<std::size_t>(
+              newton_iters, std::strtoul(line.c_str() + pos + 7, nullptr, 10));
+      });
+
+  auto cfg = model.solver_config();
+  cfg.miters = std::max<std::size_t>(cfg.miters, 100);
+  const std::size_t refreshes[] = {1, 2, 4, 0};
+  double full_us = 0;
+  for (const auto refresh : refreshes)
+  {
+    cfg.jacobian_refresh = refresh;
+    model.set_solver_config(cfg);
+    newton_iters = 0;
+    (void)model.forward(inputs);
+    const std::size_t its = newton_iters;
+    const auto s = B::measure([&] { (void)model.forward(inputs); }, 2, iters);
+
+    const std::string label = "forward (jacobian_refresh=" + std::to_string(refresh) + ")";
+    B::report(label.c_str(), s);
+    if (refresh == 1)
+      full_us = s.us_per_call;
+    std::printf("  newton iters %zu, speedup %.2fx\n", its, full_us / s.us_per_call);
+  }
+
+  L::reset_sink();
+  L::reset_defaults();
+  return 0;
+}
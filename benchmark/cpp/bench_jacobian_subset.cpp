@@ -0,0 +1,84 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// jacobian (every compiled pair) vs jacobian(inputs, {in}, {out}) (one block)
+// at a constant batch: wall time + host allocations per call. The subset call
+// sizes the composed carrier to `in` alone, so the gap grows with the number of
+// differentiated inputs -- history-heavy models such as benchmark/chaboche12
+// compiled with `-d :` show it best. A single-forward-segment artifact computes
+// every block in one graph either way and shows no difference.
+//
+// Usage: bench_jacobian_subset <artifact_root> [batch=8] [iters=200] [out] [in]
+// `out` / `in` default to the first output and the first SR2 (else first) input.
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "neml2/csrc/aoti/Model.h"
+
+#include "bench_model.h"
+#include "bench_util.h"
+
+using namespace neml2::aoti;
+namespace B = neml2::bench;
+
+int
+main(int argc, char ** argv)
+{
+  if (argc < 2)
+  {
+    std::fprintf(stderr, "usage: %s <artifact_root> [batch] [iters] [out] [in]\n", argv[0]);
+    return 2;
+  }
+  const int64_t b = argc > 2 ? std::atoll(argv[2]) : 8;
+  const std::size_t iters = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 200;
+
+  at::manual_seed(0);
+  Model model(argv[1], at::kCPU, at::kDouble);
+  const auto inputs = B::random_inputs(model, b);
+
+  std::string out = argc > 4 ? argv[4] : model.output_names().front();
+  std::string in = model.input_names().front();
+  for (std::size_t k = 0; k < model.input_names().size(); ++k)
+    if (model.input_base_shapes()[k] == std::vector<int64_t>{6})
+    {
+      in = model.input_names()[k];
+      break;
+    }
+  if (argc > 5)
+    in = argv[5];
+  const std::vector<std::string> wrt{in}, of{out};
+
+  std::printf("batch=%lld iters=%zu block=d(%s)/d(%s)\n",
+              static_cast<long long>(b),
+              iters,
+              out.c_str(),
+              in.c_str());
+  B::report("jacobian", B::measure([&] { (void)model.jacobian(inputs); }, 10, iters));
+  B::report("jacobian(wrt, of)",
+            B::measure([&] { (void)model.jacobian(inputs, wrt, of); }, 10, iters));
+  return 0;
+}
@@ -0,0 +1,89 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// K directional derivatives: K separate jvp() calls vs one jvp_multi() with a
+// K axis on every tangent. Wall time + host allocations per K-direction sweep.
+// The gap is roughly K solves (and K carrier compositions) against one.
+//
+// Usage: bench_jvp_multi <artifact_root> [batch=8] [K=8] [iters=100]
+
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "neml2/csrc/aoti/Model.h"
+
+#include "bench_model.h"
+#include "bench_util.h"
+
+using namespace neml2::aoti;
+namespace B = neml2::bench;
+
+int
+main(int argc, char ** argv)
+{
+  if (argc < 2)
+  {
+    std::fprintf(stderr, "usage: %s <artifact_root> [batch] [K] [iters]\n", argv[0]);
+    return 2;
+  }
+  const int64_t b = argc > 2 ? std::atoll(argv[2]) : 8;
+  const int64_t k = argc > 3 ? std::atoll(argv[3]) : 8;
+  const std::size_t iters = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 100;
+
+  at::manual_seed(0);
+  Model model(argv[1], at::kCPU, at::kDouble);
+  const auto inputs = B::random_inputs(model, b);
+
+  // (b, K, *base) tangents, and their K (b, *base) slices for the loop.
+  std::map<std::string, at::Tensor> tangents;
+  for (const auto & [name, t] : inputs)
+  {
+    std::vector<int64_t> shape = t.sizes().vec();
+    shape.insert(shape.begin() + 1, k);
+    tangents[name] = at::randn(shape, t.options());
+  }
+  std::vector<std::map<std::string, at::Tensor>> slices(k);
+  for (int64_t d = 0; d < k; ++d)
+    for (const auto & [name, t] : tangents)
+      slices[d][name] = t.select(1, d).contiguous();
+
+  std::printf("batch=%lld K=%lld iters=%zu\n",
+              static_cast<long long>(b),
+              static_cast<long long>(k),
+              iters);
+  B::report("K x jvp",
+            B::measure(
+                [&]
+                {
+                  for (const auto & s : slices)
+                    (void)model.jvp(inputs, s);
+                },
+                5,
+                iters));
+  B::report("jvp_multi", B::measure([&] { (void)model.jvp_multi(inputs, tangents); }, 5, iters));
+  return 0;
+}
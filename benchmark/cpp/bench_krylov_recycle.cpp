@@ -0,0 +1,106 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Matvecs and wall time of a sequence of implicit `forward` calls on a Krylov
+// artifact, the way a host steps one batch of material points through time:
+// the inputs drift by 1% per call. Run once on the plain GMRES artifact and once
+// on one compiled with a recycle space (the GMRES `recycle` option), e.g. for
+// benchmark/chaboche12gmres:
+//
+//   neml2-compile benchmark/chaboche12gmres/model.i --model model \
+//     --output-dir /tmp/r0 nbatch=1024
+//   neml2-compile benchmark/chaboche12gmres/model.i --model model \
+//     --output-dir /tmp/r8 nbatch=1024 Solvers/gmres/recycle:=8
+//   ./bench_krylov_recycle /tmp/r0/model; ./bench_krylov_recycle /tmp/r8/model
+//
+// Each artifact runs the sequence twice: plain calls, where the recycle space
+// lives only across the Newton iterations of one call, and calls through one
+// `Model::Workspace`, which also carries it from call to call. Matvecs come
+// from `SolverConfig::collect_stats` and include the ones a recycled solve
+// spends re-applying the operator to its space.
+//
+// Usage: bench_krylov_recycle <artifact_root> [steps=10] [batch=1024]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+
+#include "neml2/csrc/aoti/Model.h"
+
+#include "bench_model.h"
+#include "bench_util.h"
+
+using namespace neml2::aoti;
+namespace B = neml2::bench;
+
+int
+main(int argc, char ** argv)
+{
+  if (argc < 2)
+  {
+    std::fprintf(stderr, "usage: %s <artifact_root> [steps] [batch]\n", argv[0]);
+    return 2;
+  }
+  const int steps = argc > 2 ? std::atoi(argv[2]) : 10;
+  const int64_t batch = argc > 3 ? std::atoll(argv[3]) : 1024;
+
+  at::manual_seed(0);
+  Model model(argv[1], at::kCPU, at::kDouble);
+  auto cfg = model.solver_config();
+  cfg.collect_stats = true;
+  model.set_solver_config(cfg);
+  const auto inputs = B::random_inputs(model, batch);
+  std::printf("%s batch=%lld steps=%d\n", argv[1], static_cast<long long>(batch), steps);
+
+  for (const bool use_ws : {false, true})
+  {
+    Model::Workspace ws;
+    std::size_t matvecs = 0, iterations = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int t = 0; t < steps; ++t)
+    {
+      std::map<std::string, at::Tensor> step_inputs;
+      for (const auto & [name, x] : inputs)
+        step_inputs.emplace(name, x * (1.0 + 0.01 * t));
+      if (use_ws)
+        (void)model.forward(step_inputs, ws);
+      else
+        (void)model.forward(step_inputs);
+      for (const auto & s : model.last_solve_stats().segments)
+      {
+        matvecs += s.matvecs;
+        iterations += s.iterations;
+      }
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    std::printf("%-14s %10.1f matvecs/step %8.1f Newton its/step %12.2f us/step\n",
+                use_ws ? "workspace" : "plain",
+                static_cast<double>(matvecs) / steps,
+                static_cast<double>(iterations) / steps,
+                std::chrono::duration<double, std::micro>(t1 - t0).count() / steps);
+  }
+  return 0;
+}
@@ -0,0 +1,57 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+// Shared setup for the C++ micro-benchmarks that drive an aoti::Model. Kept
+// apart from bench_util.h so that header stays torch-free.
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <ATen/ATen.h>
+
+#include "neml2/csrc/aoti/Model.h"
+
+namespace neml2::bench
+{
+/// Random canonical inputs `(b, *base)` for every master input of `model`, on
+/// its device + dtype. Assumes a plain-batch artifact.
+inline std::map<std::string, at::Tensor>
+random_inputs(const neml2::aoti::Model & model, int64_t b)
+{
+  const auto opts = at::TensorOptions().dtype(model.dtype()).device(model.device());
+  std::map<std::string, at::Tensor> inputs;
+  for (std::size_t i = 0; i < model.input_names().size(); ++i)
+  {
+    std::vector<int64_t> shape{b};
+    shape.insert(
+        shape.end(), model.input_base_shapes()[i].begin(), model.input_base_shapes()[i].end());
+    inputs.emplace(model.input_names()[i], at::randn(shape, opts));
+  }
+  return inputs;
+}
+} // namespace neml2::bench
@@ -0,0 +1,82 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Per-call host overhead of input preparation at small batch, where it is a
+// visible share of the call. `steady` calls forward at one layout, so after the
+// first call every input matches the cached shape signature and validation and
+// broadcast planning are skipped. `alternating` switches between two batch
+// sizes on every call, so every call misses and re-plans. Run at B = 1 and
+// B = 8 by default.
+//
+// Usage: bench_shape_cache <artifact_root> [iters=2000] [batch...]
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "neml2/csrc/aoti/Model.h"
+
+#include "bench_model.h"
+#include "bench_util.h"
+
+using namespace neml2::aoti;
+namespace B = neml2::bench;
+
+int
+main(int argc, char ** argv)
+{
+  if (argc < 2)
+  {
+    std::fprintf(stderr, "usage: %s <artifact_root> [iters] [batch...]\n", argv[0]);
+    return 2;
+  }
+  const std::size_t iters = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 2000;
+  std::vector<int64_t> batches;
+  for (int a = 3; a < argc; ++a)
+    batches.push_back(std::atoll(argv[a]));
+  if (batches.empty())
+    batches = {1, 8};
+
+  at::manual_seed(0);
+  Model model(argv[1], at::kCPU, at::kDouble);
+
+  for (const auto b : batches)
+  {
+    const auto inputs = B::random_inputs(model, b);
+    const auto other = B::random_inputs(model, b + 1);
+    std::printf("batch=%lld iters=%zu\n", static_cast<long long>(b), iters);
+    B::report("forward (steady)", B::measure([&] { (void)model.forward(inputs); }, 20, iters));
+    bool flip = false;
+    B::report("forward (alternating)",
+              B::measure(
+                  [&]
+                  {
+                    flip = !flip;
+                    (void)model.forward(flip ? inputs : other);
+                  },
+                  20,
+                  iters));
+  }
+  return 0;
+}
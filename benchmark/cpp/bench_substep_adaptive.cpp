@@ -0,0 +1,101 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Segment solves, depth and wall time of a substepped implicit `forward` under
+// the bisection schedule and the adaptive one (`SolverConfig::substep_method`).
+// The artifact needs an implicit segment with `max_substepping_level > 0`; the
+// benchmark/gtntheig and benchmark/scpcoup inputs are the intended targets once
+// substepping is set on their ImplicitUpdate. `scale` multiplies every input
+// to make the increment harder, so that rows actually substep.
+//
+// Usage: bench_substep_adaptive <artifact_root> [iters=10] [batch=1024] [scale=1]
+//                               [grow_after=2]
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "neml2/csrc/aoti/Exception.h"
+#include "neml2/csrc/aoti/Model.h"
+
+#include "bench_model.h"
+#include "bench_util.h"
+
+using namespace neml2::aoti;
+namespace B = neml2::bench;
+
+int
+main(int argc, char ** argv)
+{
+  if (argc < 2)
+  {
+    std::fprintf(stderr,
+                 "usage: %s <artifact_root> [iters] [batch] [scale] [grow_after]\n",
+                 argv[0]);
+    return 2;
+  }
+  const std::size_t iters = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10;
+  const int64_t batch = argc > 3 ? std::atoll(argv[3]) : 1024;
+  const double scale = argc > 4 ? std::atof(argv[4]) : 1.0;
+  const std::size_t grow_after = argc > 5 ? std::strtoul(argv[5], nullptr, 10) : 2;
+
+  at::manual_seed(0);
+  Model model(argv[1], at::kCPU, at::kDouble);
+  auto inputs = B::random_inputs(model, batch);
+  for (auto & [name, t] : inputs)
+    t = t * scale;
+  std::printf("batch=%lld iters=%zu scale=%g\n", static_cast<long long>(batch), iters, scale);
+
+  double base_us = 0.0;
+  for (const std::string method : {"BISECT", "ADAPTIVE"})
+  {
+    auto cfg = model.solver_config();
+    cfg.substep_method = method;
+    cfg.substep_grow_after = grow_after;
+    cfg.collect_stats = true;
+    model.set_solver_config(cfg);
+    try
+    {
+      const auto t = B::measure([&] { (void)model.forward(inputs); }, 1, iters);
+      std::size_t solves = 0, depth = 0;
+      for (const auto & seg : model.last_solve_stats().segments)
+      {
+        solves += seg.solves;
+        depth = std::max(depth, seg.substep_depth);
+      }
+      B::report(("forward (" + method + ")").c_str(), t);
+      std::printf("  %zu segment solves per call, max depth %zu\n", solves, depth);
+      if (base_us == 0.0)
+        base_us = t.us_per_call;
+      else
+        std::printf("speedup %.2fx over BISECT\n", base_us / t.us_per_call);
+    }
+    catch (const ConvergenceError & e)
+    {
+      std::printf("%s: did not converge (%s)\n", method.c_str(), e.what());
+    }
+  }
+  return 0;
+}
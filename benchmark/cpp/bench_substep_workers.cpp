@@ -0,0 +1,108 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Wall time of a substepped implicit `forward` under bisection with the failing
+// rows solved on the calling thread and split across `substep_workers`
+// concurrent sub-batches (`SolverConfig::substep_workers`). Each worker count
+// loads its own Model with as many graph runners as workers. The artifact needs
+// an implicit segment with `max_substepping_level > 0`, as for
+// bench_substep_adaptive; `scale` multiplies every input so that rows substep.
+//
+// Usage: bench_substep_workers <artifact_root> [iters=10] [batch=1024] [scale=1]
+//                              [split_rows=4]
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+#include "neml2/csrc/aoti/Exception.h"
+#include "neml2/csrc/aoti/Model.h"
+
+#include "bench_model.h"
+#include "bench_util.h"
+
+using namespace neml2::aoti;
+namespace B = neml2::bench;
+
+int
+main(int argc, char ** argv)
+{
+  if (argc < 2)
+  {
+    std::fprintf(stderr,
+                 "usage: %s <artifact_root> [iters] [batch] [scale] [split_rows]\n",
+                 argv[0]);
+    return 2;
+  }
+  const std::size_t iters = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10;
+  const int64_t batch = argc > 3 ? std::atoll(argv[3]) : 1024;
+  const double scale = argc > 4 ? std::atof(argv[4]) : 1.0;
+  const std::size_t split_rows = argc > 5 ? std::strtoul(argv[5], nullptr, 10) : 4;
+  const auto hw = std::max(1u, std::thread::hardware_concurrency());
+
+  std::printf("batch=%lld iters=%zu scale=%g split_rows=%zu\n",
+              static_cast<long long>(batch),
+              iters,
+              scale,
+              split_rows);
+
+  double base_us = 0.0;
+  at::Tensor serial;
+  for (std::size_t w = 1; w <= hw; w *= 2)
+  {
+    LoadOptions load;
+    load.runners = w;
+    Model model(argv[1], at::kCPU, at::kDouble, load);
+    at::manual_seed(0); // same inputs at every worker count
+    auto inputs = B::random_inputs(model, batch);
+    for (auto & [name, t] : inputs)
+      t = t * scale;
+    auto cfg = model.solver_config();
+    cfg.substep_method = "BISECT";
+    cfg.substep_workers = w;
+    cfg.substep_split_rows = split_rows;
+    model.set_solver_config(cfg);
+    try
+    {
+      const auto out = model.forward(inputs).begin()->second;
+      const auto t = B::measure([&] { (void)model.forward(inputs); }, 1, iters);
+      B::report(("forward (workers=" + std::to_string(w) + ")").c_str(), t);
+      if (base_us == 0.0)
+      {
+        base_us = t.us_per_call;
+        serial = out;
+        continue;
+      }
+      std::printf("  max |diff| vs serial %.3e\n", (out - serial).abs().max().item<double>());
+      std::printf("speedup %.2fx over workers=1\n", base_us / t.us_per_call);
+    }
+    catch (const ConvergenceError & e)
+    {
+      std::printf("workers=%zu: did not converge (%s)\n", w, e.what());
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,128 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+// Minimal, dependency-free scaffolding for the C++ runtime micro-benchmarks.
+// Each benchmark is a plain `main()` over a compiled artifact that prints one
+// line per measured variant. Like tests/cpp/test_util.h, no third-party
+// framework: wall time comes from std::chrono and allocation counts from the
+// replaceable global `operator new` below.
+//
+// The counter sees every C++ heap allocation on the call path -- tensor handles
+// (TensorImpl / StorageImpl), container nodes, shape vectors -- but NOT the raw
+// tensor data buffers, which c10's CPU allocator takes with posix_memalign. It
+// is therefore a proxy for host-side allocator traffic per call, which is what
+// dominates at small batch.
+//
+// Include from exactly ONE translation unit per executable (it defines the
+// global allocation functions).
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace neml2::bench
+{
+inline std::atomic<std::size_t> &
+alloc_counter()
+{
+  static std::atomic<std::size_t> n{0};
+  return n;
+}
+
+/// Per-call averages over a measured run.
+struct Sample
+{
+  double us_per_call = 0;
+  double allocs_per_call = 0;
+};
+
+/// Run `fn` `warmup` times unmeasured, then `iters` times measured.
+template <typename Fn>
+Sample
+measure(Fn && fn, std::size_t warmup, std::size_t iters)
+{
+  for (std::size_t i = 0; i < warmup; ++i)
+    fn();
+  const std::size_t a0 = alloc_counter().load(std::memory_order_relaxed);
+  const auto t0 = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < iters; ++i)
+    fn();
+  const auto t1 = std::chrono::steady_clock::now();
+  const std::size_t a1 = alloc_counter().load(std::memory_order_relaxed);
+  Sample s;
+  s.us_per_call = std::chrono::duration<double, std::micro>(t1 - t0).count() / double(iters);
+  s.allocs_per_call = double(a1 - a0) / double(iters);
+  return s;
+}
+
+inline void
+report(const char * label, const Sample & s)
+{
+  std::printf("%-32s %12.2f us/call %10.1f allocs/call\n", label, s.us_per_call, s.allocs_per_call);
+}
+} // namespace neml2::bench
+
+void *
+operator new(std::size_t n)
+{
+  neml2::bench::alloc_counter().fetch_add(1, std::memory_order_relaxed);
+  if (void * p = std::malloc(n == 0 ? 1 : n))
+    return p;
+  throw std::bad_alloc();
+}
+
+void *
+operator new[](std::size_t n)
+{
+  return ::operator new(n);
+}
+
+void
+operator delete(void * p) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete[](void * p) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete(void * p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete[](void * p, std::size_t) noexcept
+{
+  std::free(p);
+}
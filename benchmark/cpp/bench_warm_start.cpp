@@ -0,0 +1,206 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Newton iterations over a load history, with and without a warm start. A
+// history-driven artifact (benchmark/chaboche6, say) is stepped through `steps`
+// increments of a proportional ramp, the way a TransientDriver would:
+//
+//   - every force input `f` ramps linearly to its end value: a Scalar (time) to
+//     `end_time`, an SR2 (strain) to (0.1, -0.05, -0.05, 0, 0, 0), anything else
+//     is held at zero;
+//   - `f~1` takes the previous step's force;
+//   - an old-state input `s~1` takes the previous step's output `s`.
+//
+// The three runs differ only in where each step's Newton solve starts:
+//
+//   cold      the compiled predictor / incoming value (no initial_guess)
+//   previous  the previous step's converged unknowns
+//   extrap    a linear extrapolation of the last two converged steps
+//
+// Iterations are read off the `newton` log channel's per-solve info summary.
+//
+// Usage: bench_warm_start <artifact_root> [batch=64] [steps=100] [end_time=1e5]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <ATen/ATen.h>
+
+#include "neml2/csrc/aoti/Model.h"
+#include "neml2/csrc/aoti/log.h"
+
+using namespace neml2::aoti;
+namespace L = neml2::aoti::log;
+
+namespace
+{
+enum class Start
+{
+  Cold,
+  Previous,
+  Extrap,
+};
+
+struct Totals
+{
+  std::size_t solves = 0;
+  std::size_t iters = 0;
+};
+
+bool
+is_old(const std::string & name)
+{
+  return name.size() > 2 && name.compare(name.size() - 2, 2, "~1") == 0;
+}
+
+double
+run(const Model & model, int64_t b, int steps, double end_time, Start start)
+{
+  const auto opts = at::TensorOptions().dtype(model.dtype()).device(model.device());
+  const auto & in_names = model.input_names();
+  const std::set<std::string> inputs(in_names.begin(), in_names.end());
+
+  std::map<std::string, at::Tensor> force_end, force_prev;
+  for (std::size_t k = 0; k < in_names.size(); ++k)
+  {
+    if (is_old(in_names[k]))
+      continue;
+    const auto & base = model.input_base_shapes()[k];
+    std::vector<int64_t> shape{b};
+    shape.insert(shape.end(), base.begin(), base.end());
+    at::Tensor end = at::zeros(shape, opts);
+    if (base.empty())
+      end.fill_(end_time);
+    else if (base == std::vector<int64_t>{6})
+      end.copy_(at::tensor({0.1, -0.05, -0.05, 0.0, 0.0, 0.0}, opts).expand(shape));
+    force_end[in_names[k]] = end;
+    force_prev[in_names[k]] = at::zeros(shape, opts);
+  }
+
+  std::map<std::string, at::Tensor> out_prev, out_prev2;
+  for (std::size_t k = 0; k < model.output_names().size(); ++k)
+  {
+    std::vector<int64_t> shape{b};
+    const auto & base = model.output_base_shapes()[k];
+    shape.insert(shape.end(), base.begin(), base.end());
+    out_prev[model.output_names()[k]] = at::zeros(shape, opts);
+  }
+
+  // Only unknowns the host can see (outputs) can be guessed.
+  std::vector<std::string> guessable;
+  for (const auto & u : model.unknown_names())
+    if (out_prev.count(u))
+      guessable.push_back(u);
+
+  const auto t0 = std::chrono::steady_clock::now();
+  for (int s = 1; s <= steps; ++s)
+  {
+    const double frac = double(s) / double(steps);
+    std::map<std::string, at::Tensor> ins, forces;
+    for (const auto & [f, end] : force_end)
+      ins[f] = forces[f] = end * frac;
+    for (const auto & n : in_names)
+    {
+      if (!is_old(n))
+        continue;
+      const auto base = n.substr(0, n.size() - 2);
+      if (inputs.count(base))
+        ins[n] = force_prev.at(base);
+      else if (out_prev.count(base))
+        ins[n] = out_prev.at(base);
+      else
+        std::fprintf(stderr, "warning: no history source for input '%s'\n", n.c_str());
+    }
+
+    std::map<std::string, at::Tensor> guess;
+    if (start != Start::Cold && s > 1)
+      for (const auto & u : guessable)
+        guess[u] = (start == Start::Extrap && s > 2) ? 2 * out_prev.at(u) - out_prev2.at(u)
+                                                     : out_prev.at(u);
+
+    auto out = model.forward(ins, {}, guess);
+    out_prev2 = std::move(out_prev);
+    out_prev = std::move(out);
+    force_prev = std::move(forces);
+  }
+  const auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+} // namespace
+
+int
+main(int argc, char ** argv)
+{
+  if (argc < 2)
+  {
+    std::fprintf(stderr, "usage: %s <artifact_root> [batch] [steps] [end_time]\n", argv[0]);
+    return 2;
+  }
+  const int64_t b = argc > 2 ? std::atoll(argv[2]) : 64;
+  const int steps = argc > 3 ? std::atoi(argv[3]) : 100;
+  const double end_time = argc > 4 ? std::atof(argv[4]) : 1.0e5;
+
+  Model model(argv[1], at::kCPU, at::kDouble);
+  if (model.unknown_names().empty())
+  {
+    std::fprintf(stderr, "%s has no implicit unknowns; nothing to warm-start\n", argv[1]);
+    return 2;
+  }
+
+  // Every solve ends in one newton info line carrying `iters=N`; the prefix check
+  // keeps out other channels NEML2_LOGS may have switched on.
+  Totals totals;
+  L::set_default_level(L::Channel::Newton, L::Level::Info);
+  L::set_sink(
+      [&](L::Level, const std::string & line)
+      {
+        const auto at = line.find("(iters=");
+        if (line.rfind("[neml2:newton", 0) != 0 || at == std::string::npos)
+          return;
+        totals.solves += 1;
+        totals.iters += std::strtoul(line.c_str() + at + 7, nullptr, 10);
+      });
+
+  std::printf("batch=%lld steps=%d end_time=%g\n", static_cast<long long>(b), steps, end_time);
+  const std::pair<const char *, Start> variants[] = {
+      {"cold", Start::Cold}, {"previous", Start::Previous}, {"extrap", Start::Extrap}};
+  for (const auto & [label, start] : variants)
+  {
+    totals = {};
+    const double ms = run(model, b, steps, end_time, start);
+    std::printf("%-12s %8.3f newton iters/solve %10.2f ms total (%zu solves)\n",
+                label,
+                totals.solves ? double(totals.iters) / double(totals.solves) : 0.0,
+                ms,
+                totals.solves);
+  }
+  L::reset_sink();
+  L::reset_defaults();
+  return 0;
+}
@@ -0,0 +1,69 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// jacobian / forward with and without a Model::Workspace at a constant batch:
+// wall time + host allocations per call, then the workspace hit / miss counts.
+// The workspace only pays off where the call builds batch-shaped buffers -- the
+// composed (multi-segment) Jacobian carriers and the packs and Newton iterates
+// of implicit segments; a single-forward-segment artifact shows no difference.
+//
+// Usage: bench_workspace <artifact_root> [batch=8] [iters=500]
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "neml2/csrc/aoti/Model.h"
+
+#include "bench_model.h"
+#include "bench_util.h"
+
+using namespace neml2::aoti;
+
+int
+main(int argc, char ** argv)
+{
+  if (argc < 2)
+  {
+    std::fprintf(stderr, "usage: %s <artifact_root> [batch] [iters]\n", argv[0]);
+    return 2;
+  }
+  const int64_t b = argc > 2 ? std::atoll(argv[2]) : 8;
+  const std::size_t iters = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 500;
+
+  at::manual_seed(0);
+  Model model(argv[1], at::kCPU, at::kDouble);
+  const auto inputs = neml2::bench::random_inputs(model, b);
+  Model::Workspace ws;
+
+  std::printf("batch=%lld iters=%zu\n", static_cast<long long>(b), iters);
+  neml2::bench::report("forward", neml2::bench::measure([&] { (void)model.forward(inputs); }, 20, iters));
+  neml2::bench::report("forward(ws)",
+                       neml2::bench::measure([&] { (void)model.forward(inputs, ws); }, 20, iters));
+  neml2::bench::report("jacobian",
+                       neml2::bench::measure([&] { (void)model.jacobian(inputs); }, 20, iters));
+  neml2::bench::report("jacobian(ws)",
+                       neml2::bench::measure([&] { (void)model.jacobian(inputs, ws); }, 20, iters));
+  std::printf("workspace hits=%zu misses=%zu\n", ws.hits(), ws.misses());
+  return 0;
+}
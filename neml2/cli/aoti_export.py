@@ -1977,7 +1977,8 @@ def _compile_implicit_segment(
     progress_cb: Callable[[str], None] | None = None,
 ) -> dict:
     """Compile an ImplicitUpdate to ``<pkg_basename>_residual.pt2`` +
-    ``_jacobian.pt2`` + ``_solve.pt2`` (+ ``_jacobian_given.pt2`` + ``_solve_ift.pt2``
+    ``_jacobian.pt2`` + ``_solve.pt2`` (+ ``_factor.pt2`` + ``_solve_factored.pt2``
+    for a single-group ``DenseLU`` solve) (+ ``_jacobian_given.pt2`` + ``_solve_ift.pt2``
     when *emit_ift*) (+ ``_dr_dparam.pt2`` + ``_solve_param.pt2`` when
     *selected_param_pairs*) (+ optional ``_predictor.pt2``), returning the metadata
     dict (without the outer ``"type"`` key — caller adds it).
@@ -2026,7 +2027,9 @@ def _compile_implicit_segment(
         DrDParam,
         Jacobian,
         JacobianGiven,
+        LinearFactor,
         LinearSolve,
+        LinearSolveFactored,
         LinearSolveIFT,
         LinearSolveParam,
         Matvec,
@@ -2059,6 +2062,7 @@ def _compile_implicit_segment(
     # needs internally) -- so it does NOT pull in the standalone `jacobian` A graph.
     iterative, precond_on = _iterative_solver_flags(solver)
     need_a = (not iterative) or emit_ift
+    lu_factored = _lu_factored_flag(inner)
     # Sensitivity (derivative) linear solvers -- separately configurable on the
     # ImplicitUpdate, each defaulting to the Newton's linear_solver. An iterative
     # (matrix-free) sensitivity solver runs a C++ Krylov solve over the assembled A
@@ -2180,6 +2184,8 @@ def _compile_implicit_segment(
     residual_name = f"{pkg_basename}_residual.pt2"
     jacobian_name = f"{pkg_basename}_jacobian.pt2"
     solve_name = f"{pkg_basename}_solve.pt2"
+    factor_name = f"{pkg_basename}_factor.pt2"
+    solve_factored_name = f"{pkg_basename}_solve_factored.pt2"
     matvec_name = f"{pkg_basename}_matvec.pt2"
     precond_setup_name = f"{pkg_basename}_precond_setup.pt2"
     precond_apply_name = f"{pkg_basename}_precond_apply.pt2"
@@ -2264,6 +2270,28 @@ def _compile_implicit_segment(
             dynamic_batch_dim=dynamic_dim,
         )
         _report(progress_cb, solve_name)
+        if lu_factored:
+            # The same solve split at the factorization, for Jacobian reuse: trace
+            # the factor on the eager A block and the solve-with-factors on its
+            # eager factors + b, so each graph's inputs match what feeds it.
+            linear_factor = LinearFactor()
+            a_example, b_example = solve_example_inputs
+            with torch.no_grad():
+                factor_examples = tuple(t.contiguous() for t in linear_factor(a_example))
+            compile_model(
+                linear_factor,
+                (a_example,),
+                output_dir / factor_name,
+                dynamic_batch_dim=dynamic_dim,
+            )
+            _report(progress_cb, factor_name)
+            compile_model(
+                LinearSolveFactored(),
+                (*factor_examples, b_example),
+                output_dir / solve_factored_name,
+                dynamic_batch_dim=dynamic_dim,
+            )
+            _report(progress_cb, solve_factored_name)
     # Per-(unknown, given) pair metadata for the IFT graph. The IFT emits one
     # block per variable pair (via AssembledMatrix.disassemble), in
     # ift.emitted_pairs() order, so the C++ runtime composes them against
@@ -2481,6 +2509,11 @@ def _compile_implicit_segment(
             seg["precond_apply_package"] = precond_apply_name
     else:
         seg["solve_package"] = solve_name
+        if lu_factored:
+            # The solve split at the factorization; the runtime keeps the factors
+            # between Jacobian assemblies under `jacobian_refresh`.
+            seg["factor_package"] = factor_name
+            seg["solve_factored_package"] = solve_factored_name
     if emit_ift:
         # IFT operators (B = ∂r/∂g); A is reused from the forward `jacobian` graph.
         # A DIRECT input-sensitivity solver additionally bakes `solve_ift`
@@ -2976,6 +3009,24 @@ def _iterative_solver_flags(solver) -> tuple[bool, bool]:
     return iterative, precond_on
 
 
+def _lu_factored_flag(impl) -> bool:
+    """Whether an implicit segment also emits the split ``_factor`` +
+    ``_solve_factored`` LU graphs: a direct ``DenseLU`` forward solve over a single
+    residual and unknown group. Under ``jacobian_refresh`` the C++ runtime then
+    factors the lone ``A`` block once per assembly and keeps the factors. Shared
+    by the artifact predictor and the segment compiler so they cannot drift.
+    """
+    from ..solvers.dense_lu import DenseLU  # noqa: PLC0415
+
+    iterative, _ = _iterative_solver_flags(impl.solver)
+    return (
+        not iterative
+        and isinstance(getattr(impl.solver, "linear_solver", None), DenseLU)
+        and impl.system.ulayout.ngroup == 1
+        and impl.system.blayout.ngroup == 1
+    )
+
+
 def _krylov_config_of(solver) -> dict:
     """The iterative linear solver's ``krylov_config()`` dict. The caller must have
     checked :func:`_iterative_solver_flags` first (this assumes an iterative
@@ -3036,6 +3087,7 @@ def _predict_implicit_artifacts(
     has_predictor: bool,
     input_sensitivity_iterative: bool = False,
     param_sensitivity_iterative: bool = False,
+    lu_factored: bool = False,
 ) -> list[str]:
     """Ordered ``.pt2`` names an implicit segment emits -- mirrors, in emission
     order, the ``compile_model`` calls in :func:`_compile_implicit_segment`.
@@ -3043,7 +3095,9 @@ def _predict_implicit_artifacts(
     A direct forward solve emits ``jacobian`` + ``solve``; a matrix-free Krylov
     solve emits ``matvec`` instead of ``solve`` (plus ``precond_setup`` +
     ``precond_apply`` when preconditioned) and ``jacobian`` only when an
-    input/parameter derivative needs the assembled ``A``. A derivative site emits
+    input/parameter derivative needs the assembled ``A``. A direct solve that
+    *lu_factored* (:func:`_lu_factored_flag`) follows ``solve`` with its split
+    ``factor`` + ``solve_factored`` graphs. A derivative site emits
     its ``solve_ift`` / ``solve_param`` graph only for a DIRECT sensitivity solver
     -- an iterative one Krylov-solves over the assembled A at runtime (schema v12).
     """
@@ -3062,6 +3116,9 @@ def _predict_implicit_artifacts(
             arts.append(f"{basename}_precond_apply.pt2")
     else:
         arts.append(f"{basename}_solve.pt2")
+        if lu_factored:
+            arts.append(f"{basename}_factor.pt2")
+            arts.append(f"{basename}_solve_factored.pt2")
     if emit_ift:
         arts.append(f"{basename}_jacobian_given.pt2")
         if not input_sensitivity_iterative:
@@ -3114,6 +3171,7 @@ def _plan_segments(prepared: _PreparedExport, model_name: str) -> list[_SegmentP
             has_predictor=inner.predictor is not None,
             input_sensitivity_iterative=_in_sens_it,
             param_sensitivity_iterative=_param_sens_it,
+            lu_factored=_lu_factored_flag(inner),
         )
         return [
             _SegmentPlan(
@@ -3198,6 +3256,7 @@ def _plan_segments(prepared: _PreparedExport, model_name: str) -> list[_SegmentP
                     has_predictor=impl_model.predictor is not None,
                     input_sensitivity_iterative=_in_sens_it,
                     param_sensitivity_iterative=_param_sens_it,
+                    lu_factored=_lu_factored_flag(impl_model),
                 )
                 plans.append(
                     _SegmentPlan(
@@ -34,15 +34,23 @@
 // in a debug build json's JSON_ASSERT expands to assert(), and the ATen/c10
 // include chain is what brings the glibc __assert_fail declaration into scope.
 #include "neml2/csrc/aoti/internal.h"
+#include "neml2/csrc/aoti/log.h"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
+#include <exception>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <map>
 #include <mutex>
 #include <string>
 #include <system_error>
+#include <thread>
+#include <tuple>
 
 #include <nlohmann/json.hpp>
 #include <torch/csrc/inductor/aoti_package/model_package_loader.h>
@@ -145,11 +153,12 @@ extract_temp_mutex()
 // Build a loader with the consistent constructor args used across all AOTI
 // artifacts produced by neml2-compile. `device_index` is -1 for cpu artifacts
 // and cuda artifacts that target the current device; a concrete index pins a
-// cuda artifact onto a specific GPU (used by the multi-device dispatcher). On
-// Windows each load is given its own extraction temp dir (see
-// ScopedExtractTempDir); on POSIX the construction is unchanged.
+// cuda artifact onto a specific GPU (used by the multi-device dispatcher).
+// `num_runners` is how many callers can run the graph at once. On Windows each
+// load is given its own extraction temp dir (see ScopedExtractTempDir); on POSIX
+// the construction is unchanged.
 std::unique_ptr<torch::inductor::AOTIModelPackageLoader>
-make_loader(const std::filesystem::path & path, int device_index = -1)
+make_loader(const std::filesystem::path & path, int device_index = -1, std::size_t num_runners = 1)
 {
 #ifdef _WIN32
   const std::lock_guard<std::mutex> lock(extract_temp_mutex());
@@ -158,10 +167,52 @@ make_loader(const std::filesystem::path & path, int device_index = -1)
   return std::make_unique<torch::inductor::AOTIModelPackageLoader>(path.string(),
                                                                    /*model_name=*/"model",
                                                                    /*run_single_threaded=*/false,
-                                                                   /*num_runners=*/1,
+                                                                   num_runners,
                                                                    device_index);
 }
 
+// Build every loader in `loaders` (each at most once -- see SegmentLoader::load).
+// With `opts.parallel` the builds are spread over a small pool; the first
+// failure in `loaders` order is rethrown after every worker has finished.
+void
+build_loaders(const std::vector<SegmentLoader> & loaders, const LoadOptions & opts)
+{
+  if (!opts.parallel || loaders.size() < 2)
+  {
+    for (const auto & l : loaders)
+      l.load();
+    return;
+  }
+  const std::size_t hw = std::max(1u, std::thread::hardware_concurrency());
+  const std::size_t nworkers =
+      std::min<std::size_t>(opts.threads ? opts.threads : hw, loaders.size());
+  std::atomic<std::size_t> next{0};
+  std::vector<std::exception_ptr> errors(loaders.size());
+  const auto work = [&]
+  {
+    for (std::size_t i = next++; i < loaders.size(); i = next++)
+    {
+      try
+      {
+        loaders[i].load();
+      }
+      catch (...)
+      {
+        errors[i] = std::current_exception();
+      }
+    }
+  };
+  std::vector<std::thread> pool;
+  for (std::size_t w = 1; w < nworkers; ++w)
+    pool.emplace_back(work);
+  work();
+  for (auto & t : pool)
+    t.join();
+  for (const auto & e : errors)
+    if (e)
+      std::rethrow_exception(e);
+}
+
 // Parse a `krylov` metadata block into a KrylovConfig (shared by the top-level
 // forward-solve config and the per-segment sensitivity-solve descriptors).
 void
@@ -176,6 +227,11 @@ parse_krylov_json(const nlohmann::json & kc, KrylovConfig & out)
   out.abs_tol = kc.value("abs_tol", out.abs_tol);
   out.rel_tol = kc.value("rel_tol", out.rel_tol);
   out.cache_max_its = kc.value("cache_max_its", out.cache_max_its);
+  _assert(parse_forcing_term(kc.value("forcing", std::string("fixed")), out.forcing),
+          "aoti::Model: unknown krylov forcing in metadata");
+  out.forcing_max = kc.value("forcing_max", out.forcing_max);
+  out.recycle = kc.value("recycle", out.recycle);
+  out.compact_fraction = kc.value("compact_fraction", out.compact_fraction);
 }
 
 at::ScalarType
@@ -258,9 +314,93 @@ rekey_nested(const VariablePairJacobian & in,
 }
 } // namespace
 
+SegmentLoader::SegmentLoader(std::filesystem::path path,
+                             int device_index,
+                             std::string label,
+                             std::size_t runners)
+  : _state(std::make_shared<State>())
+{
+  _state->path = std::move(path);
+  _state->device_index = device_index;
+  _state->label = std::move(label);
+  _state->runners = std::max<std::size_t>(runners, 1);
+}
+
+SegmentLoader
+SegmentLoader::shared(const std::filesystem::path & path,
+                      int device_index,
+                      std::string label,
+                      std::size_t runners)
+{
+  // Keyed by what makes two packages interchangeable: the resolved file, a
+  // cheap content stamp (size + mtime, so an in-place recompile is a new key
+  // without hashing hundreds of MB on every construction), and the device the
+  // loader is pinned to. The leaf directory already encodes device type + dtype.
+  // The runner count is part of the key, so a model that asked for more
+  // concurrent runners never shares a single-runner loader.
+  using Key = std::tuple<std::string, std::uintmax_t, int64_t, int, std::size_t>;
+  static std::mutex mutex;
+  static std::map<Key, std::weak_ptr<State>> cache;
+
+  std::error_code ec;
+  const auto canonical = std::filesystem::weakly_canonical(path, ec);
+  const auto size = ec ? 0 : std::filesystem::file_size(path, ec);
+  const auto mtime = ec ? std::filesystem::file_time_type{}
+                        : std::filesystem::last_write_time(path, ec);
+  if (ec)
+    // Unreadable: let the ordinary load report the missing / broken file.
+    return SegmentLoader(path, device_index, std::move(label), runners);
+  const Key key{canonical.string(),
+                size,
+                static_cast<int64_t>(mtime.time_since_epoch().count()),
+                device_index,
+                std::max<std::size_t>(runners, 1)};
+
+  const std::lock_guard<std::mutex> lock(mutex);
+  SegmentLoader handle;
+  if (auto it = cache.find(key); it != cache.end())
+    handle._state = it->second.lock();
+  if (!handle._state)
+  {
+    handle = SegmentLoader(path, device_index, std::move(label), runners);
+    cache[key] = handle._state;
+  }
+  // Drop entries whose last Model has gone, so the map does not grow without
+  // bound across many short-lived models.
+  for (auto it = cache.begin(); it != cache.end();)
+    it = it->second.expired() ? cache.erase(it) : std::next(it);
+  return handle;
+}
+
+torch::inductor::AOTIModelPackageLoader &
+SegmentLoader::load() const
+{
+  _assert(static_cast<bool>(_state), "aoti::Model: graph was not compiled into this artifact.");
+  std::call_once(_state->once,
+                 [this]
+                 {
+                   const auto t0 = std::chrono::steady_clock::now();
+                   _state->loader =
+                       make_loader(_state->path, _state->device_index, _state->runners);
+                   _state->built = true;
+                   if (log::enabled(log::Channel::Model, log::Level::Debug))
+                   {
+                     const std::chrono::duration<double, std::milli> dt =
+                         std::chrono::steady_clock::now() - t0;
+                     log::emit(log::Channel::Model,
+                               log::Level::Debug,
+                               "loaded " + _state->label + " '" +
+                                   _state->path.filename().string() + "' in " +
+                                   std::to_string(dt.count()) + " ms");
+                   }
+                 });
+  return *_state->loader;
+}
+
 Model::Impl::Impl(const std::filesystem::path & artifact_root,
                   at::Device device,
-                  at::ScalarType dtype)
+                  at::ScalarType dtype,
+                  const LoadOptions & load)
 {
   // Register any custom ops a compiled artifact may reference (e.g.
   // neml2::opaque_pow) before a segment loads/evaluates. Lazy + idempotent so it
@@ -513,8 +653,8 @@ Model::Impl::Impl(const std::filesystem::path & artifact_root,
       }
       // `_named_parameters` is keyed by BOUNDARY name (identity when unaliased):
       // it is the mutable public surface AND the map the dispatcher slot-assigns
-      // into for multi-device sync, and `_resolve_param` reads it back through
-      // the same boundary key, so all mutation paths stay coherent. The natural
+      // into for multi-device sync, and the call plan binds each entry by the
+      // same boundary key, so all mutation paths stay coherent. The natural
       // base shape stays keyed by the ORIGINAL name (every internal reader uses
       // original names); the boundary-keyed view is built below.
       _named_parameters.emplace(_param_boundary_name(name), t.contiguous());
@@ -571,6 +711,17 @@ Model::Impl::Impl(const std::filesystem::path & artifact_root,
     _solver_config.ls_cutback = sc.value("ls_cutback", _solver_config.ls_cutback);
     _solver_config.ls_c = sc.value("ls_c", _solver_config.ls_c);
     _solver_config.substep_del_tol = sc.value("substep_del_tol", _solver_config.substep_del_tol);
+    _solver_config.check_interval = sc.value("check_interval", _solver_config.check_interval);
+    _solver_config.compact_fraction =
+        sc.value("compact_fraction", _solver_config.compact_fraction);
+    _solver_config.jacobian_refresh =
+        sc.value("jacobian_refresh", _solver_config.jacobian_refresh);
+    _solver_config.method = sc.value("method", _solver_config.method);
+    _solver_config.anderson_depth = sc.value("anderson_depth", _solver_config.anderson_depth);
+    _solver_config.anderson_beta = sc.value("anderson_beta", _solver_config.anderson_beta);
+    _solver_config.substep_method = sc.value("substep_method", _solver_config.substep_method);
+    _solver_config.substep_grow_after =
+        sc.value("substep_grow_after", _solver_config.substep_grow_after);
 
     // Linear-solver kind (schema v11). "direct" (default) chains jacobian ->
     // solve; "krylov" runs a matrix-free Krylov solve over the matvec graph,
@@ -580,7 +731,24 @@ Model::Impl::Impl(const std::filesystem::path & artifact_root,
       parse_krylov_json(sc["krylov"], _krylov_config);
   }
 
-  // Segments.
+  // Segments. Each `.pt2` is first recorded as an unbuilt SegmentLoader; the
+  // ones that must exist before the first call are collected in `eager` and
+  // built together once the metadata pass is done, serially or on a pool. With
+  // `load.lazy`, derivative-only graphs are left to build on first use.
+  std::vector<SegmentLoader> eager;
+  std::size_t n_deferred = 0;
+  const auto defer = [&](const nlohmann::json & seg_meta, const char * key, bool deferrable)
+  {
+    const auto path = cache_dir / seg_meta[key].get<std::string>();
+    auto l = load.share ? SegmentLoader::shared(path, dev_idx, key, load.runners)
+                        : SegmentLoader(path, dev_idx, key, load.runners);
+    if (deferrable && load.lazy)
+      ++n_deferred;
+    else
+      eager.push_back(l);
+    return l;
+  };
+
   _segments.reserve(meta["segments"].size());
   for (std::size_t i = 0; i < meta["segments"].size(); ++i)
   {
@@ -613,10 +781,9 @@ Model::Impl::Impl(const std::filesystem::path & artifact_root,
     if (seg_kind == "forward")
     {
       seg.kind = SegmentKind::Forward;
-      seg.fwd_loader = make_loader(cache_dir / seg_meta["package"].get<std::string>(), dev_idx);
+      seg.fwd_loader = defer(seg_meta, "package", /*deferrable=*/false);
       if (seg_meta.contains("jvp_package"))
-        seg.jvp_loader =
-            make_loader(cache_dir / seg_meta["jvp_package"].get<std::string>(), dev_idx);
+        seg.jvp_loader = defer(seg_meta, "jvp_package", /*deferrable=*/false);
       for (const auto & v : seg_meta["inputs"])
         seg.fwd_inputs.push_back(v["name"].get<std::string>());
       for (const auto & v : seg_meta["outputs"])
@@ -650,8 +817,7 @@ Model::Impl::Impl(const std::filesystem::path & artifact_root,
       // returns one gradient per parameter given output cotangents.
       if (seg_meta.contains("param_jacobian_package"))
       {
-        seg.param_jacobian_loader =
-            make_loader(cache_dir / seg_meta["param_jacobian_package"].get<std::string>(), dev_idx);
+        seg.param_jacobian_loader = defer(seg_meta, "param_jacobian_package", /*deferrable=*/true);
         for (const auto & p : seg_meta["param_jacobian_pairs"])
         {
           Segment::ParamPairInfo pi;
@@ -668,8 +834,7 @@ Model::Impl::Impl(const std::filesystem::path & artifact_root,
       }
       if (seg_meta.contains("param_vjp_package"))
       {
-        seg.param_vjp_loader =
-            make_loader(cache_dir / seg_meta["param_vjp_package"].get<std::string>(), dev_idx);
+        seg.param_vjp_loader = defer(seg_meta, "param_vjp_package", /*deferrable=*/true);
         seg.param_vjp_params = seg_meta["param_vjp_params"].get<std::vector<std::string>>();
         seg.param_vjp_outputs = seg_meta["param_vjp_outputs"].get<std::vector<std::string>>();
       }
@@ -683,23 +848,23 @@ Model::Impl::Impl(const std::filesystem::path & artifact_root,
       // Which graphs are present depends on the solver kind -- a direct solve has
       // jacobian + solve; a Krylov solve has matvec (+ jacobian only when a
       // preconditioner / input derivative needs A). Load each iff its key exists.
-      seg.residual_loader =
-          make_loader(cache_dir / seg_meta["residual_package"].get<std::string>(), dev_idx);
+      seg.residual_loader = defer(seg_meta, "residual_package", /*deferrable=*/false);
       if (seg_meta.contains("jacobian_package"))
-        seg.jacobian_loader =
-            make_loader(cache_dir / seg_meta["jacobian_package"].get<std::string>(), dev_idx);
+        seg.jacobian_loader = defer(seg_meta, "jacobian_package", /*deferrable=*/false);
       if (seg_meta.contains("solve_package"))
-        seg.solve_loader =
-            make_loader(cache_dir / seg_meta["solve_package"].get<std::string>(), dev_idx);
+        seg.solve_loader = defer(seg_meta, "solve_package", /*deferrable=*/false);
+      // The split LU pair only runs under Jacobian reuse, so it may load lazily.
+      if (seg_meta.contains("factor_package"))
+      {
+        seg.factor_loader = defer(seg_meta, "factor_package", /*deferrable=*/true);
+        seg.solve_factored_loader = defer(seg_meta, "solve_factored_package", /*deferrable=*/true);
+      }
       if (seg_meta.contains("matvec_package"))
-        seg.matvec_loader =
-            make_loader(cache_dir / seg_meta["matvec_package"].get<std::string>(), dev_idx);
+        seg.matvec_loader = defer(seg_meta, "matvec_package", /*deferrable=*/false);
       if (seg_meta.contains("precond_setup_package"))
       {
-        seg.precond_setup_loader =
-            make_loader(cache_dir / seg_meta["precond_setup_package"].get<std::string>(), dev_idx);
-        seg.precond_apply_loader =
-            make_loader(cache_dir / seg_meta["precond_apply_package"].get<std::string>(), dev_idx);
+        seg.precond_setup_loader = defer(seg_meta, "precond_setup_package", /*deferrable=*/false);
+        seg.precond_apply_loader = defer(seg_meta, "precond_apply_package", /*deferrable=*/false);
       }
       // IFT: `jacobian_given` (B = ∂r/∂g) is emitted whenever an input derivative
       // is compiled; `solve_ift` (the baked direct solve) only when the
@@ -707,11 +872,9 @@ Model::Impl::Impl(const std::filesystem::path & artifact_root,
       // (`input_sensitivity_kind == "krylov"`) runs `krylov_solve_dense` over the
       // assembled A instead (schema v12).
       if (seg_meta.contains("jacobian_given_package"))
-        seg.jacobian_given_loader =
-            make_loader(cache_dir / seg_meta["jacobian_given_package"].get<std::string>(), dev_idx);
+        seg.jacobian_given_loader = defer(seg_meta, "jacobian_given_package", /*deferrable=*/true);
       if (seg_meta.contains("solve_ift_package"))
-        seg.solve_ift_loader =
-            make_loader(cache_dir / seg_meta["solve_ift_package"].get<std::string>(), dev_idx);
+        seg.solve_ift_loader = defer(seg_meta, "solve_ift_package", /*deferrable=*/true);
       if (seg_meta.contains("input_sensitivity"))
       {
         const auto & isd = seg_meta["input_sensitivity"];
@@ -783,11 +946,9 @@ Model::Impl::Impl(const std::filesystem::path & artifact_root,
       // (`param_sensitivity_kind == "krylov"`) runs `krylov_solve_dense` over the
       // dense A instead (schema v12).
       if (seg_meta.contains("dr_dparam_package"))
-        seg.dr_dparam_loader =
-            make_loader(cache_dir / seg_meta["dr_dparam_package"].get<std::string>(), dev_idx);
+        seg.dr_dparam_loader = defer(seg_meta, "dr_dparam_package", /*deferrable=*/true);
       if (seg_meta.contains("solve_param_package"))
-        seg.solve_param_loader =
-            make_loader(cache_dir / seg_meta["solve_param_package"].get<std::string>(), dev_idx);
+        seg.solve_param_loader = defer(seg_meta, "solve_param_package", /*deferrable=*/true);
       if (seg_meta.contains("param_jacobian_pairs"))
       {
         for (const auto & p : seg_meta["param_jacobian_pairs"])
@@ -822,8 +983,7 @@ Model::Impl::Impl(const std::filesystem::path & artifact_root,
 
       if (seg_meta.contains("predictor_package"))
       {
-        seg.predictor_loader =
-            make_loader(cache_dir / seg_meta["predictor_package"].get<std::string>(), dev_idx);
+        seg.predictor_loader = defer(seg_meta, "predictor_package", /*deferrable=*/false);
         for (const auto & v : seg_meta["predictor_inputs"])
           seg.predictor_inputs.push_back(v["name"].get<std::string>());
         for (const auto & v : seg_meta["predictor_outputs"])
@@ -874,28 +1034,285 @@ Model::Impl::Impl(const std::filesystem::path & artifact_root,
     }
     _segments.push_back(std::move(seg));
   }
+
+  const auto n_reused = static_cast<std::size_t>(
+      std::count_if(eager.begin(), eager.end(), [](const auto & l) { return l.built(); }));
+  const auto t0 = std::chrono::steady_clock::now();
+  build_loaders(eager, load);
+  if (log::enabled(log::Channel::Model, log::Level::Info))
+  {
+    const std::chrono::duration<double, std::milli> dt = std::chrono::steady_clock::now() - t0;
+    log::emit(log::Channel::Model,
+              log::Level::Info,
+              "loaded " + std::to_string(eager.size()) + " graph(s) from '" + cache_dir.string() +
+                  "' in " + std::to_string(dt.count()) + " ms (" +
+                  (load.parallel ? "parallel" : "serial") + ", " + std::to_string(n_reused) +
+                  " shared, " + std::to_string(n_deferred) + " deferred)");
+  }
+
+  _build_plan();
 }
 
-const at::Tensor &
-Model::Impl::_resolve_param(const std::string & name) const
+void
+Model::Impl::_build_plan()
+{
+  std::map<std::string, std::size_t> slot_of;
+  // First reference assigns the next free slot; later references reuse it.
+  const auto slot = [&](const std::string & name)
+  { return slot_of.emplace(name, slot_of.size()).first->second; };
+
+  _plan = CallPlan{};
+  for (const auto & n : _input_names)
+    _plan.input_slots.push_back(slot(n));
+
+  // Bind each promoted parameter to its stored entry. `_named_parameters` is
+  // node-based and only ever reassigned, so the pointers stay valid.
+  std::map<std::string, std::size_t> param_of; // by ORIGINAL name
+  for (const auto & [name, base] : _param_base_shapes)
+  {
+    const std::string & key = _param_boundary_name(name);
+    auto it = _named_parameters.find(key);
+    _assert(it != _named_parameters.end(),
+            "aoti::Model: promoted parameter '",
+            name,
+            "' is missing from named_parameters().");
+    param_of.emplace(name, _plan.params.size());
+    _plan.param_of.emplace(key, _plan.params.size());
+    _plan.params.push_back(&it->second);
+  }
+  const auto param = [&](const std::string & name)
+  {
+    auto it = param_of.find(name);
+    _assert(it != param_of.end(),
+            "aoti::Model: segment consumes parameter '",
+            name,
+            "' which is not a promoted parameter.");
+    return it->second;
+  };
+
+  for (const auto & seg : _segments)
+  {
+    CallPlan::Step step;
+    for (const auto & p : seg.param_inputs)
+      step.params.push_back(param(p));
+    for (const auto & p : seg.predictor_param_inputs)
+      step.predictor_params.push_back(param(p));
+    if (seg.kind == SegmentKind::Forward)
+    {
+      for (const auto & n : seg.fwd_inputs)
+        step.in_slots.push_back(slot(n));
+      for (const auto & n : seg.fwd_outputs)
+        step.out_slots.push_back(slot(n));
+      for (const auto & p : seg.param_inputs)
+        step.param_base_ndim.push_back(static_cast<int64_t>(_param_base_shapes.at(p).size()));
+    }
+    else
+    {
+      const auto group_slots = [&](const std::vector<Segment::GroupInfo> & groups)
+      {
+        std::vector<std::vector<std::size_t>> out;
+        for (const auto & g : groups)
+        {
+          out.emplace_back();
+          for (const auto & v : g.per_var_info)
+            out.back().push_back(slot(v.name));
+        }
+        return out;
+      };
+      for (const auto & v : seg.givens)
+        step.given_slots.push_back(slot(v.name));
+      for (const auto & v : seg.unknowns)
+        step.unknown_slots.push_back(slot(v.name));
+      step.given_group_slots = group_slots(seg.given_groups);
+      step.unknown_group_slots = group_slots(seg.unknown_groups);
+      for (const auto & n : seg.predictor_inputs)
+        step.predictor_in_slots.push_back(slot(n));
+      for (const auto & n : seg.predictor_outputs)
+        step.predictor_out_slots.push_back(slot(n));
+      if (seg.predictor_feedback.iterations > 0)
+      {
+        step.feedback_in_slot = slot(seg.predictor_feedback.input);
+        step.feedback_out_slot = slot(seg.predictor_feedback.output);
+      }
+      if (seg.max_substepping_level > 0)
+      {
+        const auto bridge = [&](const std::string & n)
+        {
+          for (const auto & entry : step.bridge)
+            if (entry.first == n)
+              return;
+          step.bridge.emplace_back(n, slot(n));
+        };
+        for (const auto & v : seg.givens)
+          bridge(v.name);
+        for (const auto & v : seg.unknowns)
+          bridge(v.name);
+        for (const auto & n : seg.predictor_inputs)
+          bridge(n);
+        for (const auto & n : seg.predictor_outputs)
+          bridge(n);
+        if (seg.predictor_feedback.iterations > 0)
+        {
+          bridge(seg.predictor_feedback.input);
+          bridge(seg.predictor_feedback.output);
+        }
+      }
+    }
+    _plan.steps.push_back(std::move(step));
+  }
+
+  for (const auto & n : _output_names)
+    _plan.output_slots.push_back(slot(n));
+  _plan.nslots = slot_of.size();
+}
+
+thread_local const Model::Impl::ContextFrame * Model::Impl::_t_frame = nullptr;
+thread_local std::map<const Model::Impl *, Model::Impl::StatsSlot> Model::Impl::_t_last_stats;
+
+Model::Impl::ContextFrame::ContextFrame(const Impl * i)
+  : impl(i),
+    prev(_t_frame),
+    ctx(i->_ctx())
+{
+  _t_frame = this;
+}
+
+Model::Impl::ContextFrame::~ContextFrame() { _t_frame = prev; }
+
+const Model::Impl::CallContext &
+Model::Impl::_ctx() const
+{
+  static const CallContext none;
+  for (const auto * f = _t_frame; f != nullptr; f = f->prev)
+    if (f->impl == this)
+      return f->ctx;
+  return none;
+}
+
+Model::Impl::StatsGuard::StatsGuard(const Impl * i)
+  : ContextFrame(i)
+{
+  if (!i->_solver_config.collect_stats || ctx.stats != nullptr)
+    return;
+  for (const auto & seg : i->_segments)
+  {
+    if (seg.kind != SegmentKind::Implicit)
+      continue;
+    SegmentStats s;
+    for (const auto & u : seg.unknowns)
+    {
+      auto it = i->_out_orig2ext.find(u.name);
+      s.unknowns.push_back(it == i->_out_orig2ext.end() ? u.name : it->second);
+    }
+    owned.segments.push_back(std::move(s));
+  }
+  ctx.stats = &owned;
+}
+
+// Runs during unwinding too, so publishing must not throw.
+Model::Impl::StatsGuard::~StatsGuard()
+{
+  if (ctx.stats != &owned)
+    return;
+  try
+  {
+    for (auto it = _t_last_stats.begin(); it != _t_last_stats.end();)
+      it = it->second.alive.expired() ? _t_last_stats.erase(it) : std::next(it);
+    _t_last_stats[impl] = {impl->_stats_token, std::move(owned)};
+  }
+  catch (...) // LCOV_EXCL_LINE
+  {
+  }
+}
+
+SegmentStats *
+Model::Impl::_seg_stats(const Segment & seg) const
+{
+  auto * st = _ctx().stats;
+  if (st == nullptr)
+    return nullptr;
+  std::size_t k = 0;
+  for (const auto & s : _segments)
+  {
+    if (&s == &seg)
+      return &st->segments[k];
+    if (s.kind == SegmentKind::Implicit)
+      ++k;
+  }
+  return nullptr;
+}
+
+at::Tensor *
+Model::Impl::_ws_slot(WsTag tag, std::size_t seg, std::size_t idx, at::IntArrayRef shape) const
 {
-  // `name` is the ORIGINAL segment/metadata name; `_named_parameters` and the
-  // per-call `_param_overrides` are keyed by BOUNDARY name (identity when the
-  // parameter is unaliased), so map it through first.
-  const std::string & key = _param_boundary_name(name);
-  if (_param_overrides != nullptr)
+  auto * ws = _ctx().workspace;
+  if (!ws)
+    return nullptr;
+  auto & entry = ws->buffers[{this, tag, seg, idx, Workspace::Impl::hash_shape(shape)}];
+  // Two shapes with one hash share the entry; the later one takes it over.
+  if (!at::IntArrayRef(entry.shape).equals(shape))
   {
-    auto oit = _param_overrides->find(key);
-    if (oit != _param_overrides->end())
-      return oit->second;
+    entry.shape.assign(shape.begin(), shape.end());
+    entry.t = at::Tensor();
   }
-  auto it = _named_parameters.find(key);
-  _assert(it != _named_parameters.end(),
+  if (entry.t.defined())
+    ++ws->hits;
+  else
+    ++ws->misses;
+  return &entry.t;
+}
+
+at::Tensor
+Model::Impl::_ws_zeros(WsTag tag,
+                       std::size_t seg,
+                       std::size_t idx,
+                       at::IntArrayRef shape,
+                       const at::TensorOptions & opts) const
+{
+  at::Tensor * cached = _ws_slot(tag, seg, idx, shape);
+  if (cached && cached->defined())
+    return *cached;
+  auto z = at::zeros(shape, opts);
+  if (cached)
+    *cached = z;
+  return z;
+}
+
+at::Tensor
+Model::Impl::_ws_buffer(WsTag tag,
+                        std::size_t seg,
+                        std::size_t idx,
+                        at::IntArrayRef shape,
+                        const at::TensorOptions & opts) const
+{
+  at::Tensor * cached = _ws_slot(tag, seg, idx, shape);
+  if (!cached)
+    return {};
+  if (!cached->defined() || cached->dtype() != opts.dtype() || cached->device() != opts.device())
+    *cached = at::empty(shape, opts);
+  return *cached;
+}
+
+const at::Tensor &
+Model::Impl::_resolve_param(const std::string & name) const
+{
+  // `name` is the ORIGINAL segment/metadata name; the plan's parameter index is
+  // keyed by BOUNDARY name (identity when the parameter is unaliased), so map it
+  // through first.
+  auto it = _plan.param_of.find(_param_boundary_name(name));
+  _assert(it != _plan.param_of.end(),
           "aoti::Model: segment references promoted parameter '",
           name,
-          "' which is missing from named_parameters(). Either the user mutated the map "
-          "or the metadata is inconsistent.");
-  return it->second;
+          "' which is not in named_parameters(). The metadata is inconsistent.");
+  return _resolve_param(it->second);
+}
+
+const at::Tensor &
+Model::Impl::_resolve_param(std::size_t p) const
+{
+  if (const auto * values = _ctx().param_values)
+    return *(*values)[p];
+  return *_plan.params[p];
 }
 
 std::vector<at::Tensor>
@@ -908,12 +1325,41 @@ Model::Impl::_gather_params(const std::vector<std::string> & names) const
   return out;
 }
 
+std::vector<at::Tensor>
+Model::Impl::_gather_params(const std::vector<std::size_t> & params) const
+{
+  std::vector<at::Tensor> out;
+  out.reserve(params.size());
+  for (auto p : params)
+    out.push_back(_resolve_param(p).contiguous());
+  return out;
+}
+
+Model::Impl::ParamOverrideGuard::ParamOverrideGuard(
+    const Impl * i, const std::map<std::string, at::Tensor> & overrides)
+  : ContextFrame(i)
+{
+  if (overrides.empty())
+    return;
+  values = i->_plan.params;
+  for (const auto & [name, t] : overrides)
+  {
+    auto it = i->_plan.param_of.find(name);
+    if (it != i->_plan.param_of.end())
+      values[it->second] = &t;
+  }
+  ctx.param_values = &values;
+}
+
 // ----------------------------------------------------------------------------
 // Public facade: forward every call onto the opaque Impl.
 // ----------------------------------------------------------------------------
 
-Model::Model(const std::filesystem::path & artifact_root, at::Device device, at::ScalarType dtype)
-  : _impl(std::make_unique<Impl>(artifact_root, device, dtype))
+Model::Model(const std::filesystem::path & artifact_root,
+             at::Device device,
+             at::ScalarType dtype,
+             const LoadOptions & load)
+  : _impl(std::make_unique<Impl>(artifact_root, device, dtype, load))
 {
 }
 
@@ -943,6 +1389,19 @@ Model::output_base_shapes() const noexcept
   return _impl->output_base_shapes();
 }
 
+std::vector<std::string>
+Model::unknown_names() const
+{
+  std::vector<std::string> names;
+  for (const auto & seg : _impl->_segments)
+    for (const auto & u : seg.unknowns)
+    {
+      auto it = _impl->_out_orig2ext.find(u.name);
+      names.push_back(it == _impl->_out_orig2ext.end() ? u.name : it->second);
+    }
+  return names;
+}
+
 // The ops run through `_guarded` so every exception leaving the public surface
 // is a neml2 Exception with a meaningful `recoverable()`: a recoverable
 // ConvergenceError from the Newton solve passes through, while a foreign torch
@@ -952,52 +1411,310 @@ Model::output_base_shapes() const noexcept
 // When the artifact carries boundary renames (`_has_aliases`) each op re-keys at
 // the interface: incoming input / tangent dicts BOUNDARY->original, cotangents
 // BOUNDARY->original (keyed by output name), and results original->BOUNDARY.
-// `param_overrides` passes through unchanged -- it is keyed by boundary name and
-// `_resolve_param` maps each original segment name to its boundary key. The
+// `param_overrides` passes through unchanged -- it is keyed by boundary name, as
+// is the plan's parameter index it is mapped through (`ParamOverrideGuard`). The
 // unrenamed common case takes the no-copy fast path.
+//
+// Each op also opens a `StatsGuard`, which records the call's `SolveStats` when
+// `collect_stats` is on and is otherwise an inert frame.
 std::map<std::string, at::Tensor>
 Model::forward(const std::map<std::string, at::Tensor> & inputs,
-               const std::map<std::string, at::Tensor> & param_overrides) const
+               const std::map<std::string, at::Tensor> & param_overrides,
+               const std::map<std::string, at::Tensor> & initial_guess,
+               const std::vector<at::Tensor> & substep_hint) const
 {
   return _guarded(
       [&]() -> std::map<std::string, at::Tensor>
       {
+        const Impl::StatsGuard _sg(_impl.get());
+        const Impl::SubstepHintGuard _hg(_impl.get(), substep_hint);
         if (!_impl->_has_aliases)
-          return _impl->forward(inputs, param_overrides);
-        auto out = _impl->forward(rekey(inputs, _impl->_in_ext2orig), param_overrides);
+          return _impl->forward(inputs, param_overrides, initial_guess);
+        // Unknowns that are outputs carry their boundary name; the rest pass through.
+        auto out = _impl->forward(rekey(inputs, _impl->_in_ext2orig),
+                                  param_overrides,
+                                  rekey(initial_guess, _impl->_out_ext2orig));
         return rekey(out, _impl->_out_orig2ext);
       });
 }
 
+// The preallocated outputs are re-keyed like any other dict: the re-keyed map
+// holds the caller's tensor handles, so the in-place writes land in their storage.
+void
+Model::forward_into(const std::map<std::string, at::Tensor> & inputs,
+                    const std::map<std::string, at::Tensor> & outputs,
+                    const std::map<std::string, at::Tensor> & param_overrides,
+                    const std::map<std::string, at::Tensor> & initial_guess) const
+{
+  _guarded(
+      [&]
+      {
+        const Impl::StatsGuard _sg(_impl.get());
+        if (!_impl->_has_aliases)
+          return _impl->forward_into(inputs, outputs, param_overrides, initial_guess);
+        _impl->forward_into(rekey(inputs, _impl->_in_ext2orig),
+                            rekey(outputs, _impl->_out_ext2orig),
+                            param_overrides,
+                            rekey(initial_guess, _impl->_out_ext2orig));
+      });
+}
+
+Model::Binding::Binding(const Model & model,
+                        std::vector<std::string> names,
+                        std::vector<std::size_t> perm)
+  : _model(&model),
+    _names(std::move(names)),
+    _perm(std::move(perm))
+{
+}
+
+const std::vector<std::string> &
+Model::Binding::output_names() const noexcept
+{
+  return _model->output_names();
+}
+
+// Positions are resolved against the master order at `bind` time, so a bound
+// call needs no boundary re-keying of its inputs even when the artifact carries
+// aliases; only a guess is re-keyed, like `forward`'s.
+std::vector<at::Tensor>
+Model::Binding::forward(const std::vector<at::Tensor> & inputs,
+                        const std::map<std::string, at::Tensor> & param_overrides,
+                        const std::map<std::string, at::Tensor> & initial_guess) const
+{
+  return _guarded(
+      [&]
+      {
+        const Impl::StatsGuard _sg(_model->_impl.get());
+        _assert(inputs.size() == _perm.size(),
+                "aoti::Model::Binding::forward: expected ",
+                _perm.size(),
+                " positional inputs, got ",
+                inputs.size(),
+                ".");
+        std::vector<at::Tensor> ordered(inputs.size());
+        for (std::size_t k = 0; k < inputs.size(); ++k)
+          ordered[_perm[k]] = inputs[k];
+        const auto * impl = _model->_impl.get();
+        const Impl::ParamOverrideGuard _pog(impl, param_overrides);
+        std::map<std::string, at::Tensor> rekeyed;
+        if (impl->_has_aliases)
+          rekeyed = rekey(initial_guess, impl->_out_ext2orig);
+        const Impl::InitialGuessGuard _igg(impl, impl->_has_aliases ? rekeyed : initial_guess);
+        return impl->_forward_positional(std::move(ordered));
+      });
+}
+
+Model::Binding
+Model::bind(const std::vector<std::string> & input_names) const
+{
+  return _guarded(
+      [&]
+      {
+        const auto & names = this->input_names();
+        _assert(input_names.size() == names.size(),
+                "aoti::Model::bind: all ",
+                names.size(),
+                " inputs must be bound, got ",
+                input_names.size(),
+                ".");
+        std::vector<std::size_t> perm;
+        std::vector<bool> bound(names.size(), false);
+        for (const auto & n : input_names)
+        {
+          auto it = std::find(names.begin(), names.end(), n);
+          _assert(it != names.end(), "aoti::Model::bind: '", n, "' is not an input of this model.");
+          const auto k = static_cast<std::size_t>(it - names.begin());
+          _assert(!bound[k], "aoti::Model::bind: input '", n, "' is bound twice.");
+          bound[k] = true;
+          perm.push_back(k);
+        }
+        return Binding(*this, input_names, std::move(perm));
+      });
+}
+
+std::size_t
+Model::Workspace::Impl::KeyHash::operator()(const Key & k) const noexcept
+{
+  std::size_t h = std::hash<const void *>()(k.owner);
+  for (const std::size_t v : {static_cast<std::size_t>(k.tag), k.seg, k.idx, k.shape})
+    h ^= v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+  return h;
+}
+
+std::size_t
+Model::Workspace::Impl::hash_shape(at::IntArrayRef shape) noexcept
+{
+  std::size_t h = shape.size();
+  for (const int64_t d : shape)
+    h ^= std::hash<int64_t>()(d) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+  return h;
+}
+
+Model::Workspace::Workspace()
+  : _impl(std::make_unique<Impl>())
+{
+}
+
+Model::Workspace::~Workspace() = default;
+Model::Workspace::Workspace(Workspace &&) noexcept = default;
+Model::Workspace & Model::Workspace::operator=(Workspace &&) noexcept = default;
+
+std::size_t
+Model::Workspace::hits() const noexcept
+{
+  return _impl->hits;
+}
+
+std::size_t
+Model::Workspace::misses() const noexcept
+{
+  return _impl->misses;
+}
+
+void
+Model::Workspace::clear() noexcept
+{
+  _impl->buffers.clear();
+  _impl->hits = 0;
+  _impl->misses = 0;
+}
+
+// The workspace overloads install `ws` for the duration of the call and then
+// defer to the plain op, so the guarding and boundary re-keying stay in one place.
+std::map<std::string, at::Tensor>
+Model::forward(const std::map<std::string, at::Tensor> & inputs,
+               Workspace & ws,
+               const std::map<std::string, at::Tensor> & param_overrides) const
+{
+  const Impl::WorkspaceGuard _wg(_impl.get(), ws._impl.get());
+  return forward(inputs, param_overrides);
+}
+
 std::pair<std::map<std::string, at::Tensor>, std::map<std::string, at::Tensor>>
 Model::jvp(const std::map<std::string, at::Tensor> & inputs,
            const std::map<std::string, at::Tensor> & tangents,
+           Workspace & ws,
            const std::map<std::string, at::Tensor> & param_overrides) const
+{
+  const Impl::WorkspaceGuard _wg(_impl.get(), ws._impl.get());
+  return jvp(inputs, tangents, param_overrides);
+}
+
+std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
+Model::jacobian(const std::map<std::string, at::Tensor> & inputs,
+                Workspace & ws,
+                const std::map<std::string, at::Tensor> & param_overrides) const
+{
+  const Impl::WorkspaceGuard _wg(_impl.get(), ws._impl.get());
+  return jacobian(inputs, param_overrides);
+}
+
+std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
+Model::param_jacobian(const std::map<std::string, at::Tensor> & inputs,
+                      Workspace & ws,
+                      const std::map<std::string, at::Tensor> & param_overrides) const
+{
+  const Impl::WorkspaceGuard _wg(_impl.get(), ws._impl.get());
+  return param_jacobian(inputs, param_overrides);
+}
+
+std::pair<std::map<std::string, at::Tensor>, std::map<std::string, at::Tensor>>
+Model::jvp(const std::map<std::string, at::Tensor> & inputs,
+           const std::map<std::string, at::Tensor> & tangents,
+           const std::map<std::string, at::Tensor> & param_overrides,
+           const std::map<std::string, at::Tensor> & initial_guess) const
 {
   using Ret = std::pair<std::map<std::string, at::Tensor>, std::map<std::string, at::Tensor>>;
   return _guarded(
       [&]() -> Ret
       {
+        const Impl::StatsGuard _sg(_impl.get());
         if (!_impl->_has_aliases)
-          return _impl->jvp(inputs, tangents, param_overrides);
+          return _impl->jvp(inputs, tangents, param_overrides, initial_guess);
         auto [out, jout] = _impl->jvp(rekey(inputs, _impl->_in_ext2orig),
                                       rekey(tangents, _impl->_in_ext2orig),
-                                      param_overrides);
+                                      param_overrides,
+                                      rekey(initial_guess, _impl->_out_ext2orig));
+        return {rekey(out, _impl->_out_orig2ext), rekey(jout, _impl->_out_orig2ext)};
+      });
+}
+
+std::pair<std::map<std::string, at::Tensor>, std::map<std::string, at::Tensor>>
+Model::jvp_multi(const std::map<std::string, at::Tensor> & inputs,
+                 const std::map<std::string, at::Tensor> & tangents,
+                 const std::map<std::string, at::Tensor> & param_overrides,
+                 const std::map<std::string, at::Tensor> & initial_guess) const
+{
+  using Ret = std::pair<std::map<std::string, at::Tensor>, std::map<std::string, at::Tensor>>;
+  return _guarded(
+      [&]() -> Ret
+      {
+        const Impl::StatsGuard _sg(_impl.get());
+        if (!_impl->_has_aliases)
+          return _impl->jvp_multi(inputs, tangents, param_overrides, initial_guess);
+        auto [out, jout] = _impl->jvp_multi(rekey(inputs, _impl->_in_ext2orig),
+                                            rekey(tangents, _impl->_in_ext2orig),
+                                            param_overrides,
+                                            rekey(initial_guess, _impl->_out_ext2orig));
         return {rekey(out, _impl->_out_orig2ext), rekey(jout, _impl->_out_orig2ext)};
       });
 }
 
 std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
 Model::jacobian(const std::map<std::string, at::Tensor> & inputs,
-                const std::map<std::string, at::Tensor> & param_overrides) const
+                const std::map<std::string, at::Tensor> & param_overrides,
+                const std::map<std::string, at::Tensor> & initial_guess,
+                const std::vector<at::Tensor> & substep_hint) const
+{
+  using Ret = std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>;
+  return _guarded(
+      [&]() -> Ret
+      {
+        const Impl::StatsGuard _sg(_impl.get());
+        const Impl::SubstepHintGuard _hg(_impl.get(), substep_hint);
+        if (!_impl->_has_aliases)
+          return _impl->jacobian(inputs, param_overrides, initial_guess);
+        auto [out, jac] = _impl->jacobian(rekey(inputs, _impl->_in_ext2orig),
+                                          param_overrides,
+                                          rekey(initial_guess, _impl->_out_ext2orig));
+        return {rekey(out, _impl->_out_orig2ext),
+                rekey_nested(jac, _impl->_out_orig2ext, _impl->_in_orig2ext)};
+      });
+}
+
+std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
+Model::jacobian(const std::map<std::string, at::Tensor> & inputs,
+                const std::vector<std::string> & wrt_inputs,
+                const std::vector<std::string> & of_outputs,
+                const std::map<std::string, at::Tensor> & param_overrides,
+                const std::map<std::string, at::Tensor> & initial_guess,
+                const std::vector<at::Tensor> & substep_hint) const
 {
   using Ret = std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>;
   return _guarded(
       [&]() -> Ret
       {
+        const Impl::StatsGuard _sg(_impl.get());
+        const Impl::SubstepHintGuard _hg(_impl.get(), substep_hint);
         if (!_impl->_has_aliases)
-          return _impl->jacobian(inputs, param_overrides);
-        auto [out, jac] = _impl->jacobian(rekey(inputs, _impl->_in_ext2orig), param_overrides);
+          return _impl->jacobian(inputs, wrt_inputs, of_outputs, param_overrides, initial_guess);
+        auto orig = [](const std::vector<std::string> & names,
+                       const std::map<std::string, std::string> & tr)
+        {
+          std::vector<std::string> out;
+          for (const auto & n : names)
+          {
+            auto it = tr.find(n);
+            out.push_back(it == tr.end() ? n : it->second);
+          }
+          return out;
+        };
+        auto [out, jac] = _impl->jacobian(rekey(inputs, _impl->_in_ext2orig),
+                                          orig(wrt_inputs, _impl->_in_ext2orig),
+                                          orig(of_outputs, _impl->_out_ext2orig),
+                                          param_overrides,
+                                          rekey(initial_guess, _impl->_out_ext2orig));
         return {rekey(out, _impl->_out_orig2ext),
                 rekey_nested(jac, _impl->_out_orig2ext, _impl->_in_orig2ext)};
       });
@@ -1011,6 +1728,7 @@ Model::param_jacobian(const std::map<std::string, at::Tensor> & inputs,
   return _guarded(
       [&]() -> Ret
       {
+        const Impl::StatsGuard _sg(_impl.get());
         if (!_impl->_has_aliases)
           return _impl->param_jacobian(inputs, param_overrides);
         auto [out, pjac] =
@@ -1029,6 +1747,7 @@ Model::param_vjp(const std::map<std::string, at::Tensor> & inputs,
   return _guarded(
       [&]() -> std::map<std::string, at::Tensor>
       {
+        const Impl::StatsGuard _sg(_impl.get());
         if (!_impl->_has_aliases)
           return _impl->param_vjp(inputs, cotangents, param_overrides);
         // cotangents are keyed by OUTPUT name (BOUNDARY->original); the result is
@@ -1087,6 +1806,29 @@ void
 Model::set_solver_config(const SolverConfig & config)
 {
   _impl->_solver_config = config;
+  set_forward_memo(_impl->_memo_enabled.load());
+}
+
+const SolverConfig &
+Model::solver_config() const noexcept
+{
+  return _impl->_solver_config;
+}
+
+void
+Model::set_forward_memo(bool enable)
+{
+  const std::lock_guard<std::mutex> lock(_impl->_memo_mutex);
+  _impl->_memo_enabled = enable;
+  _impl->_memo.reset();
+}
+
+SolveStats
+Model::last_solve_stats() const
+{
+  const auto it = Impl::_t_last_stats.find(_impl.get());
+  return it == Impl::_t_last_stats.end() || it->second.alive.expired() ? SolveStats{}
+                                                                       : it->second.stats;
 }
 
 } // namespace neml2::aoti
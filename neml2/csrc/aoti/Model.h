@@ -73,6 +73,168 @@ struct SolverConfig
   /// surface it as data. Off by default -- it forces a scalar device->host sync
   /// per iteration, so it is opt-in. Console verbosity is a separate concern.
   bool collect_log = false;
+  /// Iterations between convergence checks. Each check reads the residual
+  /// norms back to the host, which stalls a GPU stream. With k > 1 the solve
+  /// runs k updates back to back with no host sync: rows that have converged
+  /// are tracked in a device-side mask and frozen, as in `solve_masked`, and
+  /// the mask is read once per k iterations. A solve can overshoot its
+  /// converged iteration by up to k - 1 updates; the converged rows do not
+  /// move. 0 and 1 both check every iteration. The line search
+  /// (`ls_max_iters` > 1) likewise reads its stop test back on every k-th
+  /// trial only. In between, rows that have stopped keep their step length,
+  /// so the accepted iterates do not change, but a Newton update can run up
+  /// to k - 1 extra residual evaluations. With k >= `ls_max_iters` - 1 the
+  /// line search runs its full trial budget with no host sync.
+  std::size_t check_interval = 1;
+  /// Active-set compaction for the masked (substepping) solve. At a convergence
+  /// check where at least this fraction of the rows still iterating is done
+  /// (converged or non-finite), the solve drops those rows and runs the rest as a
+  /// smaller batch, scattering everything back at the end. It pays off when most
+  /// rows converge in a few iterations and a few need many. 0 (the default)
+  /// disables it.
+  double compact_fraction = 0.0;
+  /// Newton iterations between Jacobian assemblies in the direct solve. 1 (the
+  /// default) assembles every iteration (full Newton). With m > 1 the Jacobian
+  /// assembled at iteration 0 is reused, refreshed every m iterations, and the
+  /// iterations in between evaluate only the residual before the linear solve
+  /// (modified Newton). 0 assembles once per solve (chord Newton). A segment
+  /// compiled with the split LU graphs (a DenseLU solve over one residual and
+  /// one unknown group) keeps the factors, so those iterations skip the
+  /// factorization too; other direct solves keep only the assembly. Reuse trades
+  /// quadratic for linear convergence, so it pays off when assembly dominates an
+  /// iteration and the Jacobian changes little; raise `miters` to match. The
+  /// Krylov solver ignores it (see `KrylovConfig::cache` for its analogue).
+  std::size_t jacobian_refresh = 1;
+  /// The nonlinear iteration: "NEWTON" (the default) or "ANDERSON". Anderson
+  /// acceleration iterates the fixed-point map u <- u - anderson_beta * r(u)
+  /// and mixes in the last `anderson_depth` iterates per batch row. It needs
+  /// one residual per unknown and evaluates only the residual graph, with no
+  /// Jacobian assembly or linear solve. That suits weakly coupled systems in
+  /// which r is close to u minus a contraction, such as a backward-Euler update
+  /// with a small step. The line-search settings and `jacobian_refresh` do not
+  /// apply. Convergence, `check_interval`, compaction and the result are the
+  /// same as for Newton.
+  std::string method = "NEWTON";
+  std::size_t anderson_depth = 5;
+  double anderson_beta = 1.0;
+  /// Sub-step schedule of a segment that substeps (`max_substepping_level` >
+  /// 0): "BISECT" (the default) or "ADAPTIVE". BISECT halves a failing span
+  /// and solves both halves of it, recursively, for the rows that failed it.
+  /// ADAPTIVE gives each row its own step instead: halved when a sub-step fails,
+  /// doubled again after `substep_grow_after` consecutive converged sub-steps.
+  /// All rows still short of the end of the increment advance together in one
+  /// solve per round. A row whose trouble is confined to part of the increment
+  /// then takes the rest of it in a few long steps. Both schedules stay on the
+  /// bisection grid and fail at the same depth cap.
+  std::string substep_method = "BISECT";
+  std::size_t substep_grow_after = 2;
+  /// Concurrent BISECT substepping on the CPU. The rows that fail a span are
+  /// independent of each other, so with `substep_workers` > 1 a failing subset
+  /// is split into up to that many sub-batches of at least `substep_split_rows`
+  /// rows, and each sub-batch's sub-steps are solved on one of the model's
+  /// persistent worker threads. This keeps the cores busy when a few stiff rows
+  /// bisect deep on their own. With an OpenMP build of torch each worker limits
+  /// its own team to an equal share of the caller's intra-op threads. That
+  /// needs Linux or another ELF platform; elsewhere an OpenMP torch ignores this
+  /// setting and solves on the calling thread. With torch's native thread pool the
+  /// workers share its threads. The process-wide setting is never changed. The
+  /// sub-batches share the compiled graphs, so `LoadOptions::runners` bounds how
+  /// many solve at once. The result matches the serial run up to round-off. A
+  /// sub-batch does not split again, and ADAPTIVE, which solves every remaining
+  /// row in one batch per round, is not split. 0 or 1 (the default) solves on
+  /// the calling thread.
+  std::size_t substep_workers = 0;
+  std::size_t substep_split_rows = 4;
+  /// When true, each call records per-segment solve statistics that
+  /// `Model::last_solve_stats` returns (see `SolveStats`). Unlike `collect_log`
+  /// it adds no host sync: the counters are host integers the solver already
+  /// keeps, plus one device-side per-row iteration counter. Off by default.
+  bool collect_stats = false;
+};
+
+/// The work one implicit segment did during a call. Counts are summed over
+/// every Newton solve of the segment in that call: one solve normally, one
+/// per attempted sub-step span when the segment substeps.
+struct SegmentStats
+{
+  /// The segment's unknowns, by the names `unknown_names()` reports.
+  std::vector<std::string> unknowns;
+  std::size_t solves = 0;
+  /// Newton (or Anderson) iterations, summed over the solves.
+  std::size_t iterations = 0;
+  /// Residual evaluations made by the line search.
+  std::size_t linesearch_trials = 0;
+  /// Operator applications of the Krylov linear solves (0 for a direct solve).
+  std::size_t matvecs = 0;
+  /// Krylov preconditioner setups.
+  std::size_t precond_rebuilds = 0;
+  /// Deepest sub-step bisection level reached (0 = the full step sufficed).
+  std::size_t substep_depth = 0;
+  /// Host wall time spent evaluating the residual and taking the Newton step
+  /// (assembly + linear solve). On a GPU this is mostly launch time, except
+  /// where a host sync falls inside.
+  double residual_seconds = 0.0;
+  double step_seconds = 0.0;
+  /// Iterations each batch element took before it converged, `(*B,)` int64 on
+  /// the model's device. Undefined when the segment was not solved (e.g. a
+  /// `jacobian` that reused the forward memo).
+  at::Tensor row_iterations;
+  /// Sub-step level each batch element needed, `(*B,)` int64 on the model's
+  /// device (0 = the full step sufficed). Under bisection it is the deepest
+  /// level the element reached. Under the adaptive schedule it is the level
+  /// the element finished the increment on, which is coarser again after
+  /// `substep_grow_after` converged sub-steps, so a hint relaxes once an
+  /// element stops failing. Undefined unless the segment substeps and was
+  /// solved. Handed back as the next call's `substep_hint`.
+  at::Tensor row_substep_depth;
+};
+
+/// Per-call solve statistics: one entry per implicit segment, in segment order.
+/// Empty for a purely explicit model or when `SolverConfig::collect_stats` is
+/// off.
+struct SolveStats
+{
+  std::vector<SegmentStats> segments;
+
+  /// Every segment's `row_substep_depth`, in segment order: the `substep_hint`
+  /// for the next call on the same batch.
+  std::vector<at::Tensor> substep_hint() const
+  {
+    std::vector<at::Tensor> hint;
+    for (const auto & s : segments)
+      hint.push_back(s.row_substep_depth);
+    return hint;
+  }
+};
+
+/// How `Model` builds its per-segment `.pt2` loaders at construction. The
+/// defaults build every graph up front, one after another. Large artifacts
+/// (many implicit segments, derivative graphs) can take seconds to start; the
+/// two switches below trade that against when the cost is paid.
+struct LoadOptions
+{
+  /// Build the loaders concurrently on a pool of `threads` workers (0 = the
+  /// hardware concurrency). Results are identical to a serial load.
+  bool parallel = false;
+  unsigned threads = 0;
+  /// Defer the derivative-only graphs -- parameter Jacobian / VJP and the
+  /// implicit-segment IFT / parameter-sensitivity graphs -- until their first
+  /// call. A load failure of a deferred graph then surfaces at that call.
+  bool lazy = false;
+  /// Share the compiled loaders with every other sharing Model in the process
+  /// that loads the same package files onto the same device, so N models over
+  /// one artifact cost one extraction + `dlopen` per graph. Each Model still
+  /// owns its own promoted parameters. Off by default: sharing models also
+  /// share each graph's `runners`, so concurrent calls into them (one model
+  /// per thread, or substep sub-batches) take turns unless `runners` is raised
+  /// to the number of concurrent callers across all sharers.
+  bool share = false;
+  /// Runners per graph: how many callers can execute one graph at the same
+  /// time. With the default of 1, threads calling into the same Model (or
+  /// models sharing its loaders) take turns on each graph; raise it to the
+  /// number of concurrent callers. Each runner holds its own copy of the
+  /// graph's constants.
+  std::size_t runners = 1;
 };
 
 /// A variable-pair Jacobian: `J[out_name][in_name]` is the unflattened block
@@ -124,6 +286,16 @@ using VariablePairJacobian = std::map<std::string, std::map<std::string, at::Ten
  * be a misleading no-op (graph stays put) or a contract-breaking half-move
  * (params shift, graph doesn't). To retarget, re-run `neml2-compile`.
  *
+ * Concurrent calls
+ * ----------------
+ * The const operations are re-entrant: several threads may call `forward` /
+ * `jvp` / `jacobian` on one Model at once, each with its own
+ * `param_overrides`, `initial_guess`, `substep_hint` and `Workspace`. Per-call
+ * state lives on the calling thread, never in the Model. Each graph admits
+ * `LoadOptions::runners` callers at a time and queues the rest. Mutating the
+ * model (`named_parameters()` writes, `set_solver_config`, `set_forward_memo`)
+ * while a call is in flight is still a race.
+ *
  * See `doc/content/model_compilation/aoti_packages.md` for the current
  * schema metadata spec (kept in sync with the loader via
  * `kSupportedSchemaVersion`).
@@ -144,9 +316,14 @@ public:
   /// The promoted-parameter `values` in the metadata are stored dtype-neutral
   /// (float64) and materialized here on `device`: floating parameters at `dtype`,
   /// an integer/bool parameter at its recorded dtype.
+  ///
+  /// `load` selects serial / parallel / lazy construction of the `.pt2`
+  /// loaders (see `LoadOptions`); the per-graph load time is reported on the
+  /// `model` log channel at debug level.
   explicit Model(const std::filesystem::path & artifact_root,
                  at::Device device = at::kCPU,
-                 at::ScalarType dtype = at::kDouble);
+                 at::ScalarType dtype = at::kDouble,
+                 const LoadOptions & load = {});
 
   /// Declared (not defaulted) here and defined out-of-line where `Impl` is a
   /// complete type, as the PImpl idiom requires.
@@ -169,6 +346,11 @@ public:
   const std::vector<std::vector<int64_t>> & input_base_shapes() const noexcept;
   const std::vector<std::vector<int64_t>> & output_base_shapes() const noexcept;
 
+  /// The implicit-segment unknowns, in segment order -- the names an
+  /// `initial_guess` may carry. Empty for a purely explicit model. An unknown
+  /// that is also an output is reported under its output name.
+  std::vector<std::string> unknown_names() const;
+
   /// Evaluate the model. `inputs` is keyed by the names returned by
   /// `input_names()` and shaped `(*B, *base_shape)`; missing keys throw and a
   /// non-canonical trailing shape is rejected. Returns one tensor per name in
@@ -180,28 +362,135 @@ public:
   /// sliced to the chunk's rows so the per-device stored params stay immutable
   /// (and concurrent workers never race). Each override is taken at the same
   /// `(*B, *param_base)` contract a stored parameter would be.
+  ///
+  /// `initial_guess` (default empty) is a Newton starting point for implicit
+  /// unknowns, keyed by unknown name and broadcastable to the unknown's
+  /// `(*B, *sub_batch, *base)` shape -- typically the previous increment's
+  /// converged solution or an extrapolation of it. A guessed unknown starts
+  /// there instead of at its predictor / incoming value. A NaN entry counts as
+  /// unguessed and keeps that value, so a guess can cover some rows only;
+  /// whether it holds any NaN is read back from the device once per call. A
+  /// segment whose unknowns are all guessed, with no NaN, does not run its
+  /// predictor at all. Naming anything but an implicit unknown throws, and so
+  /// does naming an unknown of a segment that substeps, since each of its
+  /// sub-steps starts from its own chained state.
+  ///
+  /// `substep_hint` (default empty) holds, per implicit segment in
+  /// `last_solve_stats().segments` order, the sub-step level each batch element
+  /// should start at: `(*B,)` integers, typically the previous increment's
+  /// `SegmentStats::row_substep_depth` (see `SolveStats::substep_hint`). A
+  /// hinted segment that substeps runs the per-row schedule of
+  /// `SolverConfig::substep_method` "ADAPTIVE", with each row's first step at
+  /// its hinted level, so an element that needed deep sub-steps last time skips
+  /// the doomed full-step attempt. Its steps grow back after converged
+  /// sub-steps. Levels are clamped to the segment's depth cap. An undefined
+  /// entry, or a segment past the end, is not hinted; a segment that does not
+  /// substep ignores its entry.
   std::map<std::string, at::Tensor>
   forward(const std::map<std::string, at::Tensor> & inputs,
-          const std::map<std::string, at::Tensor> & param_overrides = {}) const;
+          const std::map<std::string, at::Tensor> & param_overrides = {},
+          const std::map<std::string, at::Tensor> & initial_guess = {},
+          const std::vector<at::Tensor> & substep_hint = {}) const;
+
+  /// Evaluate the model into caller-owned, preallocated output tensors. Same
+  /// contract as `forward`, except the results are written in place into
+  /// `outputs` (keyed by `output_names()`) rather than returned in a fresh map.
+  /// Every output must be present, defined, and already shaped
+  /// `(*B, *out_base_shape)` on this model's device + dtype; anything else
+  /// throws. The tensor handles are only read, so a `const` map of views into a
+  /// host-owned buffer is fine. Intended for hosts that call the model at a
+  /// fixed batch in a hot loop and want to reuse their output storage.
+  void forward_into(const std::map<std::string, at::Tensor> & inputs,
+                    const std::map<std::string, at::Tensor> & outputs,
+                    const std::map<std::string, at::Tensor> & param_overrides = {},
+                    const std::map<std::string, at::Tensor> & initial_guess = {}) const;
+
+  /// A positional call handle returned by `bind`. `forward` takes the inputs as
+  /// a vector in the order the binding was created with and returns the outputs
+  /// in `output_names()` order -- no string keys on either side of the call.
+  /// Cheap to copy; it refers back to its Model, which must outlive it.
+  class AOTI_EXPORT Binding
+  {
+  public:
+    /// Positional `Model::forward`: `inputs[k]` is the tensor for
+    /// `input_names()[k]`, at the same `(*B, *base_shape)` contract. Throws on a
+    /// wrong input count. See `Model::forward` for `param_overrides` and
+    /// `initial_guess`.
+    std::vector<at::Tensor>
+    forward(const std::vector<at::Tensor> & inputs,
+            const std::map<std::string, at::Tensor> & param_overrides = {},
+            const std::map<std::string, at::Tensor> & initial_guess = {}) const;
+
+    /// The input order this binding was created with.
+    const std::vector<std::string> & input_names() const noexcept { return _names; }
+
+    /// The output order `forward` returns -- the model's `output_names()`.
+    const std::vector<std::string> & output_names() const noexcept;
+
+  private:
+    friend class Model;
+    Binding(const Model & model, std::vector<std::string> names, std::vector<std::size_t> perm);
+
+    const Model * _model;
+    std::vector<std::string> _names;
+    // `_perm[k]` is the master (graph-call) index of caller position `k`.
+    std::vector<std::size_t> _perm;
+  };
+
+  /// Resolve `input_names` (a permutation of `input_names()`) once and return a
+  /// positional handle for the hot loop. Name resolution, and the per-variable
+  /// routing between segments, happen here rather than on every call. Throws
+  /// if a name is unknown, repeated, or an input is left unbound.
+  Binding bind(const std::vector<std::string> & input_names) const;
 
   /// Evaluate + JVP. `tangents` shares its keys + `(*B, *in_base)` shapes with
   /// `inputs`; a missing key defaults to zero. Returns `{outputs, jvp_outputs}`
   /// -- both maps keyed by `output_names()`; `jvp_outputs[name]` is the
   /// directional derivative at the output's natural `(*B, *out_base_shape)`.
-  /// See `forward` for `param_overrides`.
+  /// See `forward` for `param_overrides` and `initial_guess`.
   std::pair<std::map<std::string, at::Tensor>, std::map<std::string, at::Tensor>>
   jvp(const std::map<std::string, at::Tensor> & inputs,
       const std::map<std::string, at::Tensor> & tangents,
-      const std::map<std::string, at::Tensor> & param_overrides = {}) const;
+      const std::map<std::string, at::Tensor> & param_overrides = {},
+      const std::map<std::string, at::Tensor> & initial_guess = {}) const;
+
+  /// Evaluate + JVP along K directions at once. Each tangent is
+  /// `(*B, K, *in_base)` -- one direction per slice of the K axis, the same K
+  /// for every tangent -- and `jvp_outputs[name]` is `(*B, K, *out_base)`. The
+  /// model is solved and its Jacobian carrier composed once, then contracted
+  /// with all K directions, so this costs far less than K `jvp` calls. A
+  /// missing tangent is zero in every direction.
+  std::pair<std::map<std::string, at::Tensor>, std::map<std::string, at::Tensor>>
+  jvp_multi(const std::map<std::string, at::Tensor> & inputs,
+            const std::map<std::string, at::Tensor> & tangents,
+            const std::map<std::string, at::Tensor> & param_overrides = {},
+            const std::map<std::string, at::Tensor> & initial_guess = {}) const;
 
   /// Evaluate + full Jacobian as unflattened variable-pair blocks. Returns
   /// `{outputs, J}` where `J[out_name][in_name]` is `(*B, *out_base, *in_base)`
   /// (see @ref VariablePairJacobian). Composed across forward segments and
   /// threaded through IFT blocks for implicit segments. See `forward` for
-  /// `param_overrides`.
+  /// `param_overrides`, `initial_guess` and `substep_hint`.
   std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
   jacobian(const std::map<std::string, at::Tensor> & inputs,
-           const std::map<std::string, at::Tensor> & param_overrides = {}) const;
+           const std::map<std::string, at::Tensor> & param_overrides = {},
+           const std::map<std::string, at::Tensor> & initial_guess = {},
+           const std::vector<at::Tensor> & substep_hint = {}) const;
+
+  /// Evaluate + the Jacobian blocks `J[out][in]` for `in` in `wrt_inputs` and
+  /// `out` in `of_outputs` only (an empty list selects every compiled name on
+  /// that side). The composed carrier is sized to the selected inputs, and
+  /// segments that lie on no selected path are evaluated without their Jacobian
+  /// graphs, so a host that needs d(stress)/d(strain) out of a model with many
+  /// history inputs pays for that block alone. Naming a pair side that was not
+  /// compiled (`neml2-compile -d`) throws.
+  std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
+  jacobian(const std::map<std::string, at::Tensor> & inputs,
+           const std::vector<std::string> & wrt_inputs,
+           const std::vector<std::string> & of_outputs,
+           const std::map<std::string, at::Tensor> & param_overrides = {},
+           const std::map<std::string, at::Tensor> & initial_guess = {},
+           const std::vector<at::Tensor> & substep_hint = {}) const;
 
   /// Evaluate + parameter Jacobian. Returns `{outputs, P}` where
   /// `P[out_name][param_qname]` is the dense block `(*B, *out_base, *param_base)`
@@ -226,6 +515,68 @@ public:
             const std::map<std::string, at::Tensor> & cotangents,
             const std::map<std::string, at::Tensor> & param_overrides = {}) const;
 
+  /// Opt-in per-caller cache of batch-shaped intermediates, for hosts that
+  /// call the model at a constant batch shape. Pass one to the workspace
+  /// overloads below: buffers are built on the first call at a given shape and
+  /// handed back on every later call at that shape. Seeds that depend only on
+  /// the shape (the Jacobian carrier's identity seed, zero initial guesses for
+  /// implicit unknowns and predictor feedback) are reused as-is; scratch
+  /// buffers (the packed given / unknown vectors of each implicit solve, the
+  /// Newton trial iterates, the Jacobian carriers) are overwritten. Returned
+  /// unknowns and Jacobian blocks are copied out of the scratch, so they stay
+  /// valid across later calls. Graph outputs are still allocated per call, and
+  /// substepped segments run without the workspace. Results are
+  /// identical to the plain overloads, with one exception: a Krylov solve with
+  /// a recycle space (the `recycle` field of the `krylov` metadata block) also
+  /// keeps that space here, so the next call at the same shape starts its GMRES
+  /// solves from it. Those results agree with the plain overloads to within the
+  /// solver tolerances, not bit for bit.
+  ///
+  /// A workspace is not thread-safe; concurrent callers each hold their own.
+  /// It may be shared across Models (entries are keyed by model).
+  class AOTI_EXPORT Workspace
+  {
+  public:
+    Workspace();
+    ~Workspace();
+    Workspace(Workspace &&) noexcept;
+    Workspace & operator=(Workspace &&) noexcept;
+    Workspace(const Workspace &) = delete;
+    Workspace & operator=(const Workspace &) = delete;
+
+    /// Buffer requests served from the cache / built fresh (and then cached).
+    std::size_t hits() const noexcept;
+    std::size_t misses() const noexcept;
+
+    /// Drop every cached buffer and reset the counters.
+    void clear() noexcept;
+
+  private:
+    friend class Model;
+    struct AOTI_NO_EXPORT Impl;
+    std::unique_ptr<Impl> _impl;
+  };
+
+  /// Workspace overloads of `forward`, `jvp`, `jacobian` and `param_jacobian`.
+  /// Same contract and results; call-invariant intermediates come from `ws`.
+  std::map<std::string, at::Tensor>
+  forward(const std::map<std::string, at::Tensor> & inputs,
+          Workspace & ws,
+          const std::map<std::string, at::Tensor> & param_overrides = {}) const;
+  std::pair<std::map<std::string, at::Tensor>, std::map<std::string, at::Tensor>>
+  jvp(const std::map<std::string, at::Tensor> & inputs,
+      const std::map<std::string, at::Tensor> & tangents,
+      Workspace & ws,
+      const std::map<std::string, at::Tensor> & param_overrides = {}) const;
+  std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
+  jacobian(const std::map<std::string, at::Tensor> & inputs,
+           Workspace & ws,
+           const std::map<std::string, at::Tensor> & param_overrides = {}) const;
+  std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
+  param_jacobian(const std::map<std::string, at::Tensor> & inputs,
+                 Workspace & ws,
+                 const std::map<std::string, at::Tensor> & param_overrides = {}) const;
+
   /// Mutable surface for the runtime-flexible parameters (the set promoted
   /// via `neml2-compile --parameter NAME`). Baked entries do not appear here.
   /// Empty when the model was compiled with no promotions.
@@ -234,6 +585,8 @@ public:
   /// is reflected on the next `forward`/`jvp`/`jacobian` call. Replacing the
   /// tensor via assignment is allowed too -- the entry's dtype and shape
   /// must match the compile-time contract, or the next forward will throw.
+  /// The set of entries is fixed at load, when each call's plan binds to
+  /// them: inserting or erasing entries is not supported.
   std::map<std::string, at::Tensor> & named_parameters() noexcept;
   const std::map<std::string, at::Tensor> & named_parameters() const noexcept;
 
@@ -261,6 +614,31 @@ public:
   /// If never called (and the metadata carries no solver config), sensible
   /// defaults apply (see `SolverConfig`).
   void set_solver_config(const SolverConfig & config);
+  /// The Newton configuration in effect, to adjust one field and set it back.
+  const SolverConfig & solver_config() const noexcept;
+
+  /// Keep the converged implicit-segment state of the last `forward` call (off
+  /// by default). A following `jacobian`, `jvp` or `param_jacobian` on the same
+  /// inputs then skips the Newton solves and goes straight to the implicit
+  /// function theorem. A typical host evaluates the residual and then the
+  /// tangent at one state, so this halves the nonlinear solves per global
+  /// iteration.
+  ///
+  /// "Same inputs" means the same tensor objects at the same version counters
+  /// and shapes, with the same promoted parameters (stored or overridden). Any
+  /// in-place edit made through torch misses the memo. Writes that bypass
+  /// torch, such as a host filling a `from_blob` buffer through its own
+  /// pointer, are invisible to it: turn the memo off (or on again, which clears
+  /// it) after such a write. The memo holds the last call's inputs and solved
+  /// unknowns alive. Changing the solver configuration also clears it.
+  void set_forward_memo(bool enable);
+
+  /// Solve statistics of the calling thread's most recent `forward` / `jvp` /
+  /// `jacobian` / `param_*` call on this model, recorded while
+  /// `SolverConfig::collect_stats` is set. A call that threw reports the
+  /// segments it solved before the failure. Each thread sees its own calls, so
+  /// concurrent callers do not mix their statistics.
+  SolveStats last_solve_stats() const;
 
 private:
   // Opaque implementation. Defined in the internal (non-shipped) internal.h
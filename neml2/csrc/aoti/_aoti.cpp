@@ -31,6 +31,7 @@
 #include <cstddef>
 #include <filesystem>
 #include <map>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -50,6 +51,27 @@
 namespace py = pybind11;
 using neml2::aoti::Model;
 
+// `Model::jvp` / `jacobian` / `param_jacobian` are overloaded with a
+// C++-only `Workspace` variant; bind the plain map overloads.
+using TensorMap = std::map<std::string, at::Tensor>;
+
+namespace
+{
+// A Python ``substep_hint`` list, where ``None`` leaves a segment unhinted (an
+// undefined tensor on the C++ side).
+using HintList = std::vector<std::optional<at::Tensor>>;
+
+std::vector<at::Tensor>
+to_substep_hint(const HintList & hint)
+{
+  std::vector<at::Tensor> out;
+  out.reserve(hint.size());
+  for (const auto & h : hint)
+    out.push_back(h.value_or(at::Tensor()));
+  return out;
+}
+} // namespace
+
 PYBIND11_MODULE(_aoti, m)
 {
   m.doc() = "Pybind11 binding for neml2::aoti::Model. The bare C++ runtime "
@@ -195,6 +217,9 @@ Everything else is baked into the graph as a constant.
       .def_property_readonly("output_base_shapes",
                              &Model::output_base_shapes,
                              "Per-output base shape (Scalar -> [], SR2 -> [6], R2 -> [3, 3]).")
+      .def_property_readonly("unknown_names",
+                             &Model::unknown_names,
+                             "Implicit-segment unknowns -- the keys ``initial_guess`` accepts.")
       .def_property_readonly(
           "parameter_base_shapes",
           &Model::parameter_base_shapes,
@@ -215,13 +240,16 @@ Everything else is baked into the graph as a constant.
           "forward",
           [](const Model & m,
              const std::map<std::string, at::Tensor> & inputs,
-             const std::map<std::string, at::Tensor> & param_overrides)
+             const std::map<std::string, at::Tensor> & param_overrides,
+             const std::map<std::string, at::Tensor> & initial_guess,
+             const HintList & substep_hint)
           {
             // ``Model::forward`` returns ``std::map`` which is sorted by key;
             // re-pack into a Python dict in ``output_names`` declaration
             // order so the caller can rely on ``list(outs.keys()) ==
             // model.output_names()`` for tuple-style consumers.
-            auto out_map = m.forward(inputs, param_overrides);
+            auto out_map =
+                m.forward(inputs, param_overrides, initial_guess, to_substep_hint(substep_hint));
             py::dict result;
             for (const auto & name : m.output_names())
               result[name.c_str()] = out_map.at(name);
@@ -229,6 +257,8 @@ Everything else is baked into the graph as a constant.
           },
           py::arg("inputs"),
           py::arg("param_overrides") = std::map<std::string, at::Tensor>{},
+          py::arg("initial_guess") = std::map<std::string, at::Tensor>{},
+          py::arg("substep_hint") = HintList{},
           R"(
 Evaluate the model.
 
@@ -237,12 +267,23 @@ keys raise an error. Returns one tensor per name in ``output_names``,
 preserving declaration order. ``param_overrides`` (default empty) replaces a
 promoted parameter's value for this call only, without mutating
 ``named_parameters()`` -- a hook for multi-device dispatch.
+``initial_guess`` (default empty) is a Newton starting point per implicit
+unknown, used in place of the predictor (e.g. the previous step's solution).
+NaN entries are left to the predictor; an unknown of a substepping segment
+cannot be guessed.
+``substep_hint`` (default empty) is, per implicit segment, the sub-step level
+each batch element starts at -- typically the ``row_substep_depth`` entries of
+the previous call's ``last_solve_stats()``; ``None`` leaves a segment unhinted.
 )")
       .def("jvp",
-           &Model::jvp,
+           py::overload_cast<const TensorMap &,
+                             const TensorMap &,
+                             const TensorMap &,
+                             const TensorMap &>(&Model::jvp, py::const_),
            py::arg("inputs"),
            py::arg("tangents"),
            py::arg("param_overrides") = std::map<std::string, at::Tensor>{},
+           py::arg("initial_guess") = std::map<std::string, at::Tensor>{},
            R"(
 Evaluate + JVP.
 
@@ -252,11 +293,35 @@ Evaluate + JVP.
 ``output_names``; ``jvp_outputs[name]`` is the directional derivative at the
 output's natural ``(*B, *out_base_shape)``.
 )")
-      .def("jacobian",
-           &Model::jacobian,
+      .def("jvp_multi",
+           &Model::jvp_multi,
            py::arg("inputs"),
+           py::arg("tangents"),
            py::arg("param_overrides") = std::map<std::string, at::Tensor>{},
+           py::arg("initial_guess") = std::map<std::string, at::Tensor>{},
            R"(
+Evaluate + JVP along K directions in one pass.
+
+Each tangent is ``(*B, K, *base_shape)`` with the same K for every input; a
+missing tangent key is zero in every direction. ``jvp_outputs[name]`` is
+``(*B, K, *out_base_shape)``. The model is solved once for all K directions.
+)")
+      .def(
+          "jacobian",
+          [](const Model & m,
+             const TensorMap & inputs,
+             const TensorMap & param_overrides,
+             const TensorMap & initial_guess,
+             const HintList & substep_hint)
+          {
+            return m.jacobian(
+                inputs, param_overrides, initial_guess, to_substep_hint(substep_hint));
+          },
+          py::arg("inputs"),
+          py::arg("param_overrides") = std::map<std::string, at::Tensor>{},
+          py::arg("initial_guess") = std::map<std::string, at::Tensor>{},
+          py::arg("substep_hint") = HintList{},
+          R"(
 Evaluate + full Jacobian as unflattened variable-pair blocks.
 
 Returns a 2-tuple ``(outputs, J)`` where ``J`` is a nested
@@ -264,9 +329,39 @@ Returns a 2-tuple ``(outputs, J)`` where ``J`` is a nested
 ``(*B, *out_base_shape, *in_base_shape)`` (e.g. SR2->SR2 -> (*B, 6, 6);
 Scalar->SR2 -> (*B, 6)) over the **structural** inputs (promoted-parameter
 inputs are not exposed in J).
+)")
+      .def(
+          "jacobian",
+          [](const Model & m,
+             const TensorMap & inputs,
+             const std::vector<std::string> & wrt_inputs,
+             const std::vector<std::string> & of_outputs,
+             const TensorMap & param_overrides,
+             const TensorMap & initial_guess,
+             const HintList & substep_hint)
+          {
+            return m.jacobian(inputs,
+                              wrt_inputs,
+                              of_outputs,
+                              param_overrides,
+                              initial_guess,
+                              to_substep_hint(substep_hint));
+          },
+          py::arg("inputs"),
+          py::arg("wrt_inputs"),
+          py::arg("of_outputs"),
+          py::arg("param_overrides") = std::map<std::string, at::Tensor>{},
+          py::arg("initial_guess") = std::map<std::string, at::Tensor>{},
+          py::arg("substep_hint") = HintList{},
+          R"(
+Evaluate + the Jacobian blocks ``J[out][in]`` for ``in`` in ``wrt_inputs`` and
+``out`` in ``of_outputs`` only (an empty list selects that whole side). The
+composed carrier is sized to the selected inputs, so this is cheaper than
+slicing the full ``jacobian`` when few blocks are needed.
 )")
       .def("param_jacobian",
-           &Model::param_jacobian,
+           py::overload_cast<const TensorMap &, const TensorMap &>(&Model::param_jacobian,
+                                                                   py::const_),
            py::arg("inputs"),
            py::arg("param_overrides") = std::map<std::string, at::Tensor>{},
            R"(
@@ -326,7 +421,18 @@ Empty when the model was compiled with no ``--parameter`` flags.
              std::size_t ls_max_iters,
              double ls_cutback,
              double ls_c,
-             double substep_del_tol)
+             double substep_del_tol,
+             std::size_t check_interval,
+             double compact_fraction,
+             std::size_t jacobian_refresh,
+             const std::string & method,
+             std::size_t anderson_depth,
+             double anderson_beta,
+             bool collect_stats,
+             const std::string & substep_method,
+             std::size_t substep_grow_after,
+             std::size_t substep_workers,
+             std::size_t substep_split_rows)
           {
             neml2::aoti::SolverConfig cfg;
             cfg.atol = atol;
@@ -337,6 +443,17 @@ Empty when the model was compiled with no ``--parameter`` flags.
             cfg.ls_cutback = ls_cutback;
             cfg.ls_c = ls_c;
             cfg.substep_del_tol = substep_del_tol;
+            cfg.check_interval = check_interval;
+            cfg.compact_fraction = compact_fraction;
+            cfg.jacobian_refresh = jacobian_refresh;
+            cfg.method = method;
+            cfg.anderson_depth = anderson_depth;
+            cfg.anderson_beta = anderson_beta;
+            cfg.collect_stats = collect_stats;
+            cfg.substep_method = substep_method;
+            cfg.substep_grow_after = substep_grow_after;
+            cfg.substep_workers = substep_workers;
+            cfg.substep_split_rows = substep_split_rows;
             self.set_solver_config(cfg);
           },
           py::arg("atol"),
@@ -347,8 +464,62 @@ Empty when the model was compiled with no ``--parameter`` flags.
           py::arg("ls_cutback"),
           py::arg("ls_c"),
           py::arg("substep_del_tol") = 1.0e-6,
+          py::arg("check_interval") = 1,
+          py::arg("compact_fraction") = 0.0,
+          py::arg("jacobian_refresh") = 1,
+          py::arg("method") = "NEWTON",
+          py::arg("anderson_depth") = 5,
+          py::arg("anderson_beta") = 1.0,
+          py::arg("collect_stats") = false,
+          py::arg("substep_method") = "BISECT",
+          py::arg("substep_grow_after") = 2,
+          py::arg("substep_workers") = 0,
+          py::arg("substep_split_rows") = 4,
           "Configure the implicit-segment Newton solve (override the values "
-          "read from metadata.json at load time).");
+          "read from metadata.json at load time).")
+      .def(
+          "last_solve_stats",
+          [](const Model & self)
+          {
+            py::list out;
+            for (const auto & s : self.last_solve_stats().segments)
+            {
+              py::dict d;
+              d["unknowns"] = s.unknowns;
+              d["solves"] = s.solves;
+              d["iterations"] = s.iterations;
+              d["linesearch_trials"] = s.linesearch_trials;
+              d["matvecs"] = s.matvecs;
+              d["precond_rebuilds"] = s.precond_rebuilds;
+              d["substep_depth"] = s.substep_depth;
+              d["residual_seconds"] = s.residual_seconds;
+              d["step_seconds"] = s.step_seconds;
+              d["row_iterations"] = s.row_iterations.defined() ? py::cast(s.row_iterations)
+                                                               : py::none();
+              d["row_substep_depth"] = s.row_substep_depth.defined()
+                                           ? py::cast(s.row_substep_depth)
+                                           : py::none();
+              out.append(d);
+            }
+            return out;
+          },
+          R"(
+Solve statistics of this thread's last call, one dict per implicit segment.
+
+Recorded only with ``set_solver_config(..., collect_stats=True)``. Each dict
+holds the segment's ``unknowns``, the ``solves``, ``iterations``,
+``linesearch_trials``, ``matvecs`` and ``precond_rebuilds`` counts, the deepest
+``substep_depth``, the host ``residual_seconds`` / ``step_seconds``, the
+per-element ``row_iterations`` tensor (``None`` when the segment was not solved)
+and the per-element ``row_substep_depth`` (``None`` unless the segment substeps),
+which the next call takes back as its ``substep_hint``.
+)")
+      .def("set_forward_memo",
+           &Model::set_forward_memo,
+           py::arg("enable"),
+           "Keep the converged implicit state of the last ``forward`` so a "
+           "``jacobian`` / ``jvp`` / ``param_jacobian`` on the same input tensors "
+           "skips the Newton re-solve. Any call clears the current memo.");
 
   // Eager-path entry point: the same C++ Newton solver the AOTI runtime uses,
   // driven over Python-supplied residual/step callables (RHS / (Jacobian -> LinearSolve)).
@@ -495,7 +666,11 @@ the best-effort iterate, a per-dynamic-batch-element boolean convergence mask
          double abs_tol,
          double rel_tol,
          const std::string & cache_strategy,
-         int64_t cache_max_its)
+         int64_t cache_max_its,
+         const std::string & forcing,
+         double forcing_max,
+         int64_t recycle,
+         double compact_fraction)
       {
         neml2::aoti::SolverConfig ncfg;
         ncfg.atol = atol;
@@ -522,6 +697,13 @@ the best-effort iterate, a per-dynamic-batch-element boolean convergence mask
         kcfg.abs_tol = abs_tol;
         kcfg.rel_tol = rel_tol;
         kcfg.cache_max_its = cache_max_its;
+        neml2::aoti::_assert(neml2::aoti::parse_forcing_term(forcing, kcfg.forcing),
+                             "krylov_solve_eager: unknown forcing '",
+                             forcing,
+                             "' (expected fixed | ew1 | ew2)");
+        kcfg.forcing_max = forcing_max;
+        kcfg.recycle = recycle;
+        kcfg.compact_fraction = compact_fraction;
 
         return neml2::aoti::run_eager_krylov(ncfg,
                                              kcfg,
@@ -556,6 +738,10 @@ the best-effort iterate, a per-dynamic-batch-element boolean convergence mask
       py::arg("rel_tol") = 1.0e-4,
       py::arg("cache_strategy") = "none",
       py::arg("cache_max_its") = 10,
+      py::arg("forcing") = "fixed",
+      py::arg("forcing_max") = 0.9,
+      py::arg("recycle") = 0,
+      py::arg("compact_fraction") = 0.0,
       R"(
 Run the shared C++ Newton solver over an eager system whose inner linear solve is
 a matrix-free Krylov iteration (GMRES / BiCGStab) rather than a direct solve.
@@ -564,6 +750,8 @@ a matrix-free Krylov iteration (GMRES / BiCGStab) rather than a direct solve.
 matrix-free ``J.v`` (the eager ``RHS`` / ``Matvec`` modules). ``precond_setup_fn(u)
 -> state`` and ``precond_apply_fn(state, r_flat) -> z_flat`` are the authored
 preconditioner's setup/apply modules (pass ``None`` for both when unpreconditioned).
+``compact_fraction`` is accepted for parity with the compiled route but has no
+effect: the eager callbacks cannot be restricted to a subset of rows.
 Returns ``(u_solved, converged, iterations, log)``.
 )");
 
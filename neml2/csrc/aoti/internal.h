@@ -30,12 +30,19 @@
 // to implement `Impl`'s members; nothing outside the aoti library ever sees it.
 // Everything here is compiled with hidden visibility (see CMakeLists.txt).
 
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <filesystem>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <queue>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -45,6 +52,7 @@
 // regression we hit when aoti stopped inheriting the legacy misc/tensor
 // PCH that used to drag the full umbrella in.
 #include <ATen/ATen.h>
+#include <c10/util/SmallVector.h>
 
 #include "neml2/csrc/aoti/Model.h"
 #include "neml2/csrc/aoti/assertions.h"
@@ -71,6 +79,8 @@ bool capture_solve_failure_enabled();
 // backends (AOTINonlinearSystem / KrylovAOTINonlinearSystem) are built by
 // `_make_implicit_system`. Defined in nonlinear_system.h.
 class NonlinearSystem;
+// A Newton solve's outcome (defined in newton.h), read by `_record_solve`.
+struct NewtonResult;
 
 /// Lazily register NEML2's custom Torch operators (currently `neml2::opaque_pow`)
 /// into the dispatcher -- once per process, only if absent. Called from the aoti
@@ -79,17 +89,129 @@ class NonlinearSystem;
 /// op (the Python package registers the same schema). Defined in `custom_ops.cpp`.
 void ensure_neml2_custom_ops_registered();
 
+/// Handle to one compiled `.pt2` graph of a segment. Constructed unbuilt (it
+/// records the package path); the AOTI loader itself is created by `load()`,
+/// which the Model constructor calls for every non-deferred graph and which
+/// otherwise runs on first use. A default-constructed handle means "this graph
+/// was not compiled" and tests false. Copies share the one underlying loader.
+class SegmentLoader
+{
+public:
+  SegmentLoader() = default;
+  SegmentLoader(std::filesystem::path path,
+                int device_index,
+                std::string label,
+                std::size_t runners = 1);
+
+  /// A handle drawn from the process-wide loader cache: every Model that loads
+  /// the same package file (same canonical path, size and modification time)
+  /// onto the same device index shares one loader, built once. An entry lives
+  /// as long as some Model still holds it. The compiled graphs are immutable;
+  /// promoted parameters are passed per call, so sharing is transparent. The
+  /// runner count is part of the key.
+  static SegmentLoader shared(const std::filesystem::path & path,
+                              int device_index,
+                              std::string label,
+                              std::size_t runners = 1);
+
+  /// Whether the loader has been built (by this or any sharing handle).
+  bool built() const noexcept { return _state && _state->built.load(); }
+
+  /// Whether the graph exists in the artifact (built or not).
+  explicit operator bool() const noexcept { return static_cast<bool>(_state); }
+
+  /// The loader, built now if it has not been yet. Thread-safe; a failed
+  /// build throws and is retried on the next access.
+  torch::inductor::AOTIModelPackageLoader & load() const;
+
+  torch::inductor::AOTIModelPackageLoader & operator*() const { return load(); }
+  torch::inductor::AOTIModelPackageLoader * operator->() const { return &load(); }
+  /// Like `operator->`, but null for an absent graph instead of throwing.
+  torch::inductor::AOTIModelPackageLoader * get() const { return _state ? &load() : nullptr; }
+
+private:
+  struct State
+  {
+    std::filesystem::path path;
+    int device_index = -1;
+    std::string label;
+    std::size_t runners = 1;
+    std::once_flag once;
+    std::atomic<bool> built{false};
+    std::unique_ptr<torch::inductor::AOTIModelPackageLoader> loader;
+  };
+  std::shared_ptr<State> _state;
+};
+
+/// Backing store of `Model::Workspace`: cached buffers keyed by (owning model,
+/// purpose tag, segment, per-tag index, shape hash), plus the hit / miss
+/// counters. The key is plain integers so a lookup that hits allocates nothing;
+/// each entry keeps the shape it was requested at, which settles a hash
+/// collision.
+struct Model::Workspace::Impl
+{
+  /// What a buffer holds. The seeds are read-only; the rest are per-call scratch
+  /// the call overwrites (see `Model::Impl::_ws_buffer`).
+  enum class Tag : std::uint8_t
+  {
+    U0,
+    DStateSeed,
+    DPStateSeed,
+    FeedbackSeed,
+    KrylovRecycle,
+    GivenPack,
+    UnknownPack,
+    Trial,
+    Carrier
+  };
+
+  struct Key
+  {
+    const void * owner;
+    Tag tag;
+    std::size_t seg;
+    std::size_t idx;
+    std::size_t shape;
+    bool operator==(const Key & o) const noexcept
+    {
+      return owner == o.owner && tag == o.tag && seg == o.seg && idx == o.idx && shape == o.shape;
+    }
+  };
+
+  struct KeyHash
+  {
+    std::size_t operator()(const Key & k) const noexcept;
+  };
+
+  /// Hash of a shape, for `Key::shape`.
+  static std::size_t hash_shape(at::IntArrayRef shape) noexcept;
+
+  struct Entry
+  {
+    c10::SmallVector<int64_t, 6> shape;
+    at::Tensor t;
+  };
+
+  std::unordered_map<Key, Entry, KeyHash> buffers;
+  std::size_t hits = 0;
+  std::size_t misses = 0;
+};
+
 /// Opaque implementation of `Model`. Holds the per-segment AOTI graph state and
 /// all the value / Jacobian machinery; the public `Model` methods are one-line
 /// forwarders onto the identically-named members here.
 struct Model::Impl
 {
+  /// Purpose tag of a `Model::Workspace` buffer (`_ws_slot`, `_ws_buffer`).
+  using WsTag = Workspace::Impl::Tag;
+
   /// See `Model::Model`. Parses `<artifact_root>/metadata.json`, loads every
   /// `.pt2` segment from the `<device>/<dtype>/` leaf, and materialises the
   /// promoted-parameter surface on `device` (floating params at `dtype`).
   explicit Impl(const std::filesystem::path & artifact_root,
                 at::Device device,
-                at::ScalarType dtype);
+                at::ScalarType dtype,
+                const LoadOptions & load);
 
   // --- Public ops (forwarded from Model) -----------------------------------
   //
@@ -99,16 +221,43 @@ struct Model::Impl
   // its batched parameters sliced to the chunk's rows: the per-device Model's
   // stored params stay immutable, so concurrent workers never race. Empty
   // overrides => the stored parameters are used (the direct, single-call case).
+  //
+  // `initial_guess` (default empty) is the caller's per-unknown Newton starting
+  // point; see `Model::forward` and `_apply_initial_guess`.
   std::map<std::string, at::Tensor>
   forward(const std::map<std::string, at::Tensor> & inputs,
-          const std::map<std::string, at::Tensor> & param_overrides = {}) const;
+          const std::map<std::string, at::Tensor> & param_overrides = {},
+          const std::map<std::string, at::Tensor> & initial_guess = {}) const;
+  void forward_into(const std::map<std::string, at::Tensor> & inputs,
+                    const std::map<std::string, at::Tensor> & outputs,
+                    const std::map<std::string, at::Tensor> & param_overrides = {},
+                    const std::map<std::string, at::Tensor> & initial_guess = {}) const;
   std::pair<std::map<std::string, at::Tensor>, std::map<std::string, at::Tensor>>
   jvp(const std::map<std::string, at::Tensor> & inputs,
       const std::map<std::string, at::Tensor> & tangents,
-      const std::map<std::string, at::Tensor> & param_overrides = {}) const;
+      const std::map<std::string, at::Tensor> & param_overrides = {},
+      const std::map<std::string, at::Tensor> & initial_guess = {}) const;
+  /// K-direction JVP: tangents at `(*B, K, *in_base)`, results at
+  /// `(*B, K, *out_base)`, from one carrier composition.
+  std::pair<std::map<std::string, at::Tensor>, std::map<std::string, at::Tensor>>
+  jvp_multi(const std::map<std::string, at::Tensor> & inputs,
+            const std::map<std::string, at::Tensor> & tangents,
+            const std::map<std::string, at::Tensor> & param_overrides = {},
+            const std::map<std::string, at::Tensor> & initial_guess = {}) const;
   std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
   jacobian(const std::map<std::string, at::Tensor> & inputs,
-           const std::map<std::string, at::Tensor> & param_overrides = {}) const;
+           const std::map<std::string, at::Tensor> & param_overrides = {},
+           const std::map<std::string, at::Tensor> & initial_guess = {}) const;
+  /// Subset Jacobian: only the compiled pairs with `in` in `wrt_inputs` and
+  /// `out` in `of_outputs` (ORIGINAL names; an empty list selects that whole
+  /// side). The carrier is narrowed to the `wrt_inputs` columns and segments
+  /// off every selected path run value-only.
+  std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
+  jacobian(const std::map<std::string, at::Tensor> & inputs,
+           const std::vector<std::string> & wrt_inputs,
+           const std::vector<std::string> & of_outputs,
+           const std::map<std::string, at::Tensor> & param_overrides = {},
+           const std::map<std::string, at::Tensor> & initial_guess = {}) const;
   /// Evaluate + parameter Jacobian. `P[out][param]` is
   /// `(*B, *out_base, *param_base)` (reverse-mode AD over promoted parameters).
   std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
@@ -162,9 +311,10 @@ struct Model::Impl
 
   /// The boundary (renamed) name for an ORIGINAL promoted-parameter name --
   /// identity when the parameter is unaliased. `_named_parameters` and the
-  /// per-call `_param_overrides` are stored/keyed by boundary name, so every
-  /// internal read (all through `_resolve_param`, plus the ctor's existence
-  /// check) maps its original segment/metadata name through this first.
+  /// per-call parameter overrides are stored/keyed by boundary name, so every
+  /// internal read (the plan's parameter binding, the name-keyed
+  /// `_resolve_param`, the ctor's existence check) maps its original
+  /// segment/metadata name through this first.
   const std::string & _param_boundary_name(const std::string & orig) const noexcept
   {
     auto it = _param_orig2ext.find(orig);
@@ -177,8 +327,12 @@ struct Model::Impl
   /// value if one was supplied for `name`, else the stored `_named_parameters`
   /// entry. The single point every value/derivative graph reads a promoted
   /// parameter through, so a dispatcher-supplied per-chunk slice transparently
-  /// replaces the stored value without mutating it. Throws if `name` is neither.
+  /// replaces the stored value without mutating it. Throws if `name` is not a
+  /// promoted parameter.
   const at::Tensor & _resolve_param(const std::string & name) const;
+  /// `_resolve_param` by plan parameter index (`CallPlan::params`), without a
+  /// name lookup.
+  const at::Tensor & _resolve_param(std::size_t p) const;
 
   enum class SegmentKind
   {
@@ -199,8 +353,8 @@ struct Model::Impl
     int max_substepping_level = 0;
 
     // Forward-segment-only.
-    std::unique_ptr<torch::inductor::AOTIModelPackageLoader> fwd_loader;
-    std::unique_ptr<torch::inductor::AOTIModelPackageLoader> jvp_loader;
+    SegmentLoader fwd_loader;
+    SegmentLoader jvp_loader;
     std::vector<std::string> fwd_inputs;
     std::vector<std::string> fwd_outputs;
 
@@ -217,26 +371,32 @@ struct Model::Impl
     // `jacobian_loader` only when a preconditioner or an input derivative needs
     // the assembled A. Each loader is therefore constructed iff its package key is
     // present in the segment metadata.
-    std::unique_ptr<torch::inductor::AOTIModelPackageLoader> residual_loader;
-    std::unique_ptr<torch::inductor::AOTIModelPackageLoader> jacobian_loader;
-    std::unique_ptr<torch::inductor::AOTIModelPackageLoader> solve_loader;
+    SegmentLoader residual_loader;
+    SegmentLoader jacobian_loader;
+    SegmentLoader solve_loader;
+    /// The solve split in two, for Jacobian reuse (`jacobian_refresh`):
+    /// `factor_loader`: (A_block) -> (LU, pivots); `solve_factored_loader`:
+    /// (LU, pivots, b_group) -> (du_group). Emitted only for a direct DenseLU
+    /// solve over a single residual x unknown group; both null otherwise.
+    SegmentLoader factor_loader;
+    SegmentLoader solve_factored_loader;
     /// Matrix-free residual jvp J.v = ∂r/∂u . v (Krylov solvers only; null for a
     /// direct solve). `KrylovAOTINonlinearSystem::step()` drives it per inner
     /// Krylov iteration in place of chaining jacobian -> solve.
-    std::unique_ptr<torch::inductor::AOTIModelPackageLoader> matvec_loader;
+    SegmentLoader matvec_loader;
     /// Authored preconditioner graphs (Krylov + a preconditioner only; both null
     /// for no preconditioner). `precond_setup_loader`: (*u,*g,*p) -> (*state);
     /// `precond_apply_loader`: (*state, r_flat) -> z_flat. The C++ holds the state
     /// between setup and applies, rebuilding per the cache strategy.
-    std::unique_ptr<torch::inductor::AOTIModelPackageLoader> precond_setup_loader;
-    std::unique_ptr<torch::inductor::AOTIModelPackageLoader> precond_apply_loader;
+    SegmentLoader precond_setup_loader;
+    SegmentLoader precond_apply_loader;
     /// IFT (input-derivative) operator + solve graphs. `jacobian_given_loader`
     /// emits B = ∂r/∂g; A = ∂r/∂u is reused from `jacobian_loader`. `solve_ift_loader`
     /// takes `(*A_blocks, *B_blocks)` and emits one `-du/dg` block per (unknown,
     /// given) pair in `jacobian_pairs` order. Both null unless an input derivative
     /// was compiled.
-    std::unique_ptr<torch::inductor::AOTIModelPackageLoader> jacobian_given_loader;
-    std::unique_ptr<torch::inductor::AOTIModelPackageLoader> solve_ift_loader;
+    SegmentLoader jacobian_given_loader;
+    SegmentLoader solve_ift_loader;
     /// Implicit-segment parameter sensitivity graphs: du/dθ for a promoted
     /// parameter inside the residual. `dr_dparam_loader` emits the dense A = ∂r/∂u
     /// and ∂r/∂θ (reverse-mode AD; parameters enter PER-BATCH -- the runtime
@@ -244,9 +404,9 @@ struct Model::Impl
     /// takes `(A_dense, dr_dparam)` and emits one dense du/dθ block per (unknown,
     /// param) pair in `param_jacobian_pairs` order. Both null unless an implicit
     /// parameter derivative was compiled.
-    std::unique_ptr<torch::inductor::AOTIModelPackageLoader> dr_dparam_loader;
-    std::unique_ptr<torch::inductor::AOTIModelPackageLoader> solve_param_loader;
-    std::unique_ptr<torch::inductor::AOTIModelPackageLoader> predictor_loader;
+    SegmentLoader dr_dparam_loader;
+    SegmentLoader solve_param_loader;
+    SegmentLoader predictor_loader;
 
     /// Sensitivity (derivative) linear-solve kind per site (schema v12). "direct"
     /// runs the compiled `solve_ift_loader` / `solve_param_loader` graph; "krylov"
@@ -358,13 +518,13 @@ struct Model::Impl
     /// are PER-BATCH (`(*B, *param_base)`) -- the runtime broadcasts the stored
     /// scalar parameter to the batch before the call (the value / jvp graphs keep
     /// parameters scalar). Null unless parameter derivatives were compiled.
-    std::unique_ptr<torch::inductor::AOTIModelPackageLoader> param_jacobian_loader;
+    SegmentLoader param_jacobian_loader;
 
     /// Parameter VJP / adjoint graph: inputs are the model inputs
     /// (parameters scalar) followed by one TYPED cotangent per output (in
     /// `param_vjp_outputs` order); outputs are the parameter gradients (in
     /// `param_vjp_params` order). Null unless parameter derivatives were compiled.
-    std::unique_ptr<torch::inductor::AOTIModelPackageLoader> param_vjp_loader;
+    SegmentLoader param_vjp_loader;
     std::vector<std::string> param_vjp_params;
     std::vector<std::string> param_vjp_outputs;
 
@@ -422,10 +582,51 @@ struct Model::Impl
     std::vector<std::string> param_inputs;
   };
 
+  /// The variables an implicit solve reads and writes: either a call's slot
+  /// vector, addressed by the plan's slot, or a name-keyed map (the Jacobian
+  /// paths and the substep driver's spans), addressed by name. Every access
+  /// passes both; only the one matching the storage is used.
+  struct VarState
+  {
+    VarState(std::vector<at::Tensor> & s)
+      : slots(&s)
+    {
+    }
+    VarState(std::map<std::string, at::Tensor> & m)
+      : map(&m)
+    {
+    }
+    /// The variable's entry, or null when it has no value yet.
+    at::Tensor * find(const std::string & name, std::size_t slot) const
+    {
+      if (slots)
+        return (*slots)[slot].defined() ? &(*slots)[slot] : nullptr;
+      auto it = map->find(name);
+      return it == map->end() ? nullptr : &it->second;
+    }
+    /// The variable's entry, created empty when absent.
+    at::Tensor & get(const std::string & name, std::size_t slot) const
+    {
+      return slots ? (*slots)[slot] : (*map)[name];
+    }
+
+    std::vector<at::Tensor> * slots = nullptr;
+    std::map<std::string, at::Tensor> * map = nullptr;
+  };
+
+  /// Which of a segment's group lists `_pack_groups` packs.
+  enum class GroupSide
+  {
+    Given,
+    Unknown,
+  };
+
   /// Lower a name list to a vector of tensors pulled (in order) from
   /// `_named_parameters`. Throws if any name is missing. Common helper for
   /// every loader call.
   std::vector<at::Tensor> _gather_params(const std::vector<std::string> & names) const;
+  /// `_gather_params` over plan parameter indices (`CallPlan::params`).
+  std::vector<at::Tensor> _gather_params(const std::vector<std::size_t> & params) const;
 
   /// Run a segment's predictor, writing its outputs into `state`.
   ///
@@ -436,7 +637,7 @@ struct Model::Impl
   /// predictor. `batch_shape` sizes the zero tensor the first iteration is
   /// seeded with.
   void _run_predictor(const Segment & seg,
-                      std::map<std::string, at::Tensor> & state,
+                      VarState state,
                       const at::TensorOptions & opts,
                       const std::vector<int64_t> & batch_shape) const;
 
@@ -466,7 +667,7 @@ struct Model::Impl
   /// to the caller so the IFT loader can run on the same tensors without
   /// re-packing.
   void _run_implicit_segment(const Segment & seg,
-                             std::map<std::string, at::Tensor> & state,
+                             VarState state,
                              std::vector<at::Tensor> & u_solved_groups,
                              std::vector<at::Tensor> & g_groups) const;
 
@@ -483,8 +684,12 @@ struct Model::Impl
   /// dynamic-batch shape) WITHOUT throwing. Converged rows' solved unknowns are
   /// written to `state`; the mask tells the substep driver which rows to freeze
   /// vs bisect.
+  /// `rows` (substep driver, optional) are the positions of this solve's rows
+  /// in the segment's flattened batch, for the per-row iteration count of
+  /// `collect_stats`.
   at::Tensor _run_implicit_segment_masked(const Segment & seg,
-                                          std::map<std::string, at::Tensor> & state) const;
+                                          std::map<std::string, at::Tensor> & state,
+                                          const at::Tensor & rows = {}) const;
 
   /// Adaptive per-element (masked) substepping -- the ONLY substepping path.
   /// Solve only the still-unconverged subset of the dynamic batch at each
@@ -500,7 +705,10 @@ struct Model::Impl
   /// failure context. On return `state` (value) / `state` + `dstate` (jacobian)
   /// hold the final unknowns / total `du_M/d(master inputs)`. Only called when
   /// `seg.max_substepping_level > 0`; the jacobian variant requires the IFT
-  /// operator (`seg.jacobian_given_loader`).
+  /// operator (`seg.jacobian_given_loader`). With `SolverConfig::substep_method`
+  /// "ADAPTIVE" the failing rows are not bisected depth-first: every row marches
+  /// on its own step (`SubstepSchedule`), one masked solve per round for all of
+  /// them, under the same depth cap and failure contract.
   void _run_implicit_segment_substepped_masked(const Segment & seg,
                                                std::map<std::string, at::Tensor> & state) const;
   void _run_implicit_segment_substepped_masked_jacobian(
@@ -508,6 +716,26 @@ struct Model::Impl
       std::map<std::string, at::Tensor> & state,
       std::map<std::string, at::Tensor> & dstate) const;
 
+  /// How many sub-batches the BISECT driver splits the failing `rows` into
+  /// (`SolverConfig::substep_workers`): at most one per worker, each at least
+  /// `substep_split_rows` rows. 1 = solve them on the calling thread. CPU only,
+  /// and only where a worker can cap its own intra-op team (see
+  /// `_run_substep_parts`).
+  int64_t _substep_parts(const at::Tensor & rows) const;
+
+  /// Split `rows` into `parts` sub-batches and run `fn` on each concurrently
+  /// on `_substep_pool`, whose workers re-install the caller's context
+  /// (`InheritedFrame`) while the calling thread waits. With an OpenMP torch
+  /// each worker caps its own team at an equal share of the caller's intra-op
+  /// threads; with torch's native pool all callers already share one bounded
+  /// team. The process-wide setting is left alone either way. Solve statistics
+  /// are recorded under `stats_mutex`. Once every part has finished, the first
+  /// failure is rethrown.
+  void _run_substep_parts(const at::Tensor & rows,
+                          int64_t parts,
+                          std::mutex & stats_mutex,
+                          const std::function<void(const at::Tensor &)> & fn) const;
+
   /// Write the substep sub-span [a, b] transform of a name->tensor map into
   /// `dst`, reading the endpoint snapshot `orig` and the chained old-state
   /// `chained`. The coefficient math is identical for the primal state and the
@@ -520,22 +748,33 @@ struct Model::Impl
                            double b,
                            const std::map<std::string, at::Tensor> & chained,
                            std::map<std::string, at::Tensor> & dst) const;
+  /// The per-row form, for the adaptive schedule (`SolverConfig::substep_method`):
+  /// `a` / `b` are 1-D, one sub-span per row of `orig`.
+  void _apply_substep_span(const Segment & seg,
+                           const std::map<std::string, at::Tensor> & orig,
+                           const at::Tensor & a,
+                           const at::Tensor & b,
+                           const std::map<std::string, at::Tensor> & chained,
+                           std::map<std::string, at::Tensor> & dst) const;
 
-  /// Pack per-variable ``state`` entries into per-group tensors via the
-  /// AssembledVector convention: BLOCK groups cat per-var contributions
+  /// Pack per-variable ``state`` entries into ``seg``'s ``side`` groups via
+  /// the AssembledVector convention: BLOCK groups cat per-var contributions
   /// along the last base axis preserving sub_batch axes; DENSE groups
   /// fold each var's sub_batch into base, then cat. Used at solve start
-  /// to build ``u_groups`` / ``g_groups`` once per solve.
-  std::vector<at::Tensor> _pack_groups(const std::map<std::string, at::Tensor> & state,
-                                       const std::vector<Segment::GroupInfo> & groups) const;
-
-  /// Unpack per-group tensors back into per-variable ``state`` entries.
-  /// Inverse of :meth:`_pack_groups`. Called once at solve end to write
+  /// to build ``u_groups`` / ``g_groups`` once per solve. With ``pooled`` set
+  /// and a workspace installed, each group is written into the segment's
+  /// pack scratch buffer (`_ws_buffer`) instead of a fresh tensor.
+  std::vector<at::Tensor>
+  _pack_groups(VarState state, const Segment & seg, GroupSide side, bool pooled = false) const;
+
+  /// Unpack ``seg``'s per-group unknowns back into per-variable ``state``
+  /// entries. Inverse of :meth:`_pack_groups`. Called once at solve end to write
   /// the converged ``u_groups`` back to ``state[u.name]`` for downstream
-  /// forward composition.
+  /// forward composition. Under a workspace the group tensors may be scratch
+  /// buffers, so every entry is then copied out rather than viewed.
   void _unpack_groups(const std::vector<at::Tensor> & group_tensors,
-                      const std::vector<Segment::GroupInfo> & groups,
-                      std::map<std::string, at::Tensor> & state) const;
+                      const Segment & seg,
+                      VarState state) const;
 
   /// Run a forward segment's JVP loader and compose its Jacobian into
   /// `dstate`. Replaces the value-loader call: the JVP loader returns
@@ -586,6 +825,92 @@ struct Model::Impl
   /// batch across a mix of global and sub-batched inputs.
   std::vector<int64_t> _dynamic_batch_shape_of(std::size_t idx, const at::Tensor & t) const;
 
+  /// Name-free execution plan for the value path, built once after the
+  /// segments load. Every variable any segment reads or writes gets an integer
+  /// slot; a call then runs over a flat `std::vector<at::Tensor>` of `nslots`
+  /// entries instead of a string-keyed state map. Every promoted parameter gets
+  /// an index into `params`, which points at its `_named_parameters` entry, so
+  /// in-place edits and `set_parameter` are seen without a lookup; per-call
+  /// overrides are mapped to indices once per call (`ParamOverrideGuard`).
+  struct CallPlan
+  {
+    struct Step
+    {
+      // Forward segments: loader-input slots (graph-call order), output slots,
+      // and each promoted parameter's natural base ndim.
+      std::vector<std::size_t> in_slots;
+      std::vector<std::size_t> out_slots;
+      std::vector<int64_t> param_base_ndim;
+      // Parameter indices, parallel to `param_inputs` / `predictor_param_inputs`.
+      std::vector<std::size_t> params;
+      std::vector<std::size_t> predictor_params;
+      // Implicit segments: the slot of each given / unknown, of each variable of
+      // each given / unknown group (parallel to `per_var_info`), and of the
+      // predictor's inputs, outputs and feedback pair.
+      std::vector<std::size_t> given_slots;
+      std::vector<std::size_t> unknown_slots;
+      std::vector<std::vector<std::size_t>> given_group_slots;
+      std::vector<std::vector<std::size_t>> unknown_group_slots;
+      std::vector<std::size_t> predictor_in_slots;
+      std::vector<std::size_t> predictor_out_slots;
+      std::size_t feedback_in_slot = 0;
+      std::size_t feedback_out_slot = 0;
+      // Substepping implicit segments only: every variable the driver reads or
+      // writes, with its slot, for the name-keyed span maps it works on.
+      std::vector<std::pair<std::string, std::size_t>> bridge;
+    };
+    std::size_t nslots = 0;
+    std::vector<std::size_t> input_slots;  // parallel to `_input_names`
+    std::vector<std::size_t> output_slots; // parallel to `_output_names`
+    std::vector<Step> steps;               // parallel to `_segments`
+    /// One entry per promoted parameter, in `_param_base_shapes` order.
+    std::vector<const at::Tensor *> params;
+    /// Parameter index by BOUNDARY name.
+    std::map<std::string, std::size_t> param_of;
+  };
+
+  /// The plan step of `seg`, one of `_segments`.
+  const CallPlan::Step & _step_of(const Segment & seg) const
+  {
+    return _plan.steps[static_cast<std::size_t>(&seg - _segments.data())];
+  }
+
+  /// Gather the caller's inputs into master (`_input_names`) order, by handle.
+  /// Throws FatalError on a missing input. The one per-input name lookup a
+  /// string-keyed op pays; the positional (`Model::bind`) route skips it.
+  std::vector<at::Tensor> _gather_inputs(const std::map<std::string, at::Tensor> & inputs) const;
+
+  /// The positional body of `_prepare_inputs`: validate each master-ordered
+  /// input and broadcast its dynamic batch to the common shape, in place. A
+  /// contiguous input already at the call batch is left untouched. A call whose
+  /// inputs match the last call's `ShapeSignature` replays its plan instead.
+  void _prepare_positional(std::vector<at::Tensor> & inputs) const;
+
+  /// The outcome of one `_prepare_positional` pass, keyed by everything it
+  /// depends on: the per-input sizes, strides, dtype and device. `targets[k]`
+  /// is the shape input `k` is broadcast (and materialized) to, or empty when
+  /// the input is used as-is.
+  struct ShapeSignature
+  {
+    struct Entry
+    {
+      std::vector<int64_t> sizes;
+      std::vector<int64_t> strides;
+      at::ScalarType dtype = at::kDouble;
+      at::Device device = at::kCPU;
+    };
+    std::vector<Entry> entries;
+    std::vector<std::vector<int64_t>> targets;
+
+    /// Whether `inputs` have exactly the recorded layout. Allocation-free.
+    bool matches(const std::vector<at::Tensor> & inputs) const;
+  };
+
+  // The last validated signature. Read and replaced under `_sig_mutex`; a
+  // concurrent caller at another shape just replaces it.
+  mutable std::mutex _sig_mutex;
+  mutable std::shared_ptr<const ShapeSignature> _sig;
+
   /// Validate every required input and return them as a `state` map with the
   /// dynamic-batch axes broadcast to a single common shape (base axes
   /// preserved), so a batch-independent input -- e.g. MOOSE's scalar TIME force
@@ -596,6 +921,79 @@ struct Model::Impl
   std::map<std::string, at::Tensor>
   _prepare_inputs(const std::map<std::string, at::Tensor> & inputs) const;
 
+  /// The value path over `_plan`: `inputs` in master (`_input_names`) order,
+  /// outputs returned in `_output_names` order. The shared body of `forward`,
+  /// `forward_into` and `Model::Binding::forward`, which differ only in how they
+  /// take inputs and hand outputs back.
+  std::vector<at::Tensor> _forward_positional(std::vector<at::Tensor> inputs) const;
+
+  /// Run a forward segment against the slot vector: the `_run_forward_segment`
+  /// body with every variable access resolved to a precomputed slot index.
+  void _run_forward_step(const Segment & seg,
+                         const CallPlan::Step & step,
+                         std::vector<at::Tensor> & slots,
+                         const std::vector<int64_t> & batch) const;
+
+  /// Run an implicit segment against the slot vector. A single-shot segment is
+  /// solved in place through the step's slots. The substep driver is map-based,
+  /// so a substepping segment's `bridge` variables are lifted into a small map,
+  /// solved, and written back to their slots.
+  /// `u_solved_groups` / `g_groups` receive the converged per-group unknowns and
+  /// givens, as from `_run_implicit_segment`; both stay empty for a substepped
+  /// segment.
+  void _run_implicit_step(const Segment & seg,
+                          const CallPlan::Step & step,
+                          std::vector<at::Tensor> & slots,
+                          std::vector<at::Tensor> & u_solved_groups,
+                          std::vector<at::Tensor> & g_groups) const;
+
+  /// The converged implicit-segment state of the last `forward` call, kept when
+  /// `Model::set_forward_memo` is on. `key` stamps the call's master inputs (the
+  /// caller's handles, before broadcasting) followed by every resolved promoted
+  /// parameter. A stamp holds its tensor, so the TensorImpl it is compared by
+  /// cannot be freed and its address recycled while the memo lives.
+  /// `u_groups[i]` / `g_groups[i]` are segment i's converged per-group unknowns
+  /// and givens; empty for a forward or substepped segment.
+  struct ForwardMemo
+  {
+    struct Stamp
+    {
+      at::Tensor t;
+      int64_t version = 0;
+      std::vector<int64_t> sizes;
+    };
+    static Stamp stamp(const at::Tensor & t);
+    /// Same TensorImpls, at the same version counters and shapes.
+    static bool same(const std::vector<Stamp> & a, const std::vector<Stamp> & b);
+
+    std::vector<Stamp> key;
+    std::vector<std::vector<Stamp>> u_groups;
+    std::vector<std::vector<Stamp>> g_groups;
+
+    /// False once any stored group was written in place since the solve (the
+    /// unknowns can alias the outputs handed back to the caller).
+    bool intact() const;
+  };
+
+  /// Stamp the memo key for a call on the master-ordered `inputs`, with the
+  /// per-segment group vectors sized but empty.
+  std::shared_ptr<ForwardMemo> _memo_open(const std::vector<at::Tensor> & inputs) const;
+
+  /// The memo if it was recorded for exactly these inputs and parameters, else
+  /// null. Always null while the memo is off.
+  std::shared_ptr<const ForwardMemo>
+  _memo_recall(const std::map<std::string, at::Tensor> & inputs) const;
+
+  /// `_run_implicit_segment`, unless `memo` holds segment `i`'s converged
+  /// groups: those are then unpacked into `state` and handed back without a
+  /// solve. `memo` may be null.
+  void _solve_or_recall(std::size_t i,
+                        const Segment & seg,
+                        std::map<std::string, at::Tensor> & state,
+                        std::vector<at::Tensor> & u_solved_groups,
+                        std::vector<at::Tensor> & g_groups,
+                        const ForwardMemo * memo) const;
+
   /// Compose the master Jacobian carrier: returns the output values plus the
   /// per-variable `dstate` map, where `dstate[var]` is `(*common_dyn,
   /// var_folded, M_req)` -- the variable's sensitivity to the requested input
@@ -608,6 +1006,15 @@ struct Model::Impl
   std::pair<std::map<std::string, at::Tensor>, std::map<std::string, at::Tensor>>
   _jacobian_dstate(const std::map<std::string, at::Tensor> & inputs) const;
 
+  /// Contract the carrier against per-input tangent blocks `(*B, in_var_size,
+  /// K)`: returns `(*B, out_folded, K)` for every output in a requested pair.
+  /// An input without a block contributes nothing; an output none of whose
+  /// inputs has one comes back zero. Shared by `jvp` (K = 1) and `jvp_multi`.
+  std::map<std::string, at::Tensor>
+  _contract_dstate(const std::map<std::string, at::Tensor> & dstate,
+                   const std::map<std::string, at::Tensor> & tangent_cols,
+                   int64_t k) const;
+
   // The per-group Newton iteration + line-search reductions now live in
   // newton.{h,cpp} (driven through the NonlinearSystem abstraction);
   // `_run_implicit_segment` builds an AOTINonlinearSystem and calls Newton.
@@ -615,6 +1022,13 @@ struct Model::Impl
   // Per-segment runtime state, in declared order.
   std::vector<Segment> _segments;
 
+  /// The value-path plan (see `CallPlan`).
+  CallPlan _plan;
+
+  /// Populate `_plan` from `_segments` and the master IO. Called once, at the
+  /// end of construction.
+  void _build_plan();
+
   // Master IO (in graph-call order). The public surface is the per-variable
   // base shapes; the flat _input_sizes / _output_sizes / _input_offsets /
   // _input_total_size (== prod(base_shape) and its prefix sums) stay private,
@@ -723,6 +1137,134 @@ struct Model::Impl
   std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
   _forward_pair_blocks(const std::map<std::string, at::Tensor> & inputs) const;
 
+  /// A per-call narrowing of the Jacobian carrier to a subset of the requested
+  /// pairs (`jacobian(inputs, wrt, of)`). `offset` / `size` / `total` replace
+  /// the `_req_input_*` column layout; `composed[si]` says whether segment `si`
+  /// lies on a path from a selected input to a selected output. Every other
+  /// segment advances `state` through its value graph and its outputs' carrier
+  /// blocks are zero-filled, exactly like a segment pruned at compile time.
+  struct JacobianSubset
+  {
+    std::map<std::string, int64_t> offset;
+    std::map<std::string, int64_t> size;
+    int64_t total = 0;
+    std::vector<std::string> of;
+    std::vector<bool> composed;
+  };
+
+  /// Validate a `(wrt, of)` selection against the compiled pairs and build its
+  /// column layout and segment mask.
+  JacobianSubset _jacobian_subset(const std::vector<std::string> & wrt_inputs,
+                                  const std::vector<std::string> & of_outputs) const;
+
+  // --- Per-call context ----------------------------------------------------
+  //
+  // Everything one public op installs for its duration lives in a `CallContext`
+  // on that op's stack, never in the Impl, so concurrent calls on one const
+  // Model cannot see each other's overrides, guesses or workspace. The calling
+  // thread finds its innermost context through a thread-local chain of frames.
+  // Each frame names its Impl, so a nested call into another Model (e.g. a
+  // dispatcher's per-device model) neither sees nor disturbs this one's.
+  struct CallContext
+  {
+    /// Promoted-parameter values by plan index with the call's overrides
+    /// swapped in; null when there are none (`_resolve_param`).
+    const std::vector<const at::Tensor *> * param_values = nullptr;
+    /// Newton initial guess, keyed by ORIGINAL unknown name
+    /// (`_apply_initial_guess`).
+    const std::map<std::string, at::Tensor> * initial_guess = nullptr;
+    /// Whether some entry of `initial_guess` is NaN, i.e. left unguessed.
+    bool initial_guess_partial = false;
+    /// Batch-shape-keyed buffer cache (`_ws_slot`, `_ws_buffer`).
+    Workspace::Impl * workspace = nullptr;
+    /// Narrowed Jacobian columns (`_col_offset`).
+    const JacobianSubset * jac_subset = nullptr;
+    /// Solver statistics of the call, when `collect_stats` is on (`_seg_stats`).
+    SolveStats * stats = nullptr;
+    /// Per-segment starting sub-step levels (`_substep_hint`).
+    const std::vector<at::Tensor> * substep_hint = nullptr;
+    /// Serializes `_record_solve` while substep sub-batches share `stats`
+    /// across threads (`_run_substep_parts`).
+    std::mutex * stats_mutex = nullptr;
+  };
+
+  /// One link of the calling thread's context chain. A frame starts as a copy
+  /// of its Impl's current context, so a nested internal call that sets nothing
+  /// inherits its caller's state (e.g. param_vjp -> param_jacobian keeps the
+  /// outer override); each guard below then changes one field. Frames are RAII
+  /// and nest strictly.
+  struct ContextFrame
+  {
+    explicit ContextFrame(const Impl * i);
+    ~ContextFrame();
+    ContextFrame(const ContextFrame &) = delete;
+    ContextFrame & operator=(const ContextFrame &) = delete;
+
+    const Impl * impl;
+    const ContextFrame * prev;
+    CallContext ctx;
+  };
+
+  /// The calling thread's innermost frame, for any Impl.
+  static thread_local const ContextFrame * _t_frame;
+
+  /// Re-install another thread's context `from` on a worker thread, so the
+  /// work it runs for that call sees the same overrides, guesses and
+  /// statistics. The workspace is left out: its cache is not thread-safe.
+  struct InheritedFrame : ContextFrame
+  {
+    InheritedFrame(const Impl * i, const CallContext & from)
+      : ContextFrame(i)
+    {
+      ctx = from;
+      ctx.workspace = nullptr;
+    }
+  };
+
+  /// The calling thread's innermost context for this Impl; all null outside a
+  /// call.
+  const CallContext & _ctx() const;
+
+  /// Install a Jacobian subset for the guard's lifetime.
+  struct JacobianSubsetGuard : ContextFrame
+  {
+    JacobianSubsetGuard(const Impl * i, const JacobianSubset & subset)
+      : ContextFrame(i)
+    {
+      ctx.jac_subset = &subset;
+    }
+  };
+
+  /// The carrier's column layout for the current call: the subset's when one is
+  /// installed, the compile-time `_req_input_*` narrowing otherwise.
+  const std::map<std::string, int64_t> & _col_offset() const
+  {
+    const auto * sub = _ctx().jac_subset;
+    return sub ? sub->offset : _req_input_offset;
+  }
+  const std::map<std::string, int64_t> & _col_size() const
+  {
+    const auto * sub = _ctx().jac_subset;
+    return sub ? sub->size : _req_input_size;
+  }
+  int64_t _col_total() const
+  {
+    const auto * sub = _ctx().jac_subset;
+    return sub ? sub->total : _req_total_size;
+  }
+
+  /// Whether segment `si` composes its Jacobian in the current call.
+  bool _composes(std::size_t si) const
+  {
+    const auto * sub = _ctx().jac_subset;
+    return !sub || sub->composed[si];
+  }
+
+  /// The body shared by both `jacobian` overloads, run under their guards:
+  /// compose the carrier and slice the selected (out, in) blocks.
+  std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
+  _jacobian_blocks(const std::map<std::string, at::Tensor> & inputs) const;
+
   /// True iff the artifact is a single forward segment carrying a jvp loader --
   /// the case the per-pair fast path (unbatched batch-independent return) covers.
   bool _is_single_forward_jac() const
@@ -736,35 +1278,163 @@ struct Model::Impl
   // representation.
   std::map<std::string, at::Tensor> _named_parameters;
 
-  // Per-call promoted-parameter override (null outside a call). Points at the
-  // caller's `param_overrides` map for the duration of one public op, consulted
-  // by `_resolve_param`. `mutable` because the public ops are const yet need to
-  // stash it; thread-safe under the dispatcher because each per-device Model is
-  // driven by a single worker at a time (the stored params are never mutated).
-  // Set/restored by `ParamOverrideGuard` so nested internal calls (e.g.
-  // param_vjp -> param_jacobian) inherit the outer override.
-  mutable const std::map<std::string, at::Tensor> * _param_overrides = nullptr;
-
-  /// RAII setter for `_param_overrides`. A non-empty `overrides` installs itself
-  /// for the guard's lifetime; an empty one leaves the current override in place
-  /// (so an internal call that passes no override inherits its caller's). The
-  /// previous pointer is always restored on destruction.
-  struct ParamOverrideGuard
+  /// Install `overrides` (keyed by BOUNDARY name) as the call's
+  /// promoted-parameter overrides: map each to its plan index once, here, so
+  /// the segments read parameters by index. Keys that name no promoted
+  /// parameter are ignored. An empty map installs nothing, so an internal call
+  /// that passes no override inherits its caller's.
+  struct ParamOverrideGuard : ContextFrame
   {
-    const Impl * impl;
-    const std::map<std::string, at::Tensor> * prev;
-    ParamOverrideGuard(const Impl * i, const std::map<std::string, at::Tensor> & overrides)
-      : impl(i),
-        prev(i->_param_overrides)
+    ParamOverrideGuard(const Impl * i, const std::map<std::string, at::Tensor> & overrides);
+    std::vector<const at::Tensor *> values;
+  };
+
+  /// Install the call's Newton initial guess. Validates the keys on entry: each
+  /// must be an unknown of an implicit segment that does not substep. Also
+  /// reads back whether any entry is NaN (`initial_guess_partial`). An empty
+  /// guess installs nothing.
+  struct InitialGuessGuard : ContextFrame
+  {
+    InitialGuessGuard(const Impl * i, const std::map<std::string, at::Tensor> & guess);
+  };
+
+  /// Whether the current call guesses every entry of every unknown of `seg`,
+  /// leaving its predictor nothing to do.
+  bool _guesses_all(const Segment & seg) const;
+
+  /// Overwrite the guessed unknowns of `seg` in `state` with the caller's guess,
+  /// broadcast to `(*batch_shape, *sub_batch, *base)`. A NaN entry keeps the
+  /// value already in `state`. No-op without a guess.
+  void _apply_initial_guess(const Segment & seg,
+                            VarState state,
+                            const at::TensorOptions & opts,
+                            const std::vector<int64_t> & batch_shape) const;
+
+  /// Install the call's sub-step hint. An empty hint installs nothing.
+  struct SubstepHintGuard : ContextFrame
+  {
+    SubstepHintGuard(const Impl * i, const std::vector<at::Tensor> & hint)
+      : ContextFrame(i)
+    {
+      if (!hint.empty())
+        ctx.substep_hint = &hint;
+    }
+  };
+
+  /// The current call's starting sub-step level per row of `seg`, flattened to
+  /// its `B` rows, clamped to the depth cap and placed on `idx_opts`; undefined
+  /// when the call does not hint `seg`. Throws on a hint of the wrong size.
+  at::Tensor
+  _substep_hint(const Segment & seg, int64_t B, const at::TensorOptions & idx_opts) const;
+
+  /// Install the caller's workspace for one public op (consulted through
+  /// `_ws_slot` / `_ws_buffer`), or none (`ws` null).
+  struct WorkspaceGuard : ContextFrame
+  {
+    WorkspaceGuard(const Impl * i, Workspace::Impl * ws)
+      : ContextFrame(i)
     {
-      if (!overrides.empty())
-        i->_param_overrides = &overrides;
+      ctx.workspace = ws;
     }
-    ~ParamOverrideGuard() { impl->_param_overrides = prev; }
-    ParamOverrideGuard(const ParamOverrideGuard &) = delete;
-    ParamOverrideGuard & operator=(const ParamOverrideGuard &) = delete;
   };
 
+  /// Collect the call's solver statistics when `collect_stats` is on. The
+  /// outermost guard owns the record, sized with one entry per implicit segment,
+  /// and publishes it to `_t_last_stats` on exit, also when the call throws. Nested
+  /// internal calls add to the same record.
+  struct StatsGuard : ContextFrame
+  {
+    explicit StatsGuard(const Impl * i);
+    ~StatsGuard();
+    SolveStats owned;
+  };
+
+  /// The current call's entry for implicit segment `seg`, or null when no
+  /// statistics are being collected.
+  SegmentStats * _seg_stats(const Segment & seg) const;
+
+  /// Add one Newton solve of `seg` to the current call's statistics. `rows`
+  /// places the solve's rows in the segment's flattened batch (substep driver);
+  /// without it the per-row counts are added shape for shape.
+  void
+  _record_solve(const Segment & seg, const NewtonResult & res, const at::Tensor & rows = {}) const;
+
+  /// The workspace entry for a call-invariant buffer, or null when no workspace
+  /// is installed. A defined entry is a hit and may be used as-is; an undefined
+  /// one is a miss, and the caller stores the buffer it builds there. `seg` is
+  /// the segment index (0 where the buffer is not per-segment). Seeds are
+  /// shared across calls and must never be written in place; scratch entries
+  /// (`_ws_buffer`, the Newton trial slots) are the current call's to overwrite.
+  at::Tensor *
+  _ws_slot(WsTag tag, std::size_t seg, std::size_t idx, at::IntArrayRef shape) const;
+
+  /// A read-only zero tensor of `shape`: from the workspace when one is
+  /// installed, freshly allocated otherwise.
+  at::Tensor _ws_zeros(WsTag tag,
+                       std::size_t seg,
+                       std::size_t idx,
+                       at::IntArrayRef shape,
+                       const at::TensorOptions & opts) const;
+
+  /// A scratch buffer of `shape` for the current call to overwrite, or an
+  /// undefined tensor when no workspace is installed. Its contents are
+  /// unspecified, and the next call at the same shape gets the same storage, so
+  /// nothing handed back to the caller may alias it (`_unpack_groups` and the
+  /// Jacobian block slicing copy out of it).
+  at::Tensor _ws_buffer(WsTag tag,
+                        std::size_t seg,
+                        std::size_t idx,
+                        at::IntArrayRef shape,
+                        const at::TensorOptions & opts) const;
+
+  // Forward-state memo (see `ForwardMemo`). Toggled by `Model::set_forward_memo`;
+  // `_memo` is replaced wholesale by each `forward` and read by the derivative
+  // ops, under `_memo_mutex` since both happen in const calls. The switch is
+  // read by concurrent calls without the mutex, hence atomic.
+  std::atomic<bool> _memo_enabled{false};
+  mutable std::mutex _memo_mutex;
+  mutable std::shared_ptr<const ForwardMemo> _memo;
+
+  /// Worker threads of the concurrent BISECT substepping
+  /// (`_run_substep_parts`). Started on first use, grown to the largest split
+  /// asked for and joined when the model is destroyed. Concurrent calls queue
+  /// onto the same workers; a task never queues another (a sub-batch does not
+  /// split again), so every call's tasks eventually run.
+  class SubstepPool
+  {
+  public:
+    SubstepPool() = default;
+    SubstepPool(const SubstepPool &) = delete;
+    SubstepPool & operator=(const SubstepPool &) = delete;
+    ~SubstepPool();
+
+    /// Queue `task`, first starting workers until there are at least `workers`.
+    void run(std::size_t workers, std::function<void()> task);
+
+  private:
+    void worker_main();
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::queue<std::function<void()>> _tasks;
+    std::vector<std::thread> _threads;
+    bool _stop = false;
+  };
+  mutable SubstepPool _substep_pool;
+
+  // The calling thread's most recent `SolveStats` per model
+  // (`Model::last_solve_stats`), written by the outermost `StatsGuard`. The
+  // table lives and dies with its thread. A slot also holds its model's
+  // `_stats_token`: once the model is destroyed the slot reads as empty, even
+  // if a new model reuses the address, and the next publish drops it.
+  struct StatsSlot
+  {
+    std::weak_ptr<const int> alive;
+    SolveStats stats;
+  };
+  static thread_local std::map<const Impl *, StatsSlot> _t_last_stats;
+  std::shared_ptr<const int> _stats_token = std::make_shared<const int>(0);
+
   // Natural base shape per promoted parameter, from its typed class
   // (Scalar => {}, SR2 => {6}). Used to split a (possibly batched) stored
   // parameter `(*pbatch, *base)` into batch vs base -- for broadcasting it to the
@@ -780,7 +1450,7 @@ struct Model::Impl
   // authored names. `_*_orig2ext` / `_*_ext2orig` are the per-namespace forward /
   // reverse maps (present only for renamed entries); `_ext_*` are the pre-built
   // boundary views the public accessors return. `_named_parameters` and the
-  // per-call `_param_overrides` are themselves stored boundary-keyed, so params
+  // per-call parameter overrides are themselves stored boundary-keyed, so params
   // need only the forward map (`_param_orig2ext`, consulted by
   // `_param_boundary_name`). `_has_aliases` gates the facade's key translation so
   // the fully-baked / unrenamed common case pays nothing.
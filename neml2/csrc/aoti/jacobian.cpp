@@ -40,10 +40,11 @@ Model::Impl::_init_dstate(const at::TensorOptions & options,
                           std::map<std::string, at::Tensor> & dstate) const
 {
   // Narrowed carrier: columns span only the *requested* input directions
-  // (`_req_total_size`), so the composition's matmuls and the IFT solve's RHS
-  // ("B matrix") are sized to the derivatives the user asked for. An input that
-  // is never on the `in` side of a requested pair gets an all-zero block (it is
-  // never differentiated, so it contributes nothing downstream).
+  // (`_col_total()`: the compiled pairs, or a per-call subset of them), so the
+  // composition's matmuls and the IFT solve's RHS ("B matrix") are sized to the
+  // derivatives the user asked for. An input that is never on the `in` side of
+  // a requested pair gets an all-zero block (it is never differentiated, so it
+  // contributes nothing downstream).
   //
   // `batch_shape` is the FIRST input's full leading shape `(*dyn, *sub0)`. Each
   // dstate block carries the shared dynamic batch `*common_dyn` (with the first
@@ -63,16 +64,28 @@ Model::Impl::_init_dstate(const at::TensorOptions & options,
     const int64_t folded = sub_total * _input_sizes[k];
     std::vector<int64_t> shape_vec = common_dyn;
     shape_vec.push_back(folded);
-    shape_vec.push_back(_req_total_size);
+    shape_vec.push_back(_col_total());
+    // The seed depends only on the batch shape, and every downstream consumer
+    // reads it out of place, so a workspace can hand back the same block. A
+    // subset seed also depends on which columns were selected; it is not cached.
+    at::Tensor * cached =
+        _ctx().jac_subset ? nullptr : _ws_slot(WsTag::DStateSeed, 0, k, shape_vec);
+    if (cached && cached->defined())
+    {
+      dstate[_input_names[k]] = *cached;
+      continue;
+    }
     auto block = at::zeros(shape_vec, options);
-    auto it = _req_input_offset.find(_input_names[k]);
-    if (it != _req_input_offset.end())
+    auto it = _col_offset().find(_input_names[k]);
+    if (it != _col_offset().end())
     {
       // Requested inputs are plain-batch (the compile-time guard rejects
-      // sub-batched requested pairs), so folded == _req_input_size here.
-      const auto rs = _req_input_size.at(_input_names[k]);
+      // sub-batched requested pairs), so folded == the column width here.
+      const auto rs = _col_size().at(_input_names[k]);
       block.narrow(/*dim=*/-1, /*start=*/it->second, /*length=*/rs).copy_(at::eye(rs, options));
     }
+    if (cached)
+      *cached = block;
     dstate[_input_names[k]] = block;
   }
 }
@@ -208,16 +221,18 @@ std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
 Model::Impl::_implicit_param_pair_blocks(const std::map<std::string, at::Tensor> & inputs) const
 {
   const auto & seg = _segments.front();
+  const auto memo = _memo_recall(inputs);
 
   // Pack + validate caller inputs, broadcasting to the common batch.
   auto state = _prepare_inputs(inputs);
 
-  // Run the Newton solve to convergence; this writes the converged unknowns back
-  // into `state` and hands us the converged per-group unknowns + per-group givens
-  // (the exact tensors the ParamIFT graph was traced against).
+  // Run the Newton solve to convergence (or take it from the forward memo); this
+  // writes the converged unknowns back into `state` and hands us the converged
+  // per-group unknowns + per-group givens (the exact tensors the ParamIFT graph
+  // was traced against).
   std::vector<at::Tensor> u_solved_groups;
   std::vector<at::Tensor> g_groups;
-  _run_implicit_segment(seg, state, u_solved_groups, g_groups);
+  _solve_or_recall(0, seg, state, u_solved_groups, g_groups, memo.get());
 
   // Runtime batch shape from the first converged unknown group: plain-batch =>
   // DENSE group tensor (*batch, group_storage), so batch = everything but the
@@ -419,6 +434,8 @@ Model::Impl::_add_implicit_param_direct(const Segment & seg,
 std::pair<std::map<std::string, at::Tensor>, std::map<std::string, at::Tensor>>
 Model::Impl::_param_jacobian_dstate(const std::map<std::string, at::Tensor> & inputs) const
 {
+  const auto memo = _memo_recall(inputs);
+
   // Pack + validate caller inputs, broadcasting to the common batch.
   auto state = _prepare_inputs(inputs);
 
@@ -449,11 +466,14 @@ Model::Impl::_param_jacobian_dstate(const std::map<std::string, at::Tensor> & in
     std::vector<int64_t> shape = common_dyn;
     shape.push_back(folded);
     shape.push_back(P);
-    dpstate[_input_names[k]] = at::zeros(shape, ref.options());
+    // Never accumulated into (segments write fresh carriers for what they
+    // produce), so a workspace may share it across calls.
+    dpstate[_input_names[k]] = _ws_zeros(WsTag::DPStateSeed, 0, k, shape, ref.options());
   }
 
-  for (const auto & seg : _segments)
+  for (std::size_t si = 0; si < _segments.size(); ++si)
   {
+    const auto & seg = _segments[si];
     if (seg.kind == SegmentKind::Forward)
     {
       if (seg.jvp_loader)
@@ -479,7 +499,7 @@ Model::Impl::_param_jacobian_dstate(const std::map<std::string, at::Tensor> & in
     {
       std::vector<at::Tensor> u_solved_groups;
       std::vector<at::Tensor> g_groups;
-      _run_implicit_segment(seg, state, u_solved_groups, g_groups);
+      _solve_or_recall(si, seg, state, u_solved_groups, g_groups, memo.get());
       // The IFT / ParamIFT solves are requested iff their OPERATOR graph was
       // emitted (`jacobian_given` / `dr_dparam`), independent of the sensitivity
       // solver kind: a direct sensitivity solver additionally carries the baked
@@ -570,7 +590,9 @@ Model::Impl::_run_forward_segment_jacobian(const Segment & seg,
   }
   std::map<std::string, at::Tensor> dout_acc;
   // Cache per-output var_size from the JVP value tensor (its trailing
-  // shape matches the output's natural (*sub, *base)).
+  // shape matches the output's natural (*sub, *base)). Under a workspace the
+  // accumulators are its carrier buffers, zeroed and accumulated in place.
+  const auto seg_idx = static_cast<std::size_t>(&seg - _segments.data());
   for (std::size_t i = 0; i < n_outs; ++i)
   {
     const auto & val = jvp_outs[i];
@@ -580,7 +602,8 @@ Model::Impl::_run_forward_segment_jacobian(const Segment & seg,
     std::vector<int64_t> shape = batch_shape;
     shape.push_back(out_var_size);
     shape.push_back(M);
-    dout_acc[seg.fwd_outputs[i]] = at::zeros(shape, val.options());
+    auto acc = _ws_buffer(WsTag::Carrier, seg_idx, i, shape, val.options());
+    dout_acc[seg.fwd_outputs[i]] = acc.defined() ? acc.zero_() : at::zeros(shape, val.options());
   }
 
   // Iterate pairs; per-pair matmul + reshape + accumulate.
@@ -673,7 +696,7 @@ Model::Impl::_run_forward_segment_jacobian(const Segment & seg,
       std::vector<int64_t> flat_shape = batch_shape;
       flat_shape.push_back(accumulator_var_size);
       flat_shape.push_back(M);
-      dout_acc[pinfo.out_var] = dout_acc[pinfo.out_var] + contrib.reshape(flat_shape);
+      dout_acc[pinfo.out_var].add_(contrib.reshape(flat_shape));
     }
     else
     {
@@ -780,14 +803,17 @@ Model::Impl::_run_implicit_segment_jacobian(const Segment & seg,
     batch_shape.push_back(dg_ref.size(d));
 
   // Per-unknown accumulator (*B, u.var_size, M). Unknowns are not seeded in
-  // _init_dstate (they are produced by composition), so start at zero.
+  // _init_dstate (they are produced by composition), so start at zero; under a
+  // workspace the accumulators are its carrier buffers.
+  const auto seg_idx = static_cast<std::size_t>(&seg - _segments.data());
   std::map<std::string, at::Tensor> du_acc;
-  for (const auto & u : seg.unknowns)
+  for (std::size_t i = 0; i < seg.unknowns.size(); ++i)
   {
     std::vector<int64_t> shape = batch_shape;
-    shape.push_back(u.var_size);
+    shape.push_back(seg.unknowns[i].var_size);
     shape.push_back(M);
-    du_acc[u.name] = at::zeros(shape, dg_ref.options());
+    auto acc = _ws_buffer(WsTag::Carrier, seg_idx, i, shape, dg_ref.options());
+    du_acc[seg.unknowns[i].name] = acc.defined() ? acc.zero_() : at::zeros(shape, dg_ref.options());
   }
 
   for (std::size_t k = 0; k < n_pairs; ++k)
@@ -819,7 +845,7 @@ Model::Impl::_run_implicit_segment_jacobian(const Segment & seg,
             ") is not yet implemented.");
 
     auto contrib = at::matmul(blk, din); // (*B, out_storage, M)
-    du_acc[pinfo.out_var] = du_acc[pinfo.out_var] + contrib;
+    du_acc[pinfo.out_var].add_(contrib);
   }
 
   // Negation already applied Python-side (IFT emits -du/dg).
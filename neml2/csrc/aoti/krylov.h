@@ -42,10 +42,14 @@
 // single `done.all().item<bool>()` restart test per cycle (the same class of
 // device->host sync the Newton loop already incurs).
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <functional>
+#include <initializer_list>
 #include <limits>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -69,6 +73,23 @@ enum class CacheStrategy
   MaxLinearIters, // rebuild when a solve's linear-iteration count exceeds a bar
 };
 
+/// How the inner relative tolerance is chosen across the outer Newton
+/// iterations (consumed by the `NonlinearSystem` layer). The Eisenstat-Walker
+/// choices set a per-element forcing term eta_k from the outer residual history:
+/// loose while the iterate is far from the root, tight near it.
+///   - EW1: eta_k = | ||b_k|| - ||b_{k-1} - A_{k-1} du_{k-1}|| | / ||b_{k-1}||
+///   - EW2: eta_k = 0.9 (||b_k|| / ||b_{k-1}||)^2
+/// Both start at 0.5 and use the usual safeguards against a sudden drop. eta_k
+/// is kept in [rel_tol, forcing_max], so `rel_tol` becomes the floor. EW1 needs
+/// the unpreconditioned linear residual; with a preconditioner the solver only
+/// tracks the preconditioned one, so EW1 costs one extra matvec per step.
+enum class ForcingTerm
+{
+  Fixed, // always rel_tol
+  EW1,
+  EW2,
+};
+
 /// Iterative linear-solver tunables. `restart` is the GMRES(m) width; `max_its`
 /// is the total inner-iteration (matvec) budget shared by both methods. The
 /// preconditioner itself is NOT named here -- it is a pair of authored
@@ -84,6 +105,12 @@ struct KrylovConfig
   double abs_tol = 0.0; // absolute Krylov residual stop (0 = relative only)
   double rel_tol = 1.0e-4;
   int64_t cache_max_its = 10; // rebuild bar for CacheStrategy::MaxLinearIters
+  ForcingTerm forcing = ForcingTerm::Fixed;
+  double forcing_max = 0.9; // cap on the Eisenstat-Walker forcing term
+  int64_t recycle = 0;      // GMRES recycle-space width k (0 = off; see KrylovRecycle)
+  // In-loop active-set compaction: once this share of the rows still iterating
+  // has converged, continue on the rest only (0 = off; see KrylovRestrictFn).
+  double compact_fraction = 0.0;
 };
 
 /// String tags (as they appear in the input file / metadata) -> enums. Unknown
@@ -115,6 +142,20 @@ parse_cache_strategy(const std::string & s, CacheStrategy & out)
   return true;
 }
 
+inline bool
+parse_forcing_term(const std::string & s, ForcingTerm & out)
+{
+  if (s == "fixed")
+    out = ForcingTerm::Fixed;
+  else if (s == "ew1")
+    out = ForcingTerm::EW1;
+  else if (s == "ew2")
+    out = ForcingTerm::EW2;
+  else
+    return false;
+  return true;
+}
+
 /// `A x = b` operator / preconditioner applied to a flat `(B, N)` batch of
 /// column vectors, returning `(B, N)`.
 using MatvecFn = std::function<at::Tensor(const at::Tensor &)>;
@@ -127,12 +168,33 @@ using PrecondFn = std::function<at::Tensor(const at::Tensor &)>;
 /// layer, which owns the logging dependency (this header stays log-free).
 using LinearLogFn = std::function<void(int64_t, const at::Tensor &, const at::Tensor &)>;
 
+/// The operator and preconditioner over a subset of the batch, for in-loop
+/// compaction (`KrylovConfig::compact_fraction`): called with 1-D int64 indices
+/// into the solve's original batch, it returns the matvec and M^-1 on those
+/// rows only, `(len(rows), N) -> (len(rows), N)`. Supplied by the layer that
+/// owns the operator. Left null, or returning null functors, the solve stays on
+/// the full batch.
+using KrylovRestrictFn = std::function<std::pair<MatvecFn, PrecondFn>(const at::Tensor &)>;
+
+/// Per-element recycle space for GMRES (GCRO-DR style deflation), carried from
+/// one solve to the next on a nearby operator: the next Newton step, or the next
+/// time step of the same batch. `U` is `(B, N, k)` with `k <= cfg.recycle`; it is
+/// undefined before the first solve, and one whose shape does not match the
+/// right-hand side is ignored. The operator has changed between solves, so a
+/// solve starts by applying it to `U` (k matvecs). A solve that builds any
+/// Krylov basis replaces `U` on return.
+struct KrylovRecycle
+{
+  at::Tensor U;
+};
+
 /// Result of an inner Krylov solve.
 struct KrylovResult
 {
   at::Tensor du;         ///< the solution `x`, shape `(B, N)`
   int64_t max_iters = 0; ///< max-over-batch inner iterations taken (matvecs)
   at::Tensor converged;  ///< per-element bool mask, shape `(B,)`
+  at::Tensor resid;      ///< per-element final residual norm the stop test saw, `(B,)`
 };
 
 namespace detail
@@ -163,18 +225,141 @@ safe_denom(const at::Tensor & d, double eps)
   sign = at::where(sign == 0, at::ones_like(sign), sign);
   return at::where(d.abs() < eps, sign * eps, d);
 }
+
+/// Orthonormal image of a recycle space. Given `U` and `AU` (both `(B, N, k)`),
+/// returns `(Z, C)` with `A Z = C` and `C^T C = I`, from a thin SVD of `AU`.
+/// Directions that `A` maps to (numerically) zero are dropped -- zeroed in both
+/// -- so a degenerate `U` never enters the solve.
+inline std::pair<at::Tensor, at::Tensor>
+recycle_basis(const at::Tensor & U, const at::Tensor & AU, double eps)
+{
+  auto [P, S, Wh] = at::linalg_svd(AU, /*full_matrices=*/false);
+  const auto cut = (S.amax(-1, /*keepdim=*/true) * std::sqrt(eps)).clamp_min(eps * eps);
+  const auto keep = (S > cut).to(S.scalar_type()); // (B, k)
+  const auto Z = at::matmul(U, Wh.transpose(1, 2)) * (keep / S.clamp_min(eps * eps)).unsqueeze(1);
+  return {Z, P * keep.unsqueeze(1)};
+}
+
+/// `index_select(0, keep)` on every defined, batched tensor in `ts` (a scalar
+/// tolerance passes through).
+inline void
+select_rows(const at::Tensor & keep, std::initializer_list<at::Tensor *> ts)
+{
+  for (auto * t : ts)
+    if (t->defined() && t->dim() > 0)
+      *t = t->index_select(0, keep);
+}
+
+/// In-loop active-set compaction (`KrylovConfig::compact_fraction`), mirroring
+/// `Newton::solve_masked`. Holds the full-batch results of the rows dropped so
+/// far and, in `rows`, the original index of each row still iterating
+/// (undefined until the first compaction).
+struct Compaction
+{
+  double fraction = 0.0;
+  KrylovRestrictFn restrict_ops;
+  at::Tensor rows, x, iters, done, rnorm;
+
+  /// Whether every working row is done. Otherwise sets `keep` to the rows to
+  /// continue with once the done share has reached `fraction`. One sync either
+  /// way: the count when compacting, `all()` when not.
+  bool check(const at::Tensor & done_w, at::Tensor & keep) const
+  {
+    if (fraction <= 0 || !restrict_ops)
+      return done_w.all().item<bool>();
+    const int64_t nl = done_w.size(0);
+    const int64_t nd = done_w.sum().item<int64_t>();
+    if (nd == nl)
+      return true;
+    if (nd > 0 && static_cast<double>(nd) >= fraction * static_cast<double>(nl))
+      keep = at::logical_not(done_w).nonzero().squeeze(-1);
+    return false;
+  }
+
+  /// Narrow the working set to `keep`, recording every working row's current
+  /// result first. Returns the operator on the kept rows; null functors (and
+  /// compaction switched off) when it cannot be restricted.
+  std::pair<MatvecFn, PrecondFn> drop(const at::Tensor & keep,
+                                      const at::Tensor & x_w,
+                                      const at::Tensor & iters_w,
+                                      const at::Tensor & done_w,
+                                      const at::Tensor & rnorm_w)
+  {
+    const auto keep_rows = rows.defined() ? rows.index_select(0, keep) : keep;
+    auto ops = restrict_ops(keep_rows);
+    if (!ops.first || !ops.second)
+    {
+      fraction = 0.0;
+      return {};
+    }
+    save(x_w, iters_w, done_w, rnorm_w);
+    rows = keep_rows;
+    return ops;
+  }
+
+  /// The solve's result over the full batch.
+  KrylovResult result(const at::Tensor & x_w,
+                      const at::Tensor & iters_w,
+                      const at::Tensor & done_w,
+                      const at::Tensor & rnorm_w)
+  {
+    if (!rows.defined())
+      return {x_w, iters_w.max().item<int64_t>(), done_w, rnorm_w};
+    save(x_w, iters_w, done_w, rnorm_w);
+    return {x, iters.max().item<int64_t>(), done, rnorm};
+  }
+
+private:
+  void save(const at::Tensor & x_w,
+            const at::Tensor & iters_w,
+            const at::Tensor & done_w,
+            const at::Tensor & rnorm_w)
+  {
+    if (!rows.defined())
+    {
+      x = x_w.clone();
+      iters = iters_w.clone();
+      done = done_w.clone();
+      rnorm = rnorm_w.clone();
+      return;
+    }
+    x.index_copy_(0, rows, x_w);
+    iters.index_copy_(0, rows, iters_w);
+    done.index_copy_(0, rows, done_w);
+    rnorm.index_copy_(0, rows, rnorm_w);
+  }
+};
 } // namespace detail
 
 /// Restarted GMRES(m) with classical Gram-Schmidt (CGS2) reorthogonalization and
 /// batched Givens-rotation QR. Solves `A x = b` (left-preconditioned by `minv`)
 /// for every element of the leading batch simultaneously to a per-element
-/// relative/absolute residual tolerance.
+/// relative/absolute residual tolerance. `rel_tol`, when defined, is a `(B,)`
+/// per-element relative tolerance that replaces `cfg.rel_tol`.
+///
+/// With `cfg.recycle = k > 0` the solve is augmented with a recycle space `U`
+/// (GCRO-DR): with `A Z = C` the orthonormalized image of `U`, the part of the
+/// residual in `range(C)` is solved directly and the Arnoldi basis is built for
+/// the projected operator `(I - C C^T) A`. At the end of each restart cycle `U` is
+/// replaced by the k directions of `[Z, V]` that `A` shrinks most: the smallest
+/// right singular vectors of the (column-scaled) augmented Hessenberg matrix. This
+/// is the real-arithmetic stand-in for GCRO-DR's harmonic Ritz vectors. The new
+/// space deflates the next restart cycle at no extra matvec, and, through
+/// `recycle`, the next solve.
+///
+/// With `cfg.compact_fraction > 0` and a `restrict_ops`, the rows that have
+/// converged are dropped from the working set -- Arnoldi basis included -- once
+/// they make up that share of it, at the same per-iteration check that ends the
+/// solve. Each leaves with the basis step of the columns built so far.
 inline KrylovResult
 gmres(const MatvecFn & matvec,
       const PrecondFn & minv,
       const at::Tensor & b,
       const KrylovConfig & cfg,
-      const LinearLogFn & on_iter = {})
+      const LinearLogFn & on_iter = {},
+      const at::Tensor & rel_tol = {},
+      KrylovRecycle * recycle = nullptr,
+      const KrylovRestrictFn & restrict_ops = {})
 {
   const auto B = b.size(0);
   const auto n = b.size(1);
@@ -183,23 +368,104 @@ gmres(const MatvecFn & matvec,
   const int64_t m = cfg.restart;
   const int64_t max_restarts = (cfg.max_its + m - 1) / m;
 
+  // The working set: the whole batch until a compaction narrows it, after
+  // which the operator and every per-row tensor below cover the kept rows only.
+  detail::Compaction cmp{cfg.compact_fraction, restrict_ops};
+  MatvecFn cur_matvec = matvec;
+  PrecondFn cur_minv = minv;
+  auto rhs = b;
+  auto rtol = rel_tol.defined() ? rel_tol : at::scalar_tensor(cfg.rel_tol, opts);
   auto x = at::zeros({B, n}, opts);
-  const auto bnorm = detail::row_norm(b).clamp_min(eps); // (B,)
+  auto bnorm = detail::row_norm(b).clamp_min(eps); // (B,)
   auto iters = at::zeros({B}, opts.dtype(at::kLong));
   auto done = at::zeros({B}, opts.dtype(at::kBool));
+  at::Tensor rnorm;     // latest residual estimate per element
   int64_t inner_it = 0; // monotonic inner-iteration counter for the log hook
 
+  // Recycle space: a caller's, or one local to this solve (deflated restarts
+  // only). Z / C hold its current image, `A Z = C`, and stay undefined when off.
+  const int64_t k = std::min<int64_t>(std::max<int64_t>(cfg.recycle, 0), n);
+  KrylovRecycle local;
+  KrylovRecycle * rc = k > 0 ? (recycle ? recycle : &local) : nullptr;
+  at::Tensor Z, C;
+  if (rc && rc->U.defined() && rc->U.size(0) == B && rc->U.size(1) == n)
+  {
+    std::vector<at::Tensor> AU;
+    for (int64_t i = 0; i < rc->U.size(2); ++i)
+      AU.push_back(minv(matvec(rc->U.select(2, i).contiguous())));
+    std::tie(Z, C) = detail::recycle_basis(rc->U, at::stack(AU, -1), eps);
+  }
+
+  // One restart cycle's Arnoldi state (see below), held out here so a
+  // compaction can narrow it mid-cycle.
+  at::Tensor V, H, cs, sn, g, Hbar, Bc, active;
+
+  // The basis step x += V y on the [0:jw] window built so far this cycle.
+  const auto basis_step = [&](int64_t jw) -> at::Tensor
+  {
+    // Back-substitute R y = g on the window.
+    auto R = H.slice(1, 0, jw).slice(2, 0, jw); // (nb, jw, jw)
+    auto gw = g.slice(1, 0, jw).unsqueeze(-1);  // (nb, jw, 1)
+    auto R_reg = R + eps * at::eye(jw, opts);
+    auto y = at::linalg_solve_triangular(R_reg,
+                                         gw,
+                                         /*upper=*/true,
+                                         /*left=*/true,
+                                         /*unitriangular=*/false)
+                 .squeeze(-1); // (nb, jw)
+    auto dx = at::einsum("bjn,bj->bn", {V.slice(1, 0, jw), y});
+    // A V = C Bc + V Hbar, so the basis step V y also moved the residual along C
+    // by Bc y; undo that through Z.
+    if (C.defined())
+      dx = dx - at::einsum("bnk,bk->bn", {Z, at::einsum("bkj,bj->bk", {Bc.slice(2, 0, jw), y})});
+    return dx;
+  };
+
+  // Continue on the rows in `keep` only. The dropped rows leave with the basis
+  // step of the `jw` columns built so far this cycle. False if the operator
+  // could not be restricted, which leaves everything on the current rows.
+  const auto compact = [&](const at::Tensor & keep, int64_t jw) -> bool
+  {
+    auto ops = cmp.drop(keep, jw > 0 ? x + basis_step(jw) : x, iters, done, rnorm);
+    if (!ops.first)
+      return false;
+    cur_matvec = std::move(ops.first);
+    cur_minv = std::move(ops.second);
+    detail::select_rows(keep, {&rhs, &bnorm, &rtol, &x, &iters, &done, &rnorm, &Z, &C});
+    detail::select_rows(keep, {&V, &H, &cs, &sn, &g, &Hbar, &Bc, &active});
+    return true;
+  };
+
   for (int64_t restart = 0; restart < max_restarts; ++restart)
   {
+    for (auto * t : {&V, &H, &cs, &sn, &g, &Hbar, &Bc, &active})
+      t->reset();
     // First cycle: x is still zero, so `b - A x == b` -- skip the matvec of a
     // zero vector. That matvec is a full model pushforward (the dominant cost)
     // whose result is identically 0, so for a solve that converges in one restart
     // cycle (the common case here) this removes ~1 of every ~k+1 matvecs.
-    auto r = (restart == 0) ? minv(b) : minv(b - matvec(x));
+    auto r = (restart == 0) ? cur_minv(rhs) : cur_minv(rhs - cur_matvec(x));
+    if (C.defined())
+    {
+      // The part of r in range(C) is solved directly: A (Z c) = C c.
+      const auto c = at::einsum("bnk,bn->bk", {C, r});
+      x = x + at::einsum("bnk,bk->bn", {Z, c});
+      r = r - at::einsum("bnk,bk->bn", {C, c});
+    }
     auto beta = detail::row_norm(r); // (B,)
-    done = at::logical_or(done, at::logical_or(beta < cfg.abs_tol, beta / bnorm < cfg.rel_tol));
-    if (done.all().item<bool>())
-      break;
+    rnorm = beta;
+    done = at::logical_or(done, at::logical_or(beta < cfg.abs_tol, beta / bnorm < rtol));
+    {
+      at::Tensor keep;
+      if (cmp.check(done, keep))
+        break;
+      if (keep.defined() && compact(keep, 0))
+      {
+        r = r.index_select(0, keep);
+        beta = beta.index_select(0, keep);
+      }
+    }
+    const int64_t nb = x.size(0);
 
     // V and H are `empty` (not `zeros`): only columns 0..jmax of V and the
     // upper-Hessenberg band of H are ever written, and every entry read is
@@ -208,24 +474,44 @@ gmres(const MatvecFn & matvec,
     // the built 0..jmax window). Skipping the zero-fill of the full restart-width
     // (m+1) buffers -- most of which go unused when the solve converges in a few
     // iterations -- removes the dominant Krylov-arithmetic kernel (`aten::fill_`).
-    auto V = at::empty({B, m + 1, n}, opts);
-    auto H = at::empty({B, m + 1, m}, opts);
-    auto cs = at::zeros({B, m}, opts);
-    auto sn = at::zeros({B, m}, opts);
-    auto g = at::zeros({B, m + 1}, opts);
+    V = at::empty({nb, m + 1, n}, opts);
+    H = at::empty({nb, m + 1, m}, opts);
+    cs = at::zeros({nb, m}, opts);
+    sn = at::zeros({nb, m}, opts);
+    g = at::zeros({nb, m + 1}, opts);
     g.select(1, 0).copy_(beta);
     V.select(1, 0).copy_(r / beta.clamp_min(eps).unsqueeze(-1));
-    const auto active = at::logical_not(done);
+    active = at::logical_not(done);
+    // Recycling keeps the unrotated Hessenberg (zero below the band, which the
+    // refresh reads whole) and the coupling C^T A V to the recycle space.
+    const int64_t kc = C.defined() ? C.size(2) : 0;
+    if (rc)
+    {
+      Hbar = at::zeros({nb, m + 1, m}, opts);
+      Bc = at::empty({nb, kc, m}, opts);
+    }
 
     int64_t jmax = m; // columns actually built this cycle (< m if it exits early)
+    bool all_done = false;
     for (int64_t j = 0; j < m; ++j)
     {
-      auto w = minv(matvec(V.select(1, j))); // (B, n)
+      auto w = cur_minv(cur_matvec(V.select(1, j))); // (nb, n)
       // CGS2: classical Gram-Schmidt + one reorthogonalization (BLAS-2 friendly).
       // First pass copies into H's column (no pre-zero needed -> H can be `empty`);
-      // the reorthogonalization pass accumulates.
+      // the reorthogonalization pass accumulates. A recycle space is projected out
+      // first in each pass.
       for (int reorth = 0; reorth < 2; ++reorth)
       {
+        if (kc > 0)
+        {
+          auto cj = at::einsum("bnk,bn->bk", {C, w}); // (B, kc)
+          w = w - at::einsum("bnk,bk->bn", {C, cj});
+          auto Bcol = Bc.select(2, j);
+          if (reorth == 0)
+            Bcol.copy_(cj);
+          else
+            Bcol.add_(cj);
+        }
         auto Vj = V.slice(1, 0, j + 1);              // (B, j+1, n)
         auto hj = at::einsum("bkn,bn->bk", {Vj, w}); // (B, j+1)
         w = w - at::einsum("bk,bkn->bn", {hj, Vj});  // (B, n)
@@ -238,6 +524,8 @@ gmres(const MatvecFn & matvec,
       auto hjp = detail::row_norm(w); // (B,)
       H.select(1, j + 1).select(1, j).copy_(hjp);
       V.select(1, j + 1).copy_(w / hjp.clamp_min(eps).unsqueeze(-1));
+      if (rc)
+        Hbar.slice(1, 0, j + 2).select(2, j).copy_(H.slice(1, 0, j + 2).select(2, j));
 
       // Apply the previous Givens rotations to the new column of H.
       for (int64_t i = 0; i < j; ++i)
@@ -273,10 +561,11 @@ gmres(const MatvecFn & matvec,
       ++inner_it;
       if (on_iter)
         on_iter(inner_it, resid, bnorm);
-      iters += at::logical_and(active, at::logical_not(done)).to(at::kLong);
+      const auto running = at::logical_and(active, at::logical_not(done));
+      iters += running.to(at::kLong);
+      rnorm = at::where(running, resid, rnorm);
       auto newly =
-          at::logical_and(at::logical_and(active, at::logical_not(done)),
-                          at::logical_or(resid < cfg.abs_tol, resid / bnorm < cfg.rel_tol));
+          at::logical_and(running, at::logical_or(resid < cfg.abs_tol, resid / bnorm < rtol));
       done = at::logical_or(done, newly);
       // Early exit: stop building the Krylov basis once every batch element has
       // converged (its Givens-estimated residual is below tol). The spectrum of
@@ -285,27 +574,66 @@ gmres(const MatvecFn & matvec,
       // to `m` regardless would do ~m matvecs per solve where a few suffice
       // (the dominant cost). The one d2h sync per inner iter is far cheaper than
       // a wasted compiled matvec, and mirrors the Newton loop's per-iter sync.
-      if (done.all().item<bool>())
+      at::Tensor keep;
+      if (cmp.check(done, keep))
       {
         jmax = j + 1;
+        all_done = true;
         break;
       }
+      // Past the compaction threshold the converged rows leave mid-cycle, so the
+      // remaining columns are built for the stragglers only.
+      if (keep.defined() && j + 1 < m)
+        compact(keep, j + 1);
     }
 
-    // Back-substitute R y = g on the [0:jmax] window actually built; x += V y.
-    auto R = H.slice(1, 0, jmax).slice(2, 0, jmax); // (B, jmax, jmax)
-    auto rhs = g.slice(1, 0, jmax).unsqueeze(-1);   // (B, jmax, 1)
-    auto R_reg = R + eps * at::eye(jmax, opts);
-    auto y = at::linalg_solve_triangular(R_reg,
-                                         rhs,
-                                         /*upper=*/true,
-                                         /*left=*/true,
-                                         /*unitriangular=*/false)
-                 .squeeze(-1); // (B, jmax)
-    x = x + at::einsum("bjn,bj->bn", {V.slice(1, 0, jmax), y});
+    // x += V y on the [0:jmax] window actually built.
+    x = x + basis_step(jmax);
+    if (!rc)
+      continue;
+
+    // Refresh. With W = [Z, V_jmax] and Q = [C, V_jmax+1], A W = Q G for
+    // G = [[I, Bc], [0, Hbar]], and Q is orthonormal, so |A W p| = |G p|. Scaling
+    // W's columns to unit length first, the new space is W D^-1 P for P the
+    // right singular vectors of G D^-1 with the smallest singular values.
+    const int64_t nw = kc + jmax;
+    auto G = at::zeros({x.size(0), nw + 1, nw}, opts);
+    if (kc > 0)
+    {
+      G.slice(1, 0, kc).slice(2, 0, kc).copy_(at::eye(kc, opts));
+      G.slice(1, 0, kc).slice(2, kc, nw).copy_(Bc.slice(2, 0, jmax));
+    }
+    G.slice(1, kc, nw + 1).slice(2, kc, nw).copy_(Hbar.slice(1, 0, jmax + 1).slice(2, 0, jmax));
+    const auto Vt = V.slice(1, 0, jmax + 1).transpose(1, 2); // (B, n, jmax+1)
+    const auto W = kc > 0 ? at::cat({Z, Vt.slice(2, 0, jmax)}, 2) : Vt.slice(2, 0, jmax);
+    // A dropped (zero) column keeps unit scale: dividing by ~0 would swamp the
+    // SVD. Should it still be picked, `recycle_basis` drops it again.
+    auto D = (W * W).sum(1).sqrt(); // (B, nw)
+    D = at::where(D > eps, D, at::ones_like(D));
+    const auto Gs = G / D.unsqueeze(1);
+    const auto Vh = std::get<2>(at::linalg_svd(Gs, /*full_matrices=*/false)); // (B, nw, nw)
+    const int64_t kk = std::min(k, nw);
+    const auto P = Vh.slice(1, nw - kk).transpose(1, 2) / D.unsqueeze(-1); // (B, nw, kk)
+    const auto U = at::matmul(W, P);
+    if (!cmp.rows.defined())
+      rc->U = U;
+    else
+    {
+      // Compacted: only the kept rows have a new space, the others keep theirs.
+      const bool same = rc->U.defined() && rc->U.size(0) == B && rc->U.size(1) == n &&
+                        rc->U.size(2) == kk;
+      const auto U0 = same ? rc->U : at::zeros({B, n, kk}, opts);
+      rc->U = U0.index_copy(0, cmp.rows, U);
+    }
+    if (!all_done)
+    {
+      // The next cycle deflates with the new space; its image is known.
+      const auto Q = kc > 0 ? at::cat({C, Vt}, 2) : Vt;
+      std::tie(Z, C) = detail::recycle_basis(U, at::matmul(Q, at::matmul(G, P)), eps);
+    }
   }
 
-  return {x, iters.max().item<int64_t>(), done};
+  return cmp.result(x, iters, done, rnorm);
 }
 
 /// Stabilized biconjugate gradient (BiCGStab), left-preconditioned by `minv`.
@@ -313,24 +641,32 @@ gmres(const MatvecFn & matvec,
 /// get a sign-preserving floor (`safe_denom`); converged elements are frozen
 /// each iteration so a batch member that has already reached ~0 residual cannot
 /// be corrupted by the ongoing (0/0) updates of the still-iterating members.
+/// `rel_tol` is the optional per-element tolerance and `restrict_ops` the
+/// compaction hook, as for `gmres`; a compaction happens between iterations.
 inline KrylovResult
 bicgstab(const MatvecFn & matvec,
          const PrecondFn & minv,
          const at::Tensor & b,
          const KrylovConfig & cfg,
-         const LinearLogFn & on_iter = {})
+         const LinearLogFn & on_iter = {},
+         const at::Tensor & rel_tol = {},
+         const KrylovRestrictFn & restrict_ops = {})
 {
   const auto B = b.size(0);
   const auto n = b.size(1);
   const auto opts = b.options();
   const double eps = detail::dtype_eps(b.scalar_type());
+  auto rtol = rel_tol.defined() ? rel_tol : at::scalar_tensor(cfg.rel_tol, opts);
+  detail::Compaction cmp{cfg.compact_fraction, restrict_ops};
+  MatvecFn cur_matvec = matvec;
+  PrecondFn cur_minv = minv;
 
   auto x = at::zeros({B, n}, opts);
   // x starts at zero, so `b - A x == b`; skip the matvec of a zero vector (a
   // full model pushforward whose result is identically 0).
   auto r = b.clone();
   auto rhat = r.clone();
-  const auto bnorm = detail::row_norm(b).clamp_min(eps);
+  auto bnorm = detail::row_norm(b).clamp_min(eps);
   auto rho = at::ones({B}, opts);
   auto alpha = at::ones({B}, opts);
   auto omega = at::ones({B}, opts);
@@ -338,27 +674,40 @@ bicgstab(const MatvecFn & matvec,
   auto p = at::zeros({B, n}, opts);
   auto iters = at::zeros({B}, opts.dtype(at::kLong));
   const auto stop = [&](const at::Tensor & rn)
-  { return at::logical_or(rn < cfg.abs_tol, rn / bnorm < cfg.rel_tol); };
-  auto done = stop(detail::row_norm(r));
+  { return at::logical_or(rn < cfg.abs_tol, rn / bnorm < rtol); };
+  auto rnorm = detail::row_norm(r);
+  auto done = stop(rnorm);
 
   const auto dot = [](const at::Tensor & a, const at::Tensor & c)
   { return at::einsum("bn,bn->b", {a, c}); };
 
   for (int64_t it = 0; it < cfg.max_its; ++it)
   {
-    if (done.all().item<bool>())
+    at::Tensor keep;
+    if (cmp.check(done, keep))
       break;
+    if (keep.defined())
+    {
+      auto ops = cmp.drop(keep, x, iters, done, rnorm);
+      if (ops.first)
+      {
+        cur_matvec = std::move(ops.first);
+        cur_minv = std::move(ops.second);
+        detail::select_rows(keep, {&x, &r, &rhat, &p, &v, &rho, &alpha, &omega});
+        detail::select_rows(keep, {&bnorm, &rtol, &iters, &done, &rnorm});
+      }
+    }
     auto rho_new = dot(rhat, r);
     // rho, omega, dot(rhat,v) are signed inner products -> sign-preserving floor;
     // dot(t,t) is a non-negative norm^2 -> a plain clamp_min is correct.
     auto beta = (rho_new / detail::safe_denom(rho, eps)) * (alpha / detail::safe_denom(omega, eps));
     auto p_new = r + beta.unsqueeze(-1) * (p - omega.unsqueeze(-1) * v);
-    auto phat = minv(p_new);
-    auto v_new = matvec(phat);
+    auto phat = cur_minv(p_new);
+    auto v_new = cur_matvec(phat);
     auto alpha_new = rho_new / detail::safe_denom(dot(rhat, v_new), eps);
     auto s = r - alpha_new.unsqueeze(-1) * v_new;
-    auto shat = minv(s);
-    auto t = matvec(shat);
+    auto shat = cur_minv(s);
+    auto t = cur_matvec(shat);
     auto omega_new = dot(t, s) / dot(t, t).clamp_min(eps);
     auto x_new = x + alpha_new.unsqueeze(-1) * phat + omega_new.unsqueeze(-1) * shat;
     auto r_new = s - omega_new.unsqueeze(-1) * t;
@@ -375,25 +724,136 @@ bicgstab(const MatvecFn & matvec,
     omega = at::where(done, omega, omega_new);
 
     iters += at::logical_not(done).to(at::kLong);
-    const auto rn = detail::row_norm(r);
+    rnorm = detail::row_norm(r);
     if (on_iter)
-      on_iter(it + 1, rn, bnorm);
-    done = at::logical_or(done, stop(rn));
+      on_iter(it + 1, rnorm, bnorm);
+    done = at::logical_or(done, stop(rnorm));
   }
 
-  return {x, iters.max().item<int64_t>(), done};
+  return cmp.result(x, iters, done, rnorm);
 }
 
-/// Dispatch to the configured method.
+/// Dispatch to the configured method. `recycle` is GMRES-only; BiCGStab ignores it.
 inline KrylovResult
 krylov_solve(const MatvecFn & matvec,
              const PrecondFn & minv,
              const at::Tensor & b,
              const KrylovConfig & cfg,
-             const LinearLogFn & on_iter = {})
+             const LinearLogFn & on_iter = {},
+             const at::Tensor & rel_tol = {},
+             KrylovRecycle * recycle = nullptr,
+             const KrylovRestrictFn & restrict_ops = {})
 {
-  return cfg.method == KrylovMethod::BiCGStab ? bicgstab(matvec, minv, b, cfg, on_iter)
-                                              : gmres(matvec, minv, b, cfg, on_iter);
+  return cfg.method == KrylovMethod::BiCGStab
+             ? bicgstab(matvec, minv, b, cfg, on_iter, rel_tol, restrict_ops)
+             : gmres(matvec, minv, b, cfg, on_iter, rel_tol, recycle, restrict_ops);
+}
+
+/// Restarted block GMRES(m) for a dense batched operator `A` `(B, N, N)` and a
+/// matrix right-hand side `X0 = 0`, `B` `(B, N, M)` with `M <= N`. All M columns
+/// share one block Arnoldi basis: each step applies `A` to an `(N, M)` block in
+/// one batched matmul, orthogonalizes it against the basis with block CGS2 and
+/// factors it with a QR. The small block-Hessenberg least-squares problem is
+/// re-solved by QR each step for the per-column residual. A column stops
+/// counting once its residual meets the tolerance; the solve stops when every
+/// column of every element has. A block step adds M basis vectors, so the
+/// restart width is capped at `N / M` blocks (the basis must stay orthonormal)
+/// and `max_its` counts block steps. The result carries `du` `(B, N, M)`, and
+/// `converged` / `resid` per column `(B, M)`. No preconditioner: the dense IFT
+/// operator needs none.
+inline KrylovResult
+block_gmres(const at::Tensor & A, const at::Tensor & Bm, const KrylovConfig & cfg)
+{
+  const auto Bf = Bm.size(0);
+  const auto n = Bm.size(1);
+  const auto M = Bm.size(2);
+  const auto opts = Bm.options();
+  const double eps = detail::dtype_eps(Bm.scalar_type());
+  const int64_t m = std::max<int64_t>(1, std::min<int64_t>(cfg.restart, n / M));
+  const int64_t max_restarts = (std::max<int64_t>(cfg.max_its, 1) + m - 1) / m;
+
+  const auto col_norm = [](const at::Tensor & X) { return (X * X).sum(1).sqrt(); }; // (B, M)
+  const auto bnorm = col_norm(Bm).clamp_min(eps);
+  const auto stop = [&](const at::Tensor & rn)
+  { return at::logical_or(rn < cfg.abs_tol, rn / bnorm < cfg.rel_tol); };
+
+  auto X = at::zeros_like(Bm);
+  auto iters = at::zeros({Bf, M}, opts.dtype(at::kLong));
+  at::Tensor rnorm;
+  at::Tensor done;
+  for (int64_t restart = 0; restart < max_restarts; ++restart)
+  {
+    // First cycle: X is zero, so the residual is B (no matmul).
+    const auto R0 = (restart == 0) ? Bm : Bm - at::matmul(A, X);
+    rnorm = col_norm(R0);
+    done = stop(rnorm);
+    if (done.all().item<bool>())
+      break;
+
+    // V holds the (m+1) basis blocks side by side, H the block Hessenberg and G
+    // the projected right-hand side [S0; 0], all `empty` / `zeros` as in gmres.
+    auto V = at::empty({Bf, n, (m + 1) * M}, opts);
+    auto H = at::zeros({Bf, (m + 1) * M, m * M}, opts);
+    auto G = at::zeros({Bf, (m + 1) * M, M}, opts);
+    {
+      auto [Q0, S0] = at::linalg_qr(R0);
+      V.slice(2, 0, M).copy_(Q0);
+      G.slice(1, 0, M).copy_(S0);
+    }
+
+    at::Tensor Qh, Rh, QtG;
+    int64_t jmax = m;
+    for (int64_t j = 0; j < m; ++j)
+    {
+      auto W = at::matmul(A, V.slice(2, j * M, (j + 1) * M)); // (B, n, M)
+      auto Vj = V.slice(2, 0, (j + 1) * M);
+      auto Hcol = H.slice(1, 0, (j + 1) * M).slice(2, j * M, (j + 1) * M);
+      for (int reorth = 0; reorth < 2; ++reorth)
+      {
+        auto h = at::matmul(Vj.transpose(1, 2), W); // (B, (j+1)M, M)
+        W = W - at::matmul(Vj, h);
+        Hcol.add_(h);
+      }
+      // A rank-deficient W (dependent columns, or the space running out) leaves
+      // the QR free to pad Q with directions that are not orthogonal to the
+      // basis. Projecting Q once more and refactoring keeps V orthonormal:
+      // W = Qw Rw = Vj C Rw + Q2 R2 Rw.
+      auto [Qw, Rw] = at::linalg_qr(W);
+      const auto C = at::matmul(Vj.transpose(1, 2), Qw);
+      auto [Q2, R2] = at::linalg_qr(Qw - at::matmul(Vj, C));
+      Hcol.add_(at::matmul(C, Rw));
+      H.slice(1, (j + 1) * M, (j + 2) * M)
+          .slice(2, j * M, (j + 1) * M)
+          .copy_(at::matmul(R2, Rw));
+      V.slice(2, (j + 1) * M, (j + 2) * M).copy_(Q2);
+
+      // Least squares on the built window: min || G - H y ||, per column.
+      std::tie(Qh, Rh) =
+          at::linalg_qr(H.slice(1, 0, (j + 2) * M).slice(2, 0, (j + 1) * M), "complete");
+      QtG = at::matmul(Qh.transpose(1, 2), G.slice(1, 0, (j + 2) * M));
+      const auto resid = col_norm(QtG.slice(1, (j + 1) * M)); // (B, M)
+      const auto running = at::logical_not(done);
+      iters += running.to(at::kLong);
+      rnorm = at::where(running, resid, rnorm);
+      done = at::logical_or(done, stop(resid));
+      if (done.all().item<bool>())
+      {
+        jmax = j + 1;
+        break;
+      }
+    }
+
+    const auto k = jmax * M;
+    auto R = Rh.slice(1, 0, k) + eps * at::eye(k, opts);
+    auto Y = at::linalg_solve_triangular(R,
+                                         QtG.slice(1, 0, k),
+                                         /*upper=*/true,
+                                         /*left=*/true,
+                                         /*unitriangular=*/false); // (B, k, M)
+    X = X + at::matmul(V.slice(2, 0, k), Y);
+  }
+
+  return {X, iters.max().item<int64_t>(), done, rnorm};
 }
 
 /// Solve `A X = B` with the shared Krylov loop over an ALREADY-ASSEMBLED dense
@@ -405,8 +865,9 @@ krylov_solve(const MatvecFn & matvec,
 /// `A` is `(*batch, N, N)`; `B` is `(*batch, N)` (vector RHS) or `(*batch, N, M)`
 /// (matrix RHS), and the return matches `B`'s shape. Leading batch dims are
 /// flattened to one axis for the loop (mirroring the forward Krylov flatten).
-/// Matrix RHS is solved column-by-column -- `M` is a small storage width and each
-/// column reuses the same `A`.
+/// A matrix RHS is solved for all columns at once: GMRES runs `block_gmres` (in
+/// column groups of at most N), BiCGStab folds the columns into the batch so each
+/// of its matvecs is one matmul over every column.
 inline at::Tensor
 krylov_solve_dense(const at::Tensor & A, const at::Tensor & B, const KrylovConfig & cfg)
 {
@@ -422,13 +883,26 @@ krylov_solve_dense(const at::Tensor & A, const at::Tensor & B, const KrylovConfi
     return x.reshape(B.sizes());
   }
 
-  // Matrix RHS (*batch, N, M): solve each column, reassemble.
   const int64_t M = B.size(-1);
   const auto B3 = B.reshape({-1, N, M});
-  std::vector<at::Tensor> cols;
-  cols.reserve(static_cast<std::size_t>(M));
-  for (int64_t j = 0; j < M; ++j)
-    cols.push_back(krylov_solve(matvec, identity, B3.select(-1, j).contiguous(), cfg).du);
-  return at::stack(cols, -1).reshape(B.sizes());
+  if (cfg.method == KrylovMethod::BiCGStab)
+  {
+    // (Bf, N, M) -> (Bf * M, N): one batch row per (element, column).
+    const int64_t Bf = B3.size(0);
+    const MatvecFn matvec_cols = [&A2, Bf, N, M](const at::Tensor & v) -> at::Tensor
+    {
+      const auto V3 = v.reshape({Bf, M, N}).transpose(1, 2);
+      return at::matmul(A2, V3).transpose(1, 2).reshape({-1, N});
+    };
+    const auto b = B3.transpose(1, 2).reshape({-1, N});
+    const auto x = bicgstab(matvec_cols, identity, b, cfg).du;
+    return x.reshape({Bf, M, N}).transpose(1, 2).reshape(B.sizes());
+  }
+
+  // Block GMRES needs M <= N; wider right-hand sides go in groups of N columns.
+  std::vector<at::Tensor> parts;
+  for (int64_t c0 = 0; c0 < M; c0 += N)
+    parts.push_back(block_gmres(A2, B3.narrow(2, c0, std::min(N, M - c0)), cfg).du);
+  return (parts.size() == 1 ? parts.front() : at::cat(parts, -1)).reshape(B.sizes());
 }
 } // namespace neml2::aoti
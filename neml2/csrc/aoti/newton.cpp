@@ -27,13 +27,19 @@
 #include "neml2/csrc/aoti/Exception.h"
 #include "neml2/csrc/aoti/assertions.h"
 #include "neml2/csrc/aoti/log.h"
+#include "neml2/csrc/dispatchers/batch_chunk.h"
 
+#include <algorithm>
+#include <chrono>
 #include <iomanip>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <tuple>
 #include <utility>
 
 #include <ATen/ATen.h>
+#include <c10/util/accumulate.h>
 
 // Alias so the logging namespace does not collide with the local ``log`` vectors
 // (the collect_log buffers) used throughout this file.
@@ -63,11 +69,10 @@ enum class StopStatus
   Diverged = 2,
 };
 
+// Read back the two on-device stop bits at once.
 inline StopStatus
-check_stop(const at::Tensor & b_norm, const at::Tensor & b0_norm, double atol, double rtol)
+read_stop(const at::Tensor & diverged, const at::Tensor & converged)
 {
-  auto diverged = at::any(at::logical_not(at::isfinite(b_norm)));
-  auto converged = at::all(at::logical_or(b_norm < atol, b_norm / b0_norm < rtol));
   // Stack on-device into a (2,) bool tensor and pull both bits over in one
   // d2h memcpy. The two reductions feed the same downstream sync, so this is
   // not strictly more sync than the original single-condition check.
@@ -79,6 +84,22 @@ check_stop(const at::Tensor & b_norm, const at::Tensor & b0_norm, double atol, d
   return StopStatus::Continue;
 }
 
+inline StopStatus
+check_stop(const at::Tensor & b_norm, const at::Tensor & b0_norm, double atol, double rtol)
+{
+  return read_stop(at::any(at::logical_not(at::isfinite(b_norm))),
+                   at::all(at::logical_or(b_norm < atol, b_norm / b0_norm < rtol)));
+}
+
+// The `check_interval` form: converged once every row of the accumulated
+// per-row mask is, diverged if the latest residual has a non-finite row (a
+// non-finite iterate stays non-finite, so none is missed between checks).
+inline StopStatus
+check_stop_mask(const at::Tensor & b_norm, const at::Tensor & converged)
+{
+  return read_stop(at::any(at::logical_not(at::isfinite(b_norm))), at::all(converged));
+}
+
 // Number of trailing axes a per-group tensor carries beyond the dynamic-batch
 // leading axes. BLOCK: sub_batch axes + 1 folded base axis. DENSE: 1.
 int64_t
@@ -160,12 +181,125 @@ alpha_for_group(const at::Tensor & alpha, const GroupLayout & g)
   return out;
 }
 
+// Adds the host wall time of its scope to `*acc`; a null `acc` (stats off)
+// does nothing.
+class ScopedTimer
+{
+public:
+  explicit ScopedTimer(double * acc)
+    : _acc(acc)
+  {
+    if (_acc)
+      _t0 = std::chrono::steady_clock::now();
+  }
+  ~ScopedTimer()
+  {
+    if (_acc)
+      *_acc += std::chrono::duration<double>(std::chrono::steady_clock::now() - _t0).count();
+  }
+  ScopedTimer(const ScopedTimer &) = delete;
+  ScopedTimer & operator=(const ScopedTimer &) = delete;
+
+private:
+  double * _acc;
+  std::chrono::steady_clock::time_point _t0;
+};
+
+// Timed `sys.residual(u)`.
+std::vector<at::Tensor>
+timed_residual(const NonlinearSystem & sys, const std::vector<at::Tensor> & u, NewtonStats * st)
+{
+  const ScopedTimer t(st ? &st->residual_seconds : nullptr);
+  return sys.residual(u);
+}
+
+// Fold a system's inner linear-solve counters into the solve's stats.
+void
+add_linear_counters(NewtonStats * st, const NonlinearSystem & sys)
+{
+  if (!st)
+    return;
+  const auto c = sys.linear_counters();
+  st->matvecs += c.matvecs;
+  st->precond_rebuilds += c.precond_rebuilds;
+}
+
+// Per-iteration convergence trace: emitted on the `newton` channel at debug and
+// appended to `log` (the collect_log data path) when either is on.
+// LCOV_EXCL_START -- diagnostic per-iteration trace (verbosity-gated; see neml2.log)
+void
+trace_iteration(std::size_t i,
+                const at::Tensor & b_norm,
+                const at::Tensor & b0_norm,
+                bool console_debug,
+                std::vector<std::string> * log)
+{
+  if (!console_debug && !log)
+    return;
+  std::ostringstream oss;
+  oss << "ITERATION " << std::setw(3) << i << ", |R| = " << std::scientific
+      << b_norm.max().item<double>() << ", |R0| = " << std::scientific
+      << b0_norm.max().item<double>();
+  if (console_debug)
+    nlog::emit(nlog::Channel::Newton, nlog::Level::Debug, oss.str());
+  if (log)
+    log->push_back(oss.str());
+}
+// LCOV_EXCL_STOP
+
+// The buffer the trial iterate of group `k` is written into: a slot of `bufs`
+// that does not back the current iterate `u`, at the trial's shape. Undefined
+// (take a fresh tensor) without buffers or when the shapes differ.
+at::Tensor
+trial_buffer(const IterateBuffers * bufs,
+             std::size_t k,
+             const at::Tensor & u,
+             const at::Tensor & du)
+{
+  if (!bufs || k >= bufs->groups.size() || !u.sizes().equals(du.sizes()))
+    return {};
+  for (at::Tensor * slot : bufs->groups[k])
+  {
+    if (!slot)
+      continue;
+    if (!slot->defined())
+      *slot = at::empty(du.sizes(), du.options());
+    if (slot->sizes().equals(du.sizes()) && slot->scalar_type() == du.scalar_type() &&
+        !slot->is_alias_of(u))
+      return *slot;
+  }
+  return {};
+}
+
+// u + alpha * du (alpha undefined: a full step) for group `k`, in its trial
+// buffer when `bufs` provides one.
+at::Tensor
+trial_iterate(const IterateBuffers * bufs,
+              std::size_t k,
+              const at::Tensor & u,
+              const at::Tensor & du,
+              const at::Tensor & alpha = {})
+{
+  auto out = trial_buffer(bufs, k, u, du);
+  if (!out.defined())
+    return (alpha.defined() ? u + alpha * du : u + du).contiguous();
+  if (alpha.defined())
+    at::mul_out(out, du, alpha).add_(u);
+  else
+    at::add_out(out, u, du);
+  return out;
+}
+
 // One Newton iteration: from the current iterate `u` and its residual `b_outs`,
 // compute the step, run the optional line search, commit `u` / `b_outs`, and
 // return the new per-element residual norm (dynamic-batch shape). Shared by
 // solve() and solve_masked() so the two differ only in stop/return handling.
 // `log` non-null collects the convergence lines (the collect_log data path);
-// `console_debug` also emits them on the `newton` channel at debug.
+// `console_debug` also emits them on the `newton` channel at debug. Under a
+// check interval k > 1 the line search reads its stop mask back on every k-th
+// trial only (see SolverConfig::check_interval). `stats` non-null times the
+// residual / step calls and counts the line-search trials. `bufs` non-null
+// holds the trial iterates (see IterateBuffers).
 at::Tensor
 newton_iterate(const SolverConfig & cfg,
                const NonlinearSystem & sys,
@@ -177,9 +311,15 @@ newton_iterate(const SolverConfig & cfg,
                std::size_t i,
                bool console_debug,
                std::vector<std::string> * log,
-               const at::Tensor & frozen = {})
+               const at::Tensor & frozen = {},
+               NewtonStats * stats = nullptr,
+               const IterateBuffers * bufs = nullptr)
 {
-  auto step_result = sys.step(u);
+  auto step_result = [&]
+  {
+    const ScopedTimer t(stats ? &stats->step_seconds : nullptr);
+    return sys.step_with_residual(u, b_outs);
+  }();
   std::vector<at::Tensor> & du = step_result.first;
   _assert(du.size() == unknown_layout.size(),
           "Newton: step() returned ",
@@ -205,21 +345,27 @@ newton_iterate(const SolverConfig & cfg,
   if (cfg.ls_max_iters <= 1)
   {
     for (std::size_t k = 0; k < unknown_layout.size(); ++k)
-      u_trial[k] = (u[k] + du[k]).contiguous();
-    b_trial = sys.residual(u_trial);
+      u_trial[k] = trial_iterate(bufs, k, u[k], du[k]);
+    b_trial = timed_residual(sys, u_trial, stats);
     _assert(b_trial.size() == residual_layout.size(),
             "Newton: residual() returned the wrong number of groups");
   }
   else
   {
+    // Between reads of the stop mask, a row that has already stopped keeps its
+    // step length, so further trials reproduce its accepted iterate and the
+    // result is the same as stopping at the first trial that satisfies it.
+    const std::size_t ls_every = std::max<std::size_t>(cfg.check_interval, 1);
     for (std::size_t k_ls = 1; k_ls < cfg.ls_max_iters; ++k_ls)
     {
       for (std::size_t k = 0; k < unknown_layout.size(); ++k)
       {
         const auto alpha_b = alpha_for_group(alpha, unknown_layout[k]);
-        u_trial[k] = (u[k] + alpha_b * du[k]).contiguous();
+        u_trial[k] = trial_iterate(bufs, k, u[k], du[k], alpha_b);
       }
-      b_trial = sys.residual(u_trial);
+      b_trial = timed_residual(sys, u_trial, stats);
+      if (stats)
+        ++stats->linesearch_trials;
       _assert(b_trial.size() == residual_layout.size(),
               "Newton: residual() returned the wrong number of groups");
 
@@ -247,7 +393,7 @@ newton_iterate(const SolverConfig & cfg,
       // LCOV_EXCL_STOP
 
       const auto stop = at::logical_or(nb_trial_sq <= crit, nb_trial_sq <= cfg.atol * cfg.atol);
-      if (stop.all().item<bool>())
+      if (k_ls % ls_every == 0 && k_ls + 1 < cfg.ls_max_iters && stop.all().item<bool>())
         break;
       alpha = at::where(stop, alpha, alpha / cfg.ls_cutback);
     }
@@ -257,19 +403,142 @@ newton_iterate(const SolverConfig & cfg,
   b_outs = std::move(b_trial);
 
   const auto b_norm = pergroup_norm_sq(b_outs, residual_layout).sqrt();
-  // LCOV_EXCL_START -- diagnostic per-iteration trace (verbosity-gated; see neml2.log)
-  if (console_debug || log)
+  trace_iteration(i, b_norm, b0_norm, console_debug, log);
+  return b_norm;
+}
+
+// Anderson history for one solve (SolverConfig::method == "ANDERSON"). Each row
+// is flattened to a vector of N unknowns. The fixed-point map is
+// g(u) = u + beta * b(u), with b = -r, and f = beta * b is its residual. `dg`
+// and `df` hold the last `anderson_depth` differences of g and f as the columns
+// of (Bflat, N, k) tensors.
+struct AndersonHistory
+{
+  at::Tensor g_prev, f_prev;
+  at::Tensor dg, df;
+
+  // Keep rows `idx` only (active-set compaction of solve_masked).
+  void restrict_rows(const at::Tensor & idx)
   {
-    std::ostringstream oss;
-    oss << "ITERATION " << std::setw(3) << i << ", |R| = " << std::scientific
-        << b_norm.max().item<double>() << ", |R0| = " << std::scientific
-        << b0_norm.max().item<double>();
-    if (console_debug)
-      nlog::emit(nlog::Channel::Newton, nlog::Level::Debug, oss.str());
-    if (log)
-      log->push_back(oss.str());
+    for (auto * t : {&g_prev, &f_prev, &dg, &df})
+      if (t->defined())
+        *t = t->index_select(0, idx);
   }
-  // LCOV_EXCL_STOP
+};
+
+// (*B, ...) per-group tensors -> one (Bflat, N) tensor, groups side by side.
+// Unbatched groups (a broadcast initial guess) are expanded to `batch` first.
+at::Tensor
+flatten_rows(const std::vector<at::Tensor> & groups,
+             const std::vector<GroupLayout> & layout,
+             at::IntArrayRef batch)
+{
+  const int64_t bflat = c10::multiply_integers(batch);
+  std::vector<at::Tensor> cols;
+  cols.reserve(groups.size());
+  for (std::size_t k = 0; k < groups.size(); ++k)
+  {
+    const auto & t = groups[k];
+    const auto trail = t.sizes().slice(static_cast<std::size_t>(t.dim() - group_trail(layout[k])));
+    std::vector<int64_t> shape(batch.begin(), batch.end());
+    shape.insert(shape.end(), trail.begin(), trail.end());
+    cols.push_back(t.expand(shape).reshape({bflat, -1}));
+  }
+  return at::cat(cols, 1);
+}
+
+// Inverse of flatten_rows, taking the trailing shape of each group from `like`.
+std::vector<at::Tensor>
+unflatten_rows(const at::Tensor & flat,
+               const std::vector<at::Tensor> & like,
+               const std::vector<GroupLayout> & layout,
+               at::IntArrayRef batch)
+{
+  std::vector<at::Tensor> out;
+  out.reserve(like.size());
+  int64_t off = 0;
+  for (std::size_t k = 0; k < like.size(); ++k)
+  {
+    const auto & t = like[k];
+    const auto trail = t.sizes().slice(static_cast<std::size_t>(t.dim() - group_trail(layout[k])));
+    const int64_t width = c10::multiply_integers(trail);
+    std::vector<int64_t> shape(batch.begin(), batch.end());
+    shape.insert(shape.end(), trail.begin(), trail.end());
+    out.push_back(flat.narrow(1, off, width).reshape(shape).contiguous());
+    off += width;
+  }
+  return out;
+}
+
+// One Anderson iteration, the counterpart of newton_iterate: same arguments
+// and return value, but only residual evaluations and no line search. The
+// mixing coefficients of each row solve the small least-squares problem
+// min ||f - dF gamma|| through its normal equations, batched over the rows.
+// A relative shift of the normal matrix keeps a rank-deficient history (a
+// frozen or stalled row) solvable. Frozen rows keep their iterate.
+at::Tensor
+anderson_iterate(const SolverConfig & cfg,
+                 const NonlinearSystem & sys,
+                 const std::vector<GroupLayout> & unknown_layout,
+                 const std::vector<GroupLayout> & residual_layout,
+                 std::vector<at::Tensor> & u,
+                 std::vector<at::Tensor> & b_outs,
+                 const at::Tensor & b0_norm,
+                 std::size_t i,
+                 bool console_debug,
+                 std::vector<std::string> * log,
+                 AndersonHistory & hist,
+                 const at::Tensor & frozen = {},
+                 NewtonStats * stats = nullptr)
+{
+  const auto batch = b0_norm.sizes();
+  const auto uf = flatten_rows(u, unknown_layout, batch);
+  const auto f = cfg.anderson_beta * flatten_rows(b_outs, residual_layout, batch);
+  _assert(uf.size(1) == f.size(1),
+          "Anderson: the residual has ",
+          f.size(1),
+          " entries per row but the unknowns have ",
+          uf.size(1),
+          "; the fixed-point iteration needs one residual per unknown");
+  const auto g = uf + f;
+
+  if (hist.g_prev.defined())
+  {
+    const auto dg = (g - hist.g_prev).unsqueeze(-1);
+    const auto df = (f - hist.f_prev).unsqueeze(-1);
+    hist.dg = hist.dg.defined() ? at::cat({hist.dg, dg}, -1) : dg;
+    hist.df = hist.df.defined() ? at::cat({hist.df, df}, -1) : df;
+    const auto depth = static_cast<int64_t>(std::max<std::size_t>(cfg.anderson_depth, 1));
+    if (hist.df.size(-1) > depth)
+    {
+      hist.dg = hist.dg.narrow(-1, hist.dg.size(-1) - depth, depth);
+      hist.df = hist.df.narrow(-1, hist.df.size(-1) - depth, depth);
+    }
+  }
+  hist.g_prev = g;
+  hist.f_prev = f;
+
+  auto u_next = g;
+  if (hist.df.defined())
+  {
+    const auto dft = hist.df.transpose(-1, -2);
+    auto gram = at::matmul(dft, hist.df);
+    const auto k = gram.size(-1);
+    const auto scale = gram.diagonal(0, -2, -1).sum(-1).view({-1, 1, 1});
+    gram = gram + (1e-10 * scale + 1e-30) * at::eye(k, gram.options());
+    const auto gamma = std::get<0>(at::linalg_solve_ex(gram, at::matmul(dft, f.unsqueeze(-1))));
+    u_next = g - at::matmul(hist.dg, gamma).squeeze(-1);
+  }
+  if (frozen.defined())
+    u_next = at::where(frozen.reshape({-1, 1}), uf, u_next);
+
+  u = unflatten_rows(u_next, u, unknown_layout, batch);
+  b_outs = timed_residual(sys, u, stats);
+  _assert(b_outs.size() == residual_layout.size(),
+          "Anderson: residual() returned the wrong number of groups");
+
+  const auto b_norm = pergroup_norm_sq(b_outs, residual_layout).sqrt();
+  trace_iteration(i, b_norm, b0_norm, console_debug, log);
   return b_norm;
 }
 
@@ -297,10 +566,16 @@ convergence_reason(const at::Tensor & b_norm, const at::Tensor & b0_norm, double
 Newton::Newton(SolverConfig cfg)
   : _cfg(std::move(cfg))
 {
+  _assert(_cfg.method == "NEWTON" || _cfg.method == "ANDERSON",
+          "SolverConfig::method must be NEWTON or ANDERSON, got '",
+          _cfg.method,
+          "'");
 }
 
 NewtonResult
-Newton::solve(const NonlinearSystem & sys, const std::vector<at::Tensor> & u0) const
+Newton::solve(const NonlinearSystem & sys,
+              const std::vector<at::Tensor> & u0,
+              const IterateBuffers * bufs) const
 {
   const auto & unknown_layout = sys.unknown_layout();
   const auto & residual_layout = sys.residual_layout();
@@ -319,7 +594,9 @@ Newton::solve(const NonlinearSystem & sys, const std::vector<at::Tensor> & u0) c
   for (const auto & t : u0)
     u.push_back(t.contiguous());
 
-  auto b_outs = sys.residual(u);
+  NewtonStats stats;
+  NewtonStats * st = _cfg.collect_stats ? &stats : nullptr;
+  auto b_outs = timed_residual(sys, u, st);
   _assert(b_outs.size() == residual_layout.size(),
           "Newton::solve: residual() returned ",
           b_outs.size(),
@@ -327,6 +604,13 @@ Newton::solve(const NonlinearSystem & sys, const std::vector<at::Tensor> & u0) c
           residual_layout.size(),
           ")");
   auto b0_norm = pergroup_norm_sq(b_outs, residual_layout).sqrt();
+  // collect_stats: the rows converged so far, for the per-row iteration count.
+  at::Tensor settled;
+  if (st)
+  {
+    stats.row_iterations = at::zeros_like(b0_norm, b0_norm.options().dtype(at::kLong));
+    settled = b0_norm < _cfg.atol;
+  }
 
   const bool console_debug = nlog::enabled(nlog::Channel::Newton, nlog::Level::Debug);
   const bool console_info = nlog::enabled(nlog::Channel::Newton, nlog::Level::Info);
@@ -363,15 +647,66 @@ Newton::solve(const NonlinearSystem & sys, const std::vector<at::Tensor> & u0) c
       nlog::end_solve(nlog::Channel::Newton, "newton solve");
     }
     // LCOV_EXCL_STOP
-    return {
-        std::move(u), /*converged=*/true, /*converged_mask=*/{}, /*iterations=*/0, std::move(log)};
+    return {std::move(u),
+            /*converged=*/true,
+            /*converged_mask=*/{},
+            /*iterations=*/0,
+            std::move(log),
+            std::move(stats)};
   }
 
+  // With a check interval k > 1 the loop runs k updates between host syncs. A
+  // device-side mask accumulates the rows that have converged, and those rows
+  // are frozen (as in solve_masked) so they stay put until the next check.
+  const std::size_t every = std::max<std::size_t>(_cfg.check_interval, 1);
+  at::Tensor frozen;
+  const bool anderson = _cfg.method == "ANDERSON";
+  AndersonHistory hist;
   for (std::size_t i = 1; i < _cfg.miters; ++i)
   {
-    const auto b_norm = newton_iterate(
-        _cfg, sys, unknown_layout, residual_layout, u, b_outs, b0_norm, i, console_debug, logp);
-    const auto status = check_stop(b_norm, b0_norm, _cfg.atol, _cfg.rtol);
+    if (st)
+      stats.row_iterations += at::logical_not(settled).to(at::kLong);
+    const auto b_norm =
+        anderson ? anderson_iterate(_cfg,
+                                    sys,
+                                    unknown_layout,
+                                    residual_layout,
+                                    u,
+                                    b_outs,
+                                    b0_norm,
+                                    i,
+                                    console_debug,
+                                    logp,
+                                    hist,
+                                    frozen,
+                                    st)
+                 : newton_iterate(_cfg,
+                                  sys,
+                                  unknown_layout,
+                                  residual_layout,
+                                  u,
+                                  b_outs,
+                                  b0_norm,
+                                  i,
+                                  console_debug,
+                                  logp,
+                                  frozen,
+                                  st,
+                                  bufs);
+    if (st)
+      settled = at::logical_or(
+          settled, at::logical_or(b_norm < _cfg.atol, b_norm / b0_norm < _cfg.rtol));
+    StopStatus status;
+    if (every == 1)
+      status = check_stop(b_norm, b0_norm, _cfg.atol, _cfg.rtol);
+    else
+    {
+      const auto conv = at::logical_or(b_norm < _cfg.atol, b_norm / b0_norm < _cfg.rtol);
+      frozen = frozen.defined() ? at::logical_or(frozen, conv) : conv;
+      if (i % every != 0 && i + 1 < _cfg.miters)
+        continue;
+      status = check_stop_mask(b_norm, frozen);
+    }
     if (status == StopStatus::Diverged)
     {
       // LCOV_EXCL_START -- diagnostic divergence summary
@@ -399,11 +734,13 @@ Newton::solve(const NonlinearSystem & sys, const std::vector<at::Tensor> & u0) c
         nlog::end_solve(nlog::Channel::Newton, "newton solve");
       }
       // LCOV_EXCL_STOP
+      add_linear_counters(st, sys);
       return {std::move(u),
               /*converged=*/true,
               /*converged_mask=*/{},
               /*iterations=*/i,
-              std::move(log)};
+              std::move(log),
+              std::move(stats)};
     }
   }
 
@@ -434,7 +771,9 @@ Newton::solve(const NonlinearSystem & sys, const std::vector<at::Tensor> & u0) c
 }
 
 NewtonResult
-Newton::solve_masked(const NonlinearSystem & sys, const std::vector<at::Tensor> & u0) const
+Newton::solve_masked(const NonlinearSystem & sys,
+                     const std::vector<at::Tensor> & u0,
+                     const IterateBuffers * bufs) const
 {
   const auto & unknown_layout = sys.unknown_layout();
   const auto & residual_layout = sys.residual_layout();
@@ -450,7 +789,9 @@ Newton::solve_masked(const NonlinearSystem & sys, const std::vector<at::Tensor>
   for (const auto & t : u0)
     u.push_back(t.contiguous());
 
-  auto b_outs = sys.residual(u);
+  NewtonStats stats;
+  NewtonStats * st = _cfg.collect_stats ? &stats : nullptr;
+  auto b_outs = timed_residual(sys, u, st);
   _assert(b_outs.size() == residual_layout.size(),
           "Newton::solve_masked: residual() returned ",
           b_outs.size(),
@@ -458,6 +799,8 @@ Newton::solve_masked(const NonlinearSystem & sys, const std::vector<at::Tensor>
           residual_layout.size(),
           ")");
   auto b0_norm = pergroup_norm_sq(b_outs, residual_layout).sqrt();
+  if (st)
+    stats.row_iterations = at::zeros_like(b0_norm, b0_norm.options().dtype(at::kLong));
 
   const bool console_debug = nlog::enabled(nlog::Channel::Newton, nlog::Level::Debug);
   const bool collect = _cfg.collect_log;
@@ -494,29 +837,79 @@ Newton::solve_masked(const NonlinearSystem & sys, const std::vector<at::Tensor>
   // so predictor-convergence reduces to the absolute test.
   auto converged = b0_norm < _cfg.atol;
   if (at::all(converged).item<bool>())
-    return {std::move(u), /*converged=*/true, converged, /*iterations=*/0, std::move(log)};
+    return {std::move(u),
+            /*converged=*/true,
+            converged,
+            /*iterations=*/0,
+            std::move(log),
+            std::move(stats)};
 
   std::size_t reached = 0;
   // Rows converged in a prior iteration are frozen (their Newton step is zeroed)
   // so they stay bit-identical to a solo solve while the rest keep iterating.
+  // The all-done test is read back every `check_interval` iterations only.
+  const std::size_t every = std::max<std::size_t>(_cfg.check_interval, 1);
   at::Tensor frozen;
+
+  // Active-set compaction (`compact_fraction`). Once enough rows are done, the
+  // loop continues on a system restricted to the rest: `cur` is that system,
+  // `rows` maps its rows into the full batch (undefined before the first
+  // compaction), and `u_all` / `conv_all` hold the full-batch results the
+  // finished rows are left in. Only a single dynamic batch axis is compacted.
+  bool compact = _cfg.compact_fraction > 0 && b0_norm.dim() == 1;
+  const NonlinearSystem * cur = &sys;
+  std::unique_ptr<NonlinearSystem> owned;
+  at::Tensor rows;
+  std::vector<at::Tensor> u_all;
+  at::Tensor conv_all;
+
+  const bool anderson = _cfg.method == "ANDERSON";
+  AndersonHistory hist;
   for (std::size_t i = 1; i < _cfg.miters; ++i)
   {
     // Snapshot the iterate so the committed step ||du|| = ||u_new - u_prev|| can
-    // gate the relative-convergence branch. `newton_iterate` rebuilds `u` from
-    // fresh tensors (u = move(u_trial)), so `u_prev` keeps the old values.
+    // gate the relative-convergence branch. Both iterations rebuild `u` from
+    // tensors other than the current ones (u = move(u_trial); a trial buffer is
+    // never the one backing `u`), so `u_prev` keeps the old values.
     std::vector<at::Tensor> u_prev = u;
-    const auto b_norm = newton_iterate(_cfg,
-                                       sys,
-                                       unknown_layout,
-                                       residual_layout,
-                                       u,
-                                       b_outs,
-                                       b0_norm,
-                                       i,
-                                       console_debug,
-                                       logp,
-                                       frozen);
+    if (st)
+    {
+      // Every row not frozen by an earlier iteration takes this one. After a
+      // compaction the counts land on the full-batch rows they belong to.
+      const auto running = frozen.defined() ? at::logical_not(frozen).to(at::kLong)
+                                            : at::ones_like(stats.row_iterations);
+      if (rows.defined())
+        stats.row_iterations.index_add_(0, rows, running);
+      else
+        stats.row_iterations += running;
+    }
+    const auto b_norm =
+        anderson ? anderson_iterate(_cfg,
+                                    *cur,
+                                    unknown_layout,
+                                    residual_layout,
+                                    u,
+                                    b_outs,
+                                    b0_norm,
+                                    i,
+                                    console_debug,
+                                    logp,
+                                    hist,
+                                    frozen,
+                                    st)
+                 : newton_iterate(_cfg,
+                                  *cur,
+                                  unknown_layout,
+                                  residual_layout,
+                                  u,
+                                  b_outs,
+                                  b0_norm,
+                                  i,
+                                  console_debug,
+                                  logp,
+                                  frozen,
+                                  st,
+                                  bufs);
     reached = i;
     std::vector<at::Tensor> du(u.size());
     for (std::size_t k = 0; k < u.size(); ++k)
@@ -525,14 +918,72 @@ Newton::solve_masked(const NonlinearSystem & sys, const std::vector<at::Tensor>
     const auto u_norm = pergroup_norm_sq(u, unknown_layout).sqrt();
     converged = per_elem_converged(b_norm, du_norm, u_norm);
     frozen = frozen.defined() ? at::logical_or(frozen, converged) : converged;
+    if (i % every != 0)
+      continue;
     // Stop once every row is converged or non-finite: a non-finite row cannot
     // recover, so iterating further only wastes work on the (sliced) batch.
     const auto done = at::logical_or(converged, at::logical_not(at::isfinite(b_norm)));
-    if (at::all(done).item<bool>())
+    if (!compact)
+    {
+      if (at::all(done).item<bool>())
+        break;
+      continue;
+    }
+
+    // The compacting form reads the done count instead, in the same one sync.
+    const int64_t n = done.size(0);
+    const int64_t n_done = done.sum().item<int64_t>();
+    if (n_done == n)
       break;
+    if (n_done == 0 || static_cast<double>(n_done) < _cfg.compact_fraction * static_cast<double>(n))
+      continue;
+    const auto keep = at::logical_not(done).nonzero().squeeze(-1);
+    auto sub = cur->restrict_rows(keep, n);
+    if (!sub)
+    {
+      compact = false; // this backend cannot be restricted; stay on the full batch
+      continue;
+    }
+    if (rows.defined())
+    {
+      scatter_batch_(u_all, rows, u);
+      conv_all.index_copy_(0, rows, converged);
+      rows = rows.index_select(0, keep);
+    }
+    else
+    {
+      u_all = u;
+      conv_all = converged;
+      rows = keep;
+    }
+    u = index_select_batch(u, keep, n);
+    b_outs = index_select_batch(b_outs, keep, n);
+    b0_norm = b0_norm.index_select(0, keep);
+    frozen = frozen.index_select(0, keep);
+    converged = converged.index_select(0, keep);
+    hist.restrict_rows(keep);
+    add_linear_counters(st, *cur);
+    owned = std::move(sub);
+    cur = owned.get();
+    // LCOV_EXCL_START -- diagnostic compaction trace
+    if (console_debug)
+      nlog::emit(nlog::Channel::Newton,
+                 nlog::Level::Debug,
+                 "compacted to " + std::to_string(n - n_done) + " of " + std::to_string(n) +
+                     " rows at iter " + std::to_string(i));
+    // LCOV_EXCL_STOP
+  }
+
+  if (rows.defined())
+  {
+    scatter_batch_(u_all, rows, u);
+    conv_all.index_copy_(0, rows, converged);
+    u = std::move(u_all);
+    converged = conv_all;
   }
 
+  add_linear_counters(st, *cur);
   const bool all = at::all(converged).item<bool>();
-  return {std::move(u), all, converged, reached, std::move(log)};
+  return {std::move(u), all, converged, reached, std::move(log), std::move(stats)};
 }
 } // namespace neml2::aoti
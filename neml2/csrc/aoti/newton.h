@@ -30,6 +30,7 @@
 // point: one iteration-control implementation shared by the compiled (AOTI) and
 // (eventually) eager paths.
 
+#include <array>
 #include <cstddef>
 #include <string>
 #include <vector>
@@ -46,6 +47,21 @@ class NonlinearSystem;
 // SolverConfig (the Newton tunables) is the public type declared in Model.h --
 // it is also the argument to Model::set_solver_config.
 
+/// Work counters of one solve, filled only when ``SolverConfig::collect_stats``
+/// is set. The seconds are host wall time around the ``residual`` and
+/// ``step`` calls. ``row_iterations`` counts, per dynamic-batch element, the
+/// iterations run before that element converged; it is accumulated on the
+/// device and never read back here.
+struct NewtonStats
+{
+  std::size_t linesearch_trials = 0;
+  std::size_t matvecs = 0;
+  std::size_t precond_rebuilds = 0;
+  double residual_seconds = 0.0;
+  double step_seconds = 0.0;
+  at::Tensor row_iterations;
+};
+
 /// Outcome of a *successful* Newton solve: the converged per-unknown-group
 /// iterate and the iteration count. ``converged`` is always ``true`` here --
 /// failure (divergence or hitting ``miters``) throws ``ConvergenceError`` rather
@@ -67,6 +83,19 @@ struct NewtonResult
   /// trace the ``newton`` log channel emits at debug (see log.h), so a Python
   /// caller can capture the same convergence history as data.
   std::vector<std::string> log;
+  NewtonStats stats;
+};
+
+/// Caller-owned storage for the trial iterates of one solve (`Model::Workspace`).
+/// Each unknown group has two buffer slots the Newton trials alternate between,
+/// so a trial never overwrites the accepted iterate it starts from. An empty
+/// slot is filled on first use and kept; a trial of another shape (active-set
+/// compaction) gets a fresh tensor. The returned iterate may live in these
+/// buffers, so the caller copies it out before solving on them again. The
+/// Anderson update builds its iterates from the mixing and does not use them.
+struct IterateBuffers
+{
+  std::vector<std::array<at::Tensor *, 2>> groups;
 };
 
 /// Per-group Newton-Raphson solver with optional backtracking line search.
@@ -75,6 +104,8 @@ struct NewtonResult
 /// exhausting ``miters`` without converging -- throw ``ConvergenceError`` (a
 /// *recoverable* error: a time-stepping consumer can cut its step and retry).
 /// The all-reduce means a solve fails if *any* batch member is unconverged.
+/// With ``SolverConfig::method == "ANDERSON"`` the same loops run Anderson
+/// acceleration on the residual alone in place of the Newton step.
 ///
 /// AOTI_EXPORT: this class is part of the shared library's public ABI so the
 /// pybind layer (a separate module) can construct + drive it for the eager path.
@@ -86,7 +117,10 @@ public:
   /// Solve ``r(u) = 0`` starting from ``u0`` (per unknown group). Set
   /// ``NEML2_LOGS=newton=info`` for a per-solve summary (banners + convergence
   /// reason) or ``=debug`` for per-iteration detail; see log.h.
-  NewtonResult solve(const NonlinearSystem & sys, const std::vector<at::Tensor> & u0) const;
+  /// ``bufs`` (optional) receives the trial iterates instead of fresh tensors.
+  NewtonResult solve(const NonlinearSystem & sys,
+                     const std::vector<at::Tensor> & u0,
+                     const IterateBuffers * bufs = nullptr) const;
 
   /// Masking variant: run to ``miters`` (or until every element is converged or
   /// non-finite) and return the **per-element** convergence mask in
@@ -96,7 +130,9 @@ public:
   /// freeze converged elements and bisect only the failing subset. Elements are
   /// decoupled along the dynamic batch, so a non-finite row never pollutes the
   /// others.
-  NewtonResult solve_masked(const NonlinearSystem & sys, const std::vector<at::Tensor> & u0) const;
+  NewtonResult solve_masked(const NonlinearSystem & sys,
+                            const std::vector<at::Tensor> & u0,
+                            const IterateBuffers * bufs = nullptr) const;
 
 private:
   SolverConfig _cfg;
@@ -31,7 +31,9 @@
 // parameters are bound at construction; only the unknowns vary across Newton
 // iterations.
 
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -54,6 +56,14 @@ struct GroupLayout
   std::vector<int64_t> sub_batch_shape;
 };
 
+/// Work done by a system's inner linear solves since it was built. Only the
+/// iterative (Krylov) backends report anything; a direct solve is one graph.
+struct LinearSolveCounters
+{
+  std::size_t matvecs = 0;
+  std::size_t precond_rebuilds = 0;
+};
+
 /// Abstract residual/step provider. All tensors are per-group, following the
 /// AssembledVector convention: BLOCK groups are ``(*B, *sub_batch, base_total)``
 /// and DENSE groups are ``(*B, group_total)``.
@@ -78,8 +88,33 @@ public:
   virtual std::pair<std::vector<at::Tensor>, std::vector<at::Tensor>>
   step(const std::vector<at::Tensor> & u) const = 0;
 
+  /// ``step`` when the caller already holds ``b``, the residual at ``u`` (the
+  /// Newton loop always does). A system that can reuse an assembled Jacobian
+  /// then only needs the solve. The default ignores ``b`` and calls ``step``.
+  virtual std::pair<std::vector<at::Tensor>, std::vector<at::Tensor>>
+  step_with_residual(const std::vector<at::Tensor> & u, const std::vector<at::Tensor> & b) const;
+
   /// Per-group layouts (in declared order) for the unknown and residual sides.
   virtual const std::vector<GroupLayout> & unknown_layout() const = 0;
   virtual const std::vector<GroupLayout> & residual_layout() const = 0;
+
+  /// The same system restricted to rows ``idx`` (1-D int64) of a dynamic batch
+  /// of ``batch`` rows. Bound tensors whose leading extent is not ``batch`` are
+  /// broadcast and pass through whole. ``Newton::solve_masked`` uses this to drop
+  /// finished rows mid-solve (see ``SolverConfig::compact_fraction``). Returns
+  /// null by default, which keeps the solve on the full batch.
+  virtual std::unique_ptr<NonlinearSystem> restrict_rows(const at::Tensor & idx,
+                                                         int64_t batch) const;
+
+  /// Inner linear-solve counters (see ``LinearSolveCounters``), read by the
+  /// Newton solver for ``SolverConfig::collect_stats``. Zero by default.
+  virtual LinearSolveCounters linear_counters() const { return {}; }
+
+  /// Per-element state the inner linear solves carry from one solve to the next
+  /// (the GMRES recycle space, see ``KrylovRecycle``): undefined when there is
+  /// none. A caller that solves the same batch again can pass it to the next
+  /// system through ``seed_recycle_space``, which is a no-op by default.
+  virtual at::Tensor recycle_space() const { return {}; }
+  virtual void seed_recycle_space(const at::Tensor & /*U*/) {}
 };
 } // namespace neml2::aoti
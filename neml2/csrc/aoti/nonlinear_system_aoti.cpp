@@ -24,6 +24,7 @@
 
 #include "neml2/csrc/aoti/nonlinear_system_aoti.h"
 #include "neml2/csrc/aoti/assertions.h"
+#include "neml2/csrc/dispatchers/batch_chunk.h"
 
 #include <cstddef>
 #include <utility>
@@ -35,21 +36,43 @@ namespace neml2::aoti
 // Out-of-line dtor anchors the NonlinearSystem vtable in this TU.
 NonlinearSystem::~NonlinearSystem() = default;
 
-AOTINonlinearSystem::AOTINonlinearSystem(torch::inductor::AOTIModelPackageLoader & residual_loader,
-                                         torch::inductor::AOTIModelPackageLoader & jacobian_loader,
-                                         torch::inductor::AOTIModelPackageLoader & solve_loader,
-                                         std::vector<GroupLayout> unknown_layout,
-                                         std::vector<GroupLayout> residual_layout,
-                                         std::vector<at::Tensor> g_groups,
-                                         std::vector<at::Tensor> params)
+std::unique_ptr<NonlinearSystem>
+NonlinearSystem::restrict_rows(const at::Tensor & /*idx*/, int64_t /*batch*/) const
+{
+  return nullptr;
+}
+
+std::pair<std::vector<at::Tensor>, std::vector<at::Tensor>>
+NonlinearSystem::step_with_residual(const std::vector<at::Tensor> & u,
+                                    const std::vector<at::Tensor> & /*b*/) const
+{
+  return step(u);
+}
+
+AOTINonlinearSystem::AOTINonlinearSystem(
+    torch::inductor::AOTIModelPackageLoader & residual_loader,
+    torch::inductor::AOTIModelPackageLoader & jacobian_loader,
+    torch::inductor::AOTIModelPackageLoader & solve_loader,
+    std::vector<GroupLayout> unknown_layout,
+    std::vector<GroupLayout> residual_layout,
+    std::vector<at::Tensor> g_groups,
+    std::vector<at::Tensor> params,
+    std::size_t jacobian_refresh,
+    torch::inductor::AOTIModelPackageLoader * factor_loader,
+    torch::inductor::AOTIModelPackageLoader * solve_factored_loader)
   : _residual_loader(residual_loader),
     _jacobian_loader(jacobian_loader),
     _solve_loader(solve_loader),
     _unknown_layout(std::move(unknown_layout)),
     _residual_layout(std::move(residual_layout)),
     _g(std::move(g_groups)),
-    _params(std::move(params))
+    _params(std::move(params)),
+    _jacobian_refresh(jacobian_refresh),
+    _factor_loader(factor_loader),
+    _solve_factored_loader(solve_factored_loader)
 {
+  _assert(!_factor_loader == !_solve_factored_loader,
+          "AOTINonlinearSystem: the factor and solve_factored graphs come as a pair.");
 }
 
 std::vector<at::Tensor>
@@ -72,8 +95,60 @@ AOTINonlinearSystem::residual(const std::vector<at::Tensor> & u) const
   return _residual_loader.run(build_inputs(u));
 }
 
+bool
+AOTINonlinearSystem::needs_assembly() const
+{
+  const bool assemble = (_A.empty() && _factors.empty()) ||
+                        (_jacobian_refresh > 0 && _steps % _jacobian_refresh == 0);
+  ++_steps;
+  return assemble;
+}
+
+std::vector<at::Tensor>
+AOTINonlinearSystem::solve_cached(const std::vector<at::Tensor> & b) const
+{
+  const auto & kept = _factors.empty() ? _A : _factors;
+  std::vector<at::Tensor> inputs;
+  inputs.reserve(kept.size() + b.size());
+  for (const auto & t : kept)
+    inputs.push_back(t);
+  for (const auto & t : b)
+    inputs.push_back(t.contiguous());
+  auto du = _factors.empty() ? _solve_loader.run(inputs) : _solve_factored_loader->run(inputs);
+  _assert(du.size() == _unknown_layout.size(),
+          "AOTINonlinearSystem::step: solve loader returned ",
+          du.size(),
+          " tensors, expected one per unknown group (",
+          _unknown_layout.size(),
+          ")");
+  return du;
+}
+
+std::pair<std::vector<at::Tensor>, std::vector<at::Tensor>>
+AOTINonlinearSystem::step_with_residual(const std::vector<at::Tensor> & u,
+                                        const std::vector<at::Tensor> & b) const
+{
+  // Between refreshes the cached A blocks are solved against the residual the
+  // caller already has: one solve graph call and no assembly.
+  if (!needs_assembly())
+    return {solve_cached(b), b};
+  return assemble_and_solve(u);
+}
+
 std::pair<std::vector<at::Tensor>, std::vector<at::Tensor>>
 AOTINonlinearSystem::step(const std::vector<at::Tensor> & u) const
+{
+  if (!needs_assembly())
+  {
+    auto b = residual(u);
+    auto du = solve_cached(b);
+    return {std::move(du), std::move(b)};
+  }
+  return assemble_and_solve(u);
+}
+
+std::pair<std::vector<at::Tensor>, std::vector<at::Tensor>>
+AOTINonlinearSystem::assemble_and_solve(const std::vector<at::Tensor> & u) const
 {
   // Chain the operator + solve graphs (no solver algebra here):
   //   jacobian: (*u, *g, *p) -> (*A_blocks, *b_groups)  [n_r*n_u A blocks + n_r b]
@@ -91,6 +166,22 @@ AOTINonlinearSystem::step(const std::vector<at::Tensor> & u) const
           n_r * n_u + n_r,
           ")");
 
+  // b_groups are the last n_r outputs of the jacobian graph.
+  std::vector<at::Tensor> b(jac_outs.end() - static_cast<std::ptrdiff_t>(n_r), jac_outs.end());
+
+  // Under Jacobian reuse, factor once here and keep the factors, so this step
+  // and the ones until the next refresh all solve with them. The split graphs
+  // cover a single residual x unknown group (one A block).
+  if (_jacobian_refresh != 1 && _factor_loader)
+  {
+    _factors = _factor_loader->run({jac_outs.front()});
+    _assert(_factors.size() == 2,
+            "AOTINonlinearSystem::step: factor loader returned ",
+            _factors.size(),
+            " tensors, expected (LU, pivots)");
+    return {solve_cached(b), std::move(b)};
+  }
+
   auto du = _solve_loader.run(jac_outs);
   _assert(du.size() == n_u,
           "AOTINonlinearSystem::step: solve loader returned ",
@@ -99,8 +190,28 @@ AOTINonlinearSystem::step(const std::vector<at::Tensor> & u) const
           n_u,
           ")");
 
-  // b_groups are the last n_r outputs of the jacobian graph.
-  std::vector<at::Tensor> b(jac_outs.end() - static_cast<std::ptrdiff_t>(n_r), jac_outs.end());
+  // Without the split graphs, keep the A blocks for the steps that reuse them
+  // (the solve graph then factors them again on every call).
+  if (_jacobian_refresh != 1)
+    _A.assign(jac_outs.begin(), jac_outs.begin() + static_cast<std::ptrdiff_t>(n_r * n_u));
+
   return {std::move(du), std::move(b)};
 }
+
+std::unique_ptr<NonlinearSystem>
+AOTINonlinearSystem::restrict_rows(const at::Tensor & idx, int64_t batch) const
+{
+  // The kept factors / A blocks are not carried over: the restricted system
+  // assembles on its first step.
+  return std::make_unique<AOTINonlinearSystem>(_residual_loader,
+                                               _jacobian_loader,
+                                               _solve_loader,
+                                               _unknown_layout,
+                                               _residual_layout,
+                                               index_select_batch(_g, idx, batch),
+                                               index_select_batch(_params, idx, batch),
+                                               _jacobian_refresh,
+                                               _factor_loader,
+                                               _solve_factored_loader);
+}
 } // namespace neml2::aoti
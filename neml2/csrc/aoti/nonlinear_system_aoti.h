@@ -32,8 +32,15 @@
 // from the private `Model::Impl`/`Segment` -- the owning Impl member builds the
 // layouts and hands over the three loaders. Givens and the promoted-parameter
 // tail are bound once at construction (constant across the solve); only the
-// unknowns vary per iteration.
+// unknowns vary per iteration. With a Jacobian refresh interval other than 1
+// (`SolverConfig::jacobian_refresh`) the Jacobian is kept between steps and only
+// re-assembled on refresh (modified / chord Newton). When the segment carries the
+// split `factor` (`(A) -> (LU, pivots)`) and `solve_factored`
+// (`(LU, pivots, b) -> (du)`) graphs, what is kept is the LU factorization, so a
+// step between refreshes is a pair of triangular solves; otherwise the A blocks
+// are kept and the solve graph factors them again on every step.
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 
@@ -54,23 +61,43 @@ public:
   /// ``residual_loader``/``jacobian_loader``/``solve_loader`` must outlive this
   /// system (owned by the segment). ``g_groups`` are the per-group given tensors;
   /// ``params`` is the promoted-parameter tail in graph-call order.
+  /// ``jacobian_refresh`` is the number of steps between Jacobian assemblies
+  /// (1 = every step, 0 = the first step only). ``factor_loader`` /
+  /// ``solve_factored_loader`` are the split LU graphs, both null when the
+  /// segment has none (or the Jacobian is not reused).
   AOTINonlinearSystem(torch::inductor::AOTIModelPackageLoader & residual_loader,
                       torch::inductor::AOTIModelPackageLoader & jacobian_loader,
                       torch::inductor::AOTIModelPackageLoader & solve_loader,
                       std::vector<GroupLayout> unknown_layout,
                       std::vector<GroupLayout> residual_layout,
                       std::vector<at::Tensor> g_groups,
-                      std::vector<at::Tensor> params);
+                      std::vector<at::Tensor> params,
+                      std::size_t jacobian_refresh = 1,
+                      torch::inductor::AOTIModelPackageLoader * factor_loader = nullptr,
+                      torch::inductor::AOTIModelPackageLoader * solve_factored_loader = nullptr);
 
   std::vector<at::Tensor> residual(const std::vector<at::Tensor> & u) const override;
   std::pair<std::vector<at::Tensor>, std::vector<at::Tensor>>
   step(const std::vector<at::Tensor> & u) const override;
+  std::pair<std::vector<at::Tensor>, std::vector<at::Tensor>>
+  step_with_residual(const std::vector<at::Tensor> & u,
+                     const std::vector<at::Tensor> & b) const override;
   const std::vector<GroupLayout> & unknown_layout() const override { return _unknown_layout; }
   const std::vector<GroupLayout> & residual_layout() const override { return _residual_layout; }
+  std::unique_ptr<NonlinearSystem> restrict_rows(const at::Tensor & idx,
+                                                 int64_t batch) const override;
 
 private:
   /// Loader-call input list: ``(*u_groups, *g_groups, *params)``.
   std::vector<at::Tensor> build_inputs(const std::vector<at::Tensor> & u) const;
+  /// The full step: assemble through the jacobian graph, then solve.
+  std::pair<std::vector<at::Tensor>, std::vector<at::Tensor>>
+  assemble_and_solve(const std::vector<at::Tensor> & u) const;
+  /// Whether the next step re-assembles the Jacobian (advances the step count).
+  bool needs_assembly() const;
+  /// Solve against the kept Jacobian and the given residual groups: through the
+  /// cached factors when there are any, else the solve graph on the A blocks.
+  std::vector<at::Tensor> solve_cached(const std::vector<at::Tensor> & b) const;
 
   torch::inductor::AOTIModelPackageLoader & _residual_loader;
   torch::inductor::AOTIModelPackageLoader & _jacobian_loader;
@@ -79,5 +106,14 @@ private:
   std::vector<GroupLayout> _residual_layout;
   std::vector<at::Tensor> _g;
   std::vector<at::Tensor> _params;
+  std::size_t _jacobian_refresh;
+  torch::inductor::AOTIModelPackageLoader * _factor_loader;
+  torch::inductor::AOTIModelPackageLoader * _solve_factored_loader;
+  // Jacobian reuse state for one Newton solve: the system is constructed fresh
+  // per `_run_implicit_segment` call, so `mutable` here resets each solve. One of
+  // the two is kept: the LU factors (`(LU, pivots)`) or the A blocks.
+  mutable std::vector<at::Tensor> _factors;
+  mutable std::vector<at::Tensor> _A;
+  mutable std::size_t _steps = 0;
 };
 } // namespace neml2::aoti
@@ -41,6 +41,10 @@
 // (libneml2.so vs the pyaoti module), and each instantiates the base within its
 // own TU, so there is no cross-boundary polymorphism.
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
 #include <sstream>
 #include <utility>
 #include <vector>
@@ -52,6 +56,7 @@
 #include "neml2/csrc/aoti/krylov_flatten.h"
 #include "neml2/csrc/aoti/log.h"
 #include "neml2/csrc/aoti/nonlinear_system.h"
+#include "neml2/csrc/dispatchers/batch_chunk.h"
 
 namespace neml2::aoti
 {
@@ -98,6 +103,7 @@ public:
     // matvec), flattened/unflattened at the boundary.
     const MatvecFn matvec = [&](const at::Tensor & v_flat) -> at::Tensor
     {
+      ++_matvecs;
       auto v_groups = unflatten_dense(v_flat, uspec);
       auto jv_groups = matvec_raw(u, v_groups);
       FlatSpec tmp;
@@ -117,11 +123,45 @@ public:
       {
         _precond_state = precond_setup_raw(u);
         _precond_ready = true;
+        ++_precond_rebuilds;
       }
       minv = [&](const at::Tensor & r) -> at::Tensor
       { return precond_apply_raw(_precond_state, r); };
     }
 
+    // In-loop compaction (KrylovConfig::compact_fraction): the operator on a
+    // subset of rows is this system restricted to them (`restrict_rows`) at the
+    // same iterate, with the cached preconditioner state sliced alike. 1-D
+    // batches only, as for Newton's compaction; a backend that cannot restrict
+    // keeps every linear solve on the full batch.
+    KrylovRestrictFn restrict_ops;
+    if (_cfg.compact_fraction > 0 && bspec.batch_shape.size() == 1)
+      restrict_ops = [&, batch = bspec.batch_shape[0]](
+                         const at::Tensor & rows) -> std::pair<MatvecFn, PrecondFn>
+      {
+        std::shared_ptr<const NonlinearSystem> owner = restrict_rows(rows, batch);
+        const auto * sub = dynamic_cast<const KrylovNonlinearSystem *>(owner.get());
+        if (!sub)
+          return {};
+        FlatSpec sspec = uspec;
+        sspec.batch_shape = {rows.size(0)};
+        MatvecFn sub_matvec =
+            [this, owner, sub, sspec, u_sub = index_select_batch(u, rows, batch)](
+                const at::Tensor & v_flat) -> at::Tensor
+        {
+          ++_matvecs;
+          auto jv_groups = sub->matvec_raw(u_sub, unflatten_dense(v_flat, sspec));
+          FlatSpec tmp;
+          return flatten_dense(jv_groups, _residual_layout, tmp);
+        };
+        PrecondFn sub_minv = [](const at::Tensor & r) -> at::Tensor { return r; };
+        if (has_preconditioner())
+          sub_minv = [owner, sub, state = index_select_batch(_precond_state, rows, batch)](
+                         const at::Tensor & r) -> at::Tensor
+          { return sub->precond_apply_raw(state, r); };
+        return {std::move(sub_matvec), std::move(sub_minv)};
+      };
+
     // Inner linear-solve residual trace on the `linear` channel (debug). Built
     // only when the channel is on, so a silent solve incurs no per-iteration sync.
     // LCOV_EXCL_START -- diagnostic linear-residual trace (verbosity-gated; see neml2.log)
@@ -136,8 +176,28 @@ public:
       };
     // LCOV_EXCL_STOP
 
-    auto res = krylov_solve(matvec, minv, b_flat, _cfg, on_iter);
+    const auto bnorm = (b_flat * b_flat).sum(-1).sqrt();
+    const auto eta = forcing_term(bnorm);
+    auto res = krylov_solve(matvec, minv, b_flat, _cfg, on_iter, eta, &_recycle, restrict_ops);
     _last_iters = res.max_iters;
+    if (eta.defined())
+    {
+      _prev_bnorm = bnorm;
+      _prev_eta = eta;
+      // EW1 compares ||b|| with the linear residual ||b - A du|| in the same
+      // norm. `res.resid` is the left-preconditioned ||M^-1 (b - A du)||, which
+      // is that norm only without a preconditioner; otherwise take one matvec.
+      if (_cfg.forcing == ForcingTerm::EW1)
+      {
+        if (has_preconditioner())
+        {
+          const auto lin = b_flat - matvec(res.du);
+          _prev_lin_resid = (lin * lin).sum(-1).sqrt();
+        }
+        else
+          _prev_lin_resid = res.resid;
+      }
+    }
 
     // Linear-solve convergence summary on the `linear` channel (mirrors the
     // Newton summary). A non-convergence -- some element hit max_its without
@@ -171,7 +231,14 @@ public:
   const std::vector<GroupLayout> & unknown_layout() const override { return _unknown_layout; }
   const std::vector<GroupLayout> & residual_layout() const override { return _residual_layout; }
 
+  LinearSolveCounters linear_counters() const override { return {_matvecs, _precond_rebuilds}; }
+
+  at::Tensor recycle_space() const override { return _recycle.U; }
+  void seed_recycle_space(const at::Tensor & U) override { _recycle.U = U; }
+
 protected:
+  const KrylovConfig & krylov_config() const { return _cfg; }
+
   /// b = -r at u, one tensor per residual group.
   virtual std::vector<at::Tensor> residual_raw(const std::vector<at::Tensor> & u) const = 0;
   /// J.v = dr/du . v at u; `v` is per unknown group, result per residual group.
@@ -188,6 +255,36 @@ protected:
                                        const at::Tensor & r_flat) const = 0;
 
 private:
+  // Per-element Eisenstat-Walker forcing term for this step (see ForcingTerm),
+  // or undefined for the fixed rel_tol. `bnorm` is the outer residual norm at
+  // the current iterate. The first step of a solve, and any step after the batch
+  // changed shape, starts from 0.5.
+  at::Tensor forcing_term(const at::Tensor & bnorm) const
+  {
+    if (_cfg.forcing == ForcingTerm::Fixed)
+      return {};
+    const double eta_max = std::max(_cfg.forcing_max, _cfg.rel_tol);
+    if (!_prev_bnorm.defined() || !_prev_bnorm.sizes().equals(bnorm.sizes()))
+      return at::full_like(bnorm, std::clamp(0.5, _cfg.rel_tol, eta_max));
+
+    const auto prev = _prev_bnorm.clamp_min(std::numeric_limits<double>::min());
+    at::Tensor eta, guard;
+    if (_cfg.forcing == ForcingTerm::EW1)
+    {
+      eta = (bnorm - _prev_lin_resid).abs() / prev;
+      guard = _prev_eta.pow(0.5 * (1.0 + std::sqrt(5.0)));
+    }
+    else
+    {
+      eta = 0.9 * (bnorm / prev).pow(2);
+      guard = 0.9 * _prev_eta.pow(2);
+    }
+    // Safeguard: do not let eta collapse while the previous one was still
+    // large, which would over-solve a step the outer iteration has not earned.
+    eta = at::where(guard > 0.1, at::maximum(eta, guard), eta);
+    return at::nan_to_num(eta, eta_max).clamp(_cfg.rel_tol, eta_max);
+  }
+
   // Cache policy: None rebuilds every step; Chord builds once and reuses;
   // MaxLinearIters rebuilds when the last solve's iteration count exceeded a bar.
   bool needs_precond_rebuild() const
@@ -212,5 +309,16 @@ private:
   mutable std::vector<at::Tensor> _precond_state;
   mutable bool _precond_ready = false;
   mutable int64_t _last_iters = 0;
+  // Forcing-term history of the previous step (outer residual norm, final
+  // linear residual, eta), per element. Empty under ForcingTerm::Fixed.
+  mutable at::Tensor _prev_bnorm;
+  mutable at::Tensor _prev_lin_resid;
+  mutable at::Tensor _prev_eta;
+  // GMRES recycle space (KrylovConfig::recycle), carried across the Newton
+  // steps of this solve and seeded / read back by a caller that keeps it longer.
+  mutable KrylovRecycle _recycle;
+  // Host-side counts for SolverConfig::collect_stats (see linear_counters()).
+  mutable std::size_t _matvecs = 0;
+  mutable std::size_t _precond_rebuilds = 0;
 };
 } // namespace neml2::aoti
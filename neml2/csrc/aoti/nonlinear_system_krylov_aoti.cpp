@@ -24,6 +24,7 @@
 
 #include "neml2/csrc/aoti/nonlinear_system_krylov_aoti.h"
 #include "neml2/csrc/aoti/assertions.h"
+#include "neml2/csrc/dispatchers/batch_chunk.h"
 
 #include <utility>
 
@@ -109,4 +110,23 @@ KrylovAOTINonlinearSystem::precond_apply_raw(const std::vector<at::Tensor> & sta
   _assert(outs.size() == 1, "KrylovAOTINonlinearSystem: precond apply must return one tensor");
   return outs.front();
 }
+
+std::unique_ptr<NonlinearSystem>
+KrylovAOTINonlinearSystem::restrict_rows(const at::Tensor & idx, int64_t batch) const
+{
+  auto sub = std::make_unique<KrylovAOTINonlinearSystem>(_residual_loader,
+                                                         _matvec_loader,
+                                                         _precond_setup_loader,
+                                                         _precond_apply_loader,
+                                                         unknown_layout(),
+                                                         residual_layout(),
+                                                         index_select_batch(_g, idx, batch),
+                                                         index_select_batch(_params, idx, batch),
+                                                         krylov_config());
+  // The recycle space is per row, so the kept rows keep theirs.
+  const auto U = recycle_space();
+  if (U.defined() && U.size(0) == batch)
+    sub->seed_recycle_space(U.index_select(0, idx));
+  return sub;
+}
 } // namespace neml2::aoti
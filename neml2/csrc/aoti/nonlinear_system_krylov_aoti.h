@@ -63,6 +63,11 @@ public:
                             std::vector<at::Tensor> params,
                             KrylovConfig cfg);
 
+  /// A fresh system over the selected rows; its preconditioner cache starts
+  /// empty, its recycle space keeps the selected rows.
+  std::unique_ptr<NonlinearSystem> restrict_rows(const at::Tensor & idx,
+                                                 int64_t batch) const override;
+
 protected:
   std::vector<at::Tensor> residual_raw(const std::vector<at::Tensor> & u) const override;
   std::vector<at::Tensor> matvec_raw(const std::vector<at::Tensor> & u,
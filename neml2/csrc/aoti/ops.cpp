@@ -29,6 +29,10 @@
 // the model's three public entry points. `Model` forwards onto these via Impl.
 
 #include "neml2/csrc/aoti/internal.h"
+#include "neml2/csrc/aoti/log.h"
+
+#include <algorithm>
+#include <set>
 
 // at::infer_size (broadcast two shapes) for the common-batch computation.
 #include <ATen/ExpandUtils.h>
@@ -106,36 +110,93 @@ Model::Impl::_dynamic_batch_shape_of(std::size_t idx, const at::Tensor & t) cons
   return dyn;
 }
 
-std::map<std::string, at::Tensor>
-Model::Impl::_prepare_inputs(const std::map<std::string, at::Tensor> & inputs) const
+std::vector<at::Tensor>
+Model::Impl::_gather_inputs(const std::map<std::string, at::Tensor> & inputs) const
 {
-  std::map<std::string, at::Tensor> state;
-  // First pass: validate + materialize each input, accumulating the common
+  std::vector<at::Tensor> ordered;
+  ordered.reserve(_input_names.size());
+  for (const auto & n : _input_names)
+  {
+    auto it = inputs.find(n);
+    _assert(it != inputs.end(), "aoti::Model: missing required input '", n, "'.");
+    ordered.push_back(it->second);
+  }
+  return ordered;
+}
+
+bool
+Model::Impl::ShapeSignature::matches(const std::vector<at::Tensor> & inputs) const
+{
+  if (inputs.size() != entries.size())
+    return false;
+  for (std::size_t k = 0; k < inputs.size(); ++k)
+  {
+    const auto & t = inputs[k];
+    const auto & e = entries[k];
+    if (!t.defined() || t.sizes() != at::IntArrayRef(e.sizes) ||
+        t.strides() != at::IntArrayRef(e.strides) || t.scalar_type() != e.dtype ||
+        t.device() != e.device)
+      return false;
+  }
+  return true;
+}
+
+void
+Model::Impl::_prepare_positional(std::vector<at::Tensor> & inputs) const
+{
+  _assert(inputs.size() == _input_names.size(),
+          "aoti::Model: expected ",
+          _input_names.size(),
+          " inputs, got ",
+          inputs.size(),
+          ".");
+
+  // A host that calls at a fixed layout gets the same answer every time, so
+  // replay the last plan: no validation, no batch inference, no target shapes.
+  std::shared_ptr<const ShapeSignature> sig;
+  {
+    std::lock_guard<std::mutex> lock(_sig_mutex);
+    sig = _sig;
+  }
+  if (sig && sig->matches(inputs))
+  {
+    for (std::size_t k = 0; k < inputs.size(); ++k)
+      if (!sig->targets[k].empty())
+        inputs[k] = inputs[k].broadcast_to(sig->targets[k]).contiguous();
+    return;
+  }
+
+  auto next = std::make_shared<ShapeSignature>();
+  next->entries.reserve(inputs.size());
+  next->targets.resize(inputs.size());
+
+  // First pass: validate each input, accumulating the common
   // DYNAMIC (plain) batch across all of them. Only the plain batch is unified:
   // a sub-batched input's per-site axes (crystal-plasticity per-grain /
   // per-slip) are structural and are stripped alongside the base axes before
   // broadcasting -- unifying them would collide a global input's (B,) against a
   // per-grain input's (B, ngrain). This mirrors the typed routes, whose
   // broadcast_to_common_batch broadcasts only the dynamic batch per its
-  // per-input sub_batch_ndim.
+  // per-input sub_batch_ndim. Inputs are held by handle: any materializing copy
+  // is deferred to the second pass, which makes it at most once (and not at all
+  // for an input that already arrives contiguous at the call batch).
   std::vector<int64_t> dyn;
-  for (std::size_t k = 0; k < _input_names.size(); ++k)
+  for (std::size_t k = 0; k < inputs.size(); ++k)
   {
-    const auto & n = _input_names[k];
-    auto it = inputs.find(n);
-    _assert(it != inputs.end(), "aoti::Model: missing required input '", n, "'.");
-    _validate_input_shape(k, it->second);
-    state[n] = it->second.contiguous();
-    dyn = at::infer_size(dyn, _dynamic_batch_shape_of(k, state[n]));
+    _validate_input_shape(k, inputs[k]);
+    dyn = at::infer_size(dyn, _dynamic_batch_shape_of(k, inputs[k]));
+    next->entries.push_back({inputs[k].sizes().vec(),
+                             inputs[k].strides().vec(),
+                             inputs[k].scalar_type(),
+                             inputs[k].device()});
   }
   // Second pass: lift every input's dynamic batch to the common shape, leaving
   // its sub-batch and base axes untouched -- a batch-independent input (e.g. a
   // scalar TIME force) is broadcast to the call batch without disturbing a
   // sub-batched input's per-grain axes.
-  for (std::size_t k = 0; k < _input_names.size(); ++k)
+  for (std::size_t k = 0; k < inputs.size(); ++k)
   {
-    const auto & n = _input_names[k];
-    const at::Tensor & t = state[n];
+    at::Tensor & t = inputs[k];
     const int64_t sub_ndim = _input_sub_batch_shapes.empty()
                                  ? 0
                                  : static_cast<int64_t>(_input_sub_batch_shapes[k].size());
@@ -145,60 +206,222 @@ Model::Impl::_prepare_inputs(const std::map<std::string, at::Tensor> & inputs) c
     std::vector<int64_t> target(dyn);
     for (int64_t d = t.dim() - keep; d < t.dim(); ++d)
       target.push_back(t.size(d));
-    state[n] = t.broadcast_to(target).contiguous();
+    // Fast path: a contiguous input already at the call batch (the common
+    // full-batch host call) is used as-is -- no broadcast view, no copy.
+    if (t.is_contiguous() && t.sizes() == at::IntArrayRef(target))
+      continue;
+    t = t.broadcast_to(target).contiguous();
+    next->targets[k] = std::move(target);
   }
-  return state;
+
+  std::lock_guard<std::mutex> lock(_sig_mutex);
+  _sig = std::move(next);
 }
 
 std::map<std::string, at::Tensor>
-Model::Impl::forward(const std::map<std::string, at::Tensor> & inputs,
-                     const std::map<std::string, at::Tensor> & param_overrides) const
+Model::Impl::_prepare_inputs(const std::map<std::string, at::Tensor> & inputs) const
 {
-  const ParamOverrideGuard _pog(this, param_overrides);
-  auto state = _prepare_inputs(inputs);
+  auto ordered = _gather_inputs(inputs);
+  _prepare_positional(ordered);
+  std::map<std::string, at::Tensor> state;
+  for (std::size_t k = 0; k < ordered.size(); ++k)
+    state.emplace(_input_names[k], std::move(ordered[k]));
+  return state;
+}
+
+Model::Impl::ForwardMemo::Stamp
+Model::Impl::ForwardMemo::stamp(const at::Tensor & t)
+{
+  if (!t.defined())
+    return {};
+  return {t, t._version(), t.sizes().vec()};
+}
+
+bool
+Model::Impl::ForwardMemo::same(const std::vector<Stamp> & a, const std::vector<Stamp> & b)
+{
+  if (a.size() != b.size())
+    return false;
+  for (std::size_t k = 0; k < a.size(); ++k)
+    if (!a[k].t.is_same(b[k].t) || a[k].version != b[k].version || a[k].sizes != b[k].sizes)
+      return false;
+  return true;
+}
+
+bool
+Model::Impl::ForwardMemo::intact() const
+{
+  for (const auto * groups : {&u_groups, &g_groups})
+    for (const auto & seg : *groups)
+      for (const auto & s : seg)
+        if (s.t._version() != s.version)
+          return false;
+  return true;
+}
+
+std::shared_ptr<Model::Impl::ForwardMemo>
+Model::Impl::_memo_open(const std::vector<at::Tensor> & inputs) const
+{
+  auto memo = std::make_shared<ForwardMemo>();
+  memo->key.reserve(inputs.size() + _plan.params.size());
+  for (const auto & t : inputs)
+    memo->key.push_back(ForwardMemo::stamp(t));
+  // Resolved through any per-call override, so an override-driven call and a
+  // stored-parameter call never match each other.
+  for (std::size_t p = 0; p < _plan.params.size(); ++p)
+    memo->key.push_back(ForwardMemo::stamp(_resolve_param(p)));
+  memo->u_groups.resize(_segments.size());
+  memo->g_groups.resize(_segments.size());
+  return memo;
+}
+
+std::shared_ptr<const Model::Impl::ForwardMemo>
+Model::Impl::_memo_recall(const std::map<std::string, at::Tensor> & inputs) const
+{
+  if (!_memo_enabled)
+    return nullptr;
+  std::shared_ptr<const ForwardMemo> memo;
+  {
+    const std::lock_guard<std::mutex> lock(_memo_mutex);
+    memo = _memo;
+  }
+  const bool hit = memo && ForwardMemo::same(memo->key, _memo_open(_gather_inputs(inputs))->key) &&
+                   memo->intact();
+  if (log::enabled(log::Channel::Model, log::Level::Debug))
+    log::emit(log::Channel::Model,
+              log::Level::Debug,
+              hit ? "forward memo: hit, implicit solves reused"
+                  : "forward memo: miss, implicit segments will be re-solved");
+  return hit ? memo : nullptr;
+}
+
+std::vector<at::Tensor>
+Model::Impl::_forward_positional(std::vector<at::Tensor> inputs) const
+{
+  // Stamped before `_prepare_positional` swaps in broadcast copies, so the key
+  // refers to the caller's own tensors.
+  const auto memo = _memo_enabled ? _memo_open(inputs) : nullptr;
+
+  _prepare_positional(inputs);
 
   // Call batch from the first structural input (its base stripped). Forward
   // segments broadcast each promoted parameter to this batch before the call,
   // since the value graphs take parameters as per-batch inputs.
   const std::vector<int64_t> batch =
-      _input_names.empty() ? std::vector<int64_t>{} : _batch_shape_of(0, state.at(_input_names[0]));
+      _input_names.empty() ? std::vector<int64_t>{} : _batch_shape_of(0, inputs[0]);
+
+  std::vector<at::Tensor> slots(_plan.nslots);
+  for (std::size_t k = 0; k < inputs.size(); ++k)
+    slots[_plan.input_slots[k]] = std::move(inputs[k]);
 
-  for (const auto & seg : _segments)
+  for (std::size_t i = 0; i < _segments.size(); ++i)
   {
-    if (seg.kind == SegmentKind::Forward)
+    if (_segments[i].kind == SegmentKind::Forward)
     {
-      _run_forward_segment(seg, state, batch);
+      _run_forward_step(_segments[i], _plan.steps[i], slots, batch);
+      continue;
     }
-    else
+    std::vector<at::Tensor> u_solved_groups;
+    std::vector<at::Tensor> g_groups;
+    _run_implicit_step(_segments[i], _plan.steps[i], slots, u_solved_groups, g_groups);
+    if (memo)
     {
-      std::vector<at::Tensor> u_solved_groups;
-      std::vector<at::Tensor> g_groups;
-      if (seg.max_substepping_level > 0)
-        // Adaptive substepping: per-element masking over the dynamic batch
-        // (flattened to a single axis for any rank) -- freeze converged rows and
-        // bisect only the still-failing subset.
-        _run_implicit_segment_substepped_masked(seg, state);
-      else
-        _run_implicit_segment(seg, state, u_solved_groups, g_groups);
+      for (const auto & t : u_solved_groups)
+        memo->u_groups[i].push_back(ForwardMemo::stamp(t));
+      for (const auto & t : g_groups)
+        memo->g_groups[i].push_back(ForwardMemo::stamp(t));
     }
   }
 
-  std::map<std::string, at::Tensor> outputs;
-  for (const auto & n : _output_names)
+  std::vector<at::Tensor> outputs;
+  outputs.reserve(_output_names.size());
+  for (std::size_t j = 0; j < _output_names.size(); ++j)
   {
-    auto it = state.find(n);
-    _assert(it != state.end(),
+    at::Tensor & t = slots[_plan.output_slots[j]];
+    _assert(t.defined(),
             "aoti::Model::forward: output '",
-            n,
+            _output_names[j],
             "' was not produced by any segment.");
-    outputs[n] = it->second;
+    outputs.push_back(std::move(t));
+  }
+
+  // Only a call that ran to completion is remembered.
+  if (memo)
+  {
+    const std::lock_guard<std::mutex> lock(_memo_mutex);
+    _memo = memo;
   }
   return outputs;
 }
 
+std::map<std::string, at::Tensor>
+Model::Impl::forward(const std::map<std::string, at::Tensor> & inputs,
+                     const std::map<std::string, at::Tensor> & param_overrides,
+                     const std::map<std::string, at::Tensor> & initial_guess) const
+{
+  const ParamOverrideGuard _pog(this, param_overrides);
+  const InitialGuessGuard _igg(this, initial_guess);
+  auto values = _forward_positional(_gather_inputs(inputs));
+
+  std::map<std::string, at::Tensor> outputs;
+  for (std::size_t j = 0; j < _output_names.size(); ++j)
+    outputs.emplace(_output_names[j], std::move(values[j]));
+  return outputs;
+}
+
+void
+Model::Impl::forward_into(const std::map<std::string, at::Tensor> & inputs,
+                          const std::map<std::string, at::Tensor> & outputs,
+                          const std::map<std::string, at::Tensor> & param_overrides,
+                          const std::map<std::string, at::Tensor> & initial_guess) const
+{
+  const ParamOverrideGuard _pog(this, param_overrides);
+  const InitialGuessGuard _igg(this, initial_guess);
+  const auto values = _forward_positional(_gather_inputs(inputs));
+
+  // The compiled graphs allocate their own results, so "into" is one in-place
+  // copy per output. What the caller saves is the returned map + its nodes and,
+  // with the `_prepare_positional` fast path, every input-side copy.
+  for (std::size_t j = 0; j < _output_names.size(); ++j)
+  {
+    const auto & n = _output_names[j];
+    auto dit = outputs.find(n);
+    _assert(dit != outputs.end(),
+            "aoti::Model::forward_into: missing preallocated output '",
+            n,
+            "'.");
+    const at::Tensor & dst = dit->second;
+    const at::Tensor & src = values[j];
+    _assert(dst.defined(), "aoti::Model::forward_into: output '", n, "' is undefined.");
+    _assert(dst.sizes() == src.sizes(),
+            "aoti::Model::forward_into: output '",
+            n,
+            "' is preallocated at shape ",
+            dst.sizes(),
+            " but the model produces ",
+            src.sizes(),
+            ".");
+    _assert(dst.device() == _device && dst.scalar_type() == src.scalar_type(),
+            "aoti::Model::forward_into: output '",
+            n,
+            "' must live on ",
+            _device,
+            " with dtype ",
+            src.scalar_type(),
+            " (got ",
+            dst.device(),
+            ", ",
+            dst.scalar_type(),
+            ").");
+    dst.copy_(src);
+  }
+}
+
 std::pair<std::map<std::string, at::Tensor>, std::map<std::string, at::Tensor>>
 Model::Impl::_jacobian_dstate(const std::map<std::string, at::Tensor> & inputs) const
 {
+  const auto memo = _memo_recall(inputs);
+
   // Pack state from caller inputs (validating + broadcasting to the common batch).
   auto state = _prepare_inputs(inputs);
 
@@ -218,18 +441,20 @@ Model::Impl::_jacobian_dstate(const std::map<std::string, at::Tensor> & inputs)
   int64_t batch_numel = 1;
   for (auto s : batch_shape_vec)
     batch_numel *= s;
-  for (const auto & seg : _segments)
+  for (std::size_t si = 0; si < _segments.size(); ++si)
   {
+    const auto & seg = _segments[si];
     if (seg.kind == SegmentKind::Forward)
     {
-      if (seg.jvp_loader)
+      if (seg.jvp_loader && _composes(si))
         _run_forward_segment_jacobian(seg, state, dstate, batch_shape_vec);
       else
       {
-        // Off-path forward segment (pruned by `-d` selection): its outputs are
-        // on no requested derivative path, so advance `state` via the value
-        // graph and zero-fill its outputs' dstate. The zeros are never consumed
-        // by a kept pair -- only discarded in the final per-pair slice.
+        // Off-path forward segment (pruned by `-d` selection or by a subset
+        // call): its outputs are on no requested derivative path, so advance
+        // `state` via the value graph and zero-fill its outputs' dstate. The
+        // zeros are never consumed by a kept pair -- only discarded in the final
+        // per-pair slice.
         _run_forward_segment(seg, state, batch_shape_vec);
         for (const auto & oname : seg.fwd_outputs)
         {
@@ -237,12 +462,12 @@ Model::Impl::_jacobian_dstate(const std::map<std::string, at::Tensor> & inputs)
           const int64_t osz = batch_numel > 0 ? val.numel() / batch_numel : 0;
           std::vector<int64_t> shp = batch_shape_vec;
           shp.push_back(osz);
-          shp.push_back(_req_total_size);
+          shp.push_back(_col_total());
           dstate[oname] = at::zeros(shp, ref.options());
         }
       }
     }
-    else if (seg.max_substepping_level > 0 && seg.jacobian_given_loader)
+    else if (seg.max_substepping_level > 0 && seg.jacobian_given_loader && _composes(si))
     {
       // Substepped solve + chained consistent-tangent accumulation in one
       // bisection recursion (state + dstate advanced together): per-element
@@ -261,8 +486,8 @@ Model::Impl::_jacobian_dstate(const std::map<std::string, at::Tensor> & inputs)
         // via masked substepping; its unknowns' dstate is zero-filled below.
         _run_implicit_segment_substepped_masked(seg, state);
       else
-        _run_implicit_segment(seg, state, u_solved_groups, g_groups);
-      if (seg.jacobian_given_loader)
+        _solve_or_recall(si, seg, state, u_solved_groups, g_groups, memo.get());
+      if (seg.jacobian_given_loader && _composes(si))
         _run_implicit_segment_jacobian(seg, u_solved_groups, g_groups, dstate);
       else
         // Off-path implicit segment: forward solve already advanced `state`;
@@ -271,7 +496,7 @@ Model::Impl::_jacobian_dstate(const std::map<std::string, at::Tensor> & inputs)
         {
           std::vector<int64_t> shp = batch_shape_vec;
           shp.push_back(u.var_size);
-          shp.push_back(_req_total_size);
+          shp.push_back(_col_total());
           dstate[u.name] = at::zeros(shp, ref.options());
         }
     }
@@ -287,9 +512,116 @@ Model::Impl::_jacobian_dstate(const std::map<std::string, at::Tensor> & inputs)
 
 std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
 Model::Impl::jacobian(const std::map<std::string, at::Tensor> & inputs,
-                      const std::map<std::string, at::Tensor> & param_overrides) const
+                      const std::map<std::string, at::Tensor> & param_overrides,
+                      const std::map<std::string, at::Tensor> & initial_guess) const
+{
+  const ParamOverrideGuard _pog(this, param_overrides);
+  const InitialGuessGuard _igg(this, initial_guess);
+  return _jacobian_blocks(inputs);
+}
+
+Model::Impl::JacobianSubset
+Model::Impl::_jacobian_subset(const std::vector<std::string> & wrt_inputs,
+                              const std::vector<std::string> & of_outputs) const
+{
+  _assert(!_derivatives.empty(),
+          "aoti::Model::jacobian: this artifact was compiled with no derivative graphs. "
+          "Recompile with `neml2-compile -d OUT:IN` (e.g. `-d :` for all pairs).");
+  for (const auto & i : wrt_inputs)
+    _assert(_req_input_offset.count(i),
+            "aoti::Model::jacobian: no compiled derivative is taken with respect to '",
+            i,
+            "'. Recompile with `neml2-compile -d OUT:",
+            i,
+            "` to request it.");
+  for (const auto & o : of_outputs)
+    _assert(_deriv_by_out.count(o),
+            "aoti::Model::jacobian: no compiled derivative is taken of '",
+            o,
+            "'. Recompile with `neml2-compile -d ",
+            o,
+            ":IN` to request it.");
+
+  auto selected = [](const std::vector<std::string> & names, const std::string & n)
+  { return names.empty() || std::find(names.begin(), names.end(), n) != names.end(); };
+
+  // Columns in master-input order, whatever order the caller listed them in.
+  JacobianSubset sub;
+  for (const auto & i : _req_inputs)
+    if (selected(wrt_inputs, i))
+    {
+      sub.offset[i] = sub.total;
+      sub.size[i] = _req_input_size.at(i);
+      sub.total += _req_input_size.at(i);
+    }
+  for (const auto & [o, ins] : _deriv_by_out)
+    if (selected(of_outputs, o))
+      sub.of.push_back(o);
+
+  // A segment composes only if it reads something a selected input reaches
+  // (forward sweep) and writes something a selected output needs (backward
+  // sweep). Anything else would only push zeros or unused columns through its
+  // Jacobian graphs.
+  auto reads = [](const Segment & seg)
+  {
+    std::vector<std::string> r = seg.fwd_inputs;
+    for (const auto & g : seg.givens)
+      r.push_back(g.name);
+    return r;
+  };
+  auto writes = [](const Segment & seg)
+  {
+    std::vector<std::string> w = seg.fwd_outputs;
+    for (const auto & u : seg.unknowns)
+      w.push_back(u.name);
+    return w;
+  };
+  std::set<std::string> reached, needed(sub.of.begin(), sub.of.end());
+  for (const auto & [i, off] : sub.offset)
+    reached.insert(i);
+  std::vector<bool> fwd(_segments.size(), false);
+  for (std::size_t si = 0; si < _segments.size(); ++si)
+  {
+    for (const auto & n : reads(_segments[si]))
+      fwd[si] = fwd[si] || reached.count(n);
+    if (fwd[si])
+      for (const auto & n : writes(_segments[si]))
+        reached.insert(n);
+  }
+  sub.composed.assign(_segments.size(), false);
+  for (std::size_t si = _segments.size(); si-- > 0;)
+  {
+    bool bwd = false;
+    for (const auto & n : writes(_segments[si]))
+      bwd = bwd || needed.count(n);
+    if (!bwd)
+      continue;
+    for (const auto & n : reads(_segments[si]))
+      needed.insert(n);
+    sub.composed[si] = fwd[si];
+  }
+  return sub;
+}
+
+std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
+Model::Impl::jacobian(const std::map<std::string, at::Tensor> & inputs,
+                      const std::vector<std::string> & wrt_inputs,
+                      const std::vector<std::string> & of_outputs,
+                      const std::map<std::string, at::Tensor> & param_overrides,
+                      const std::map<std::string, at::Tensor> & initial_guess) const
 {
   const ParamOverrideGuard _pog(this, param_overrides);
+  const InitialGuessGuard _igg(this, initial_guess);
+  if (wrt_inputs.empty() && of_outputs.empty())
+    return _jacobian_blocks(inputs);
+  const auto subset = _jacobian_subset(wrt_inputs, of_outputs);
+  const JacobianSubsetGuard _jsg(this, subset);
+  return _jacobian_blocks(inputs);
+}
+
+std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
+Model::Impl::_jacobian_blocks(const std::map<std::string, at::Tensor> & inputs) const
+{
   _assert(!_derivatives.empty(),
           "aoti::Model::jacobian: this artifact was compiled with no derivative graphs. "
           "Recompile with `neml2-compile -d OUT:IN` (e.g. `-d :` for all pairs).");
@@ -297,8 +629,26 @@ Model::Impl::jacobian(const std::map<std::string, at::Tensor> & inputs,
   // Single forward segment: return the compiled per-pair blocks directly (no
   // dense flat-J round-trip), so a batch-independent block (e.g. a constant
   // stiffness tensor) is returned unbatched at its natural (*out_base, *in_base).
+  // A subset only filters the fast path's blocks: its one graph computes every
+  // compiled pair at once.
+  const auto * sub = _ctx().jac_subset;
+  auto wanted = [&](const std::string & o, const std::string & i)
+  {
+    return !sub || (sub->offset.count(i) &&
+                    std::find(sub->of.begin(), sub->of.end(), o) != sub->of.end());
+  };
   if (_is_single_forward_jac())
-    return _forward_pair_blocks(inputs);
+  {
+    auto [outputs, jac] = _forward_pair_blocks(inputs);
+    if (!sub)
+      return {std::move(outputs), std::move(jac)};
+    VariablePairJacobian kept;
+    for (auto & [o, row] : jac)
+      for (auto & [i, blk] : row)
+        if (wanted(o, i))
+          kept[o][i] = std::move(blk);
+    return {std::move(outputs), std::move(kept)};
+  }
 
   auto [outputs, dstate] = _jacobian_dstate(inputs); // dstate[var]: (*B, var_folded, M_req)
 
@@ -311,21 +661,26 @@ Model::Impl::jacobian(const std::map<std::string, at::Tensor> & inputs,
   // Slice each requested output's dstate block directly (no flat cat): take the
   // input's column band [req_offset, +in_var) and reshape to
   // (*B, *out_base, *in_base). Per-output slicing keeps offsets correct even
-  // with heterogeneous folded output sizes.
+  // with heterogeneous folded output sizes. Under a workspace the carriers are
+  // its buffers, so the blocks are copied out instead of viewed.
+  const bool copy_out = _ctx().workspace != nullptr;
   VariablePairJacobian jac;
   for (const auto & [o, i] : _derivatives)
   {
+    if (!wanted(o, i))
+      continue;
     const auto & blk = dstate.at(o); // (*B, out_folded, M_req)
     std::vector<int64_t> batch(blk.sizes().begin(), blk.sizes().end() - 2);
     const auto ji = in_idx.at(i);
-    auto col = blk.narrow(-1, _req_input_offset.at(i), _req_input_size.at(i));
+    auto col = blk.narrow(-1, _col_offset().at(i), _col_size().at(i));
     std::vector<int64_t> block_shape = batch;
     block_shape.insert(block_shape.end(),
                        _output_base_shapes[out_idx.at(o)].begin(),
                        _output_base_shapes[out_idx.at(o)].end());
     block_shape.insert(
         block_shape.end(), _input_base_shapes[ji].begin(), _input_base_shapes[ji].end());
-    jac[o][i] = col.reshape(block_shape).contiguous();
+    jac[o][i] = copy_out ? col.reshape(block_shape).clone(at::MemoryFormat::Contiguous)
+                         : col.reshape(block_shape).contiguous();
   }
 
   return {std::move(outputs), std::move(jac)};
@@ -358,6 +713,7 @@ Model::Impl::param_jacobian(const std::map<std::string, at::Tensor> & inputs,
   for (std::size_t i = 0; i < _output_names.size(); ++i)
     out_idx[_output_names[i]] = i;
 
+  const bool copy_out = _ctx().workspace != nullptr; // see _jacobian_blocks
   VariablePairJacobian pjac;
   for (const auto & [o, p] : _param_derivatives)
   {
@@ -373,7 +729,8 @@ Model::Impl::param_jacobian(const std::map<std::string, at::Tensor> & inputs,
     // block's leading `batch`, never injected into the param-base axes.
     const auto & pbase = _param_base_shapes.at(p);
     block_shape.insert(block_shape.end(), pbase.begin(), pbase.end());
-    pjac[o][p] = col.reshape(block_shape).contiguous();
+    pjac[o][p] = copy_out ? col.reshape(block_shape).clone(at::MemoryFormat::Contiguous)
+                          : col.reshape(block_shape).contiguous();
   }
   return {std::move(outputs), std::move(pjac)};
 }
@@ -526,66 +883,145 @@ Model::Impl::param_vjp(const std::map<std::string, at::Tensor> & inputs,
   return grads;
 }
 
+std::map<std::string, at::Tensor>
+Model::Impl::_contract_dstate(const std::map<std::string, at::Tensor> & dstate,
+                              const std::map<std::string, at::Tensor> & tangent_cols,
+                              int64_t k) const
+{
+  // Per covered output, contract its requested input column bands with the
+  // matching tangents. Outputs in no requested pair are omitted; inputs not
+  // paired with an output, or without a tangent, contribute nothing.
+  std::map<std::string, at::Tensor> res;
+  for (const auto & [o, ins] : _deriv_by_out)
+  {
+    const auto & blk = dstate.at(o); // (*B, out_folded, M_req)
+    at::Tensor acc;
+    for (const auto & iname : ins)
+    {
+      auto it = tangent_cols.find(iname);
+      if (it == tangent_cols.end())
+        continue;
+      auto col = blk.narrow(-1, _req_input_offset.at(iname), _req_input_size.at(iname));
+      auto contrib = at::matmul(col, it->second);
+      acc = acc.defined() ? acc + contrib : contrib;
+    }
+    if (!acc.defined())
+    {
+      std::vector<int64_t> shape(blk.sizes().begin(), blk.sizes().end() - 1);
+      shape.push_back(k);
+      acc = at::zeros(shape, blk.options());
+    }
+    res[o] = acc;
+  }
+  return res;
+}
+
 std::pair<std::map<std::string, at::Tensor>, std::map<std::string, at::Tensor>>
 Model::Impl::jvp(const std::map<std::string, at::Tensor> & inputs,
                  const std::map<std::string, at::Tensor> & tangents,
-                 const std::map<std::string, at::Tensor> & param_overrides) const
+                 const std::map<std::string, at::Tensor> & param_overrides,
+                 const std::map<std::string, at::Tensor> & initial_guess) const
 {
   const ParamOverrideGuard _pog(this, param_overrides);
+  const InitialGuessGuard _igg(this, initial_guess);
   _assert(!_derivatives.empty(),
           "aoti::Model::jvp: this artifact was compiled with no derivative graphs. "
           "Recompile with `neml2-compile -d OUT:IN` (e.g. `-d :` for all pairs).");
 
-  // Per covered output, contract its requested input column bands with the
-  // matching tangents. Outputs in no requested pair are omitted; inputs not
-  // paired with an output contribute nothing (they were not differentiated).
   auto [outputs, dstate] = _jacobian_dstate(inputs); // dstate[var]: (*B, var_folded, M_req)
 
-  std::map<std::string, std::size_t> out_idx, in_idx;
+  // Per-input tangent column (*B, in_var_size, 1).
+  std::map<std::string, at::Tensor> cols;
+  for (std::size_t ji = 0; ji < _input_names.size(); ++ji)
+  {
+    auto it = tangents.find(_input_names[ji]);
+    if (it == tangents.end())
+      continue;
+    _validate_input_shape(ji, it->second); // canonical (*B, *base) contract
+    auto shape = _batch_shape_of(ji, it->second);
+    shape.push_back(_input_sizes[ji]); // flatten trailing base axes into the var_size slot
+    cols[_input_names[ji]] = it->second.reshape(shape).to(_dtype).unsqueeze(-1);
+  }
+
+  std::map<std::string, std::size_t> out_idx;
   for (std::size_t i = 0; i < _output_names.size(); ++i)
     out_idx[_output_names[i]] = i;
-  for (std::size_t j = 0; j < _input_names.size(); ++j)
-    in_idx[_input_names[j]] = j;
+  std::map<std::string, at::Tensor> jvp_outputs;
+  for (auto & [o, acc] : _contract_dstate(dstate, cols, 1))
+  {
+    std::vector<int64_t> shape(acc.sizes().begin(), acc.sizes().end() - 2);
+    const auto & obase = _output_base_shapes[out_idx.at(o)];
+    shape.insert(shape.end(), obase.begin(), obase.end());
+    jvp_outputs[o] = acc.squeeze(-1).reshape(shape).contiguous();
+  }
 
-  // Per-input tangent column (*B, in_var_size, 1) at the given batch; a missing
-  // tangent is zero.
-  auto tangent_col = [&](const std::string & iname,
-                         const std::vector<int64_t> & batch,
-                         const at::TensorOptions & opts) -> at::Tensor
+  return {std::move(outputs), std::move(jvp_outputs)};
+}
+
+std::pair<std::map<std::string, at::Tensor>, std::map<std::string, at::Tensor>>
+Model::Impl::jvp_multi(const std::map<std::string, at::Tensor> & inputs,
+                       const std::map<std::string, at::Tensor> & tangents,
+                       const std::map<std::string, at::Tensor> & param_overrides,
+                       const std::map<std::string, at::Tensor> & initial_guess) const
+{
+  const ParamOverrideGuard _pog(this, param_overrides);
+  const InitialGuessGuard _igg(this, initial_guess);
+  _assert(!_derivatives.empty(),
+          "aoti::Model::jvp_multi: this artifact was compiled with no derivative graphs. "
+          "Recompile with `neml2-compile -d OUT:IN` (e.g. `-d :` for all pairs).");
+  _assert(!tangents.empty(),
+          "aoti::Model::jvp_multi: no tangents given, so the number of directions is unknown.");
+
+  // Per-input tangent block (*B, in_var_size, K): the K directions become the
+  // matmul's column count, so one pass over the carrier serves all of them.
+  int64_t k = -1;
+  std::map<std::string, at::Tensor> cols;
+  for (std::size_t ji = 0; ji < _input_names.size(); ++ji)
   {
-    const auto ji = in_idx.at(iname);
-    const auto sz = _input_sizes[ji];
-    auto it = tangents.find(iname);
-    if (it != tangents.end())
-    {
-      _validate_input_shape(ji, it->second); // canonical (*B, *base) contract
-      auto shape = _batch_shape_of(ji, it->second);
-      shape.push_back(sz); // flatten trailing base axes into the var_size slot
-      return it->second.reshape(shape).to(_dtype).unsqueeze(-1).contiguous();
-    }
-    std::vector<int64_t> shape = batch;
-    shape.push_back(sz);
-    shape.push_back(1);
-    return at::zeros(shape, opts);
-  };
+    auto it = tangents.find(_input_names[ji]);
+    if (it == tangents.end())
+      continue;
+    _validate_input_shape(ji, it->second);
+    auto lead = _batch_shape_of(ji, it->second);
+    _assert(!lead.empty(),
+            "aoti::Model::jvp_multi: tangent for '",
+            _input_names[ji],
+            "' has shape ",
+            it->second.sizes(),
+            "; expected (*B, K, *base_shape) with a direction axis K.");
+    _assert(k < 0 || lead.back() == k,
+            "aoti::Model::jvp_multi: tangent for '",
+            _input_names[ji],
+            "' carries ",
+            lead.back(),
+            " directions, but another tangent carries ",
+            k,
+            ".");
+    k = lead.back();
+    lead.push_back(_input_sizes[ji]);
+    cols[_input_names[ji]] = it->second.reshape(lead).to(_dtype).transpose(-1, -2);
+  }
+  for (const auto & [name, t] : tangents)
+    _assert(cols.count(name),
+            "aoti::Model::jvp_multi: tangent '",
+            name,
+            "' does not name a model input.");
 
+  // Solve (or recall) once; every direction shares the converged state and the
+  // implicit segments' IFT blocks.
+  auto [outputs, dstate] = _jacobian_dstate(inputs); // dstate[var]: (*B, var_folded, M_req)
+
+  std::map<std::string, std::size_t> out_idx;
+  for (std::size_t i = 0; i < _output_names.size(); ++i)
+    out_idx[_output_names[i]] = i;
   std::map<std::string, at::Tensor> jvp_outputs;
-  for (const auto & [o, ins] : _deriv_by_out)
+  for (auto & [o, acc] : _contract_dstate(dstate, cols, k)) // (*B, out_folded, K)
   {
-    const auto & blk = dstate.at(o); // (*B, out_folded, M_req)
-    std::vector<int64_t> batch(blk.sizes().begin(), blk.sizes().end() - 2);
-    at::Tensor acc;
-    for (const auto & iname : ins)
-    {
-      auto col = blk.narrow(-1, _req_input_offset.at(iname), _req_input_size.at(iname));
-      auto contrib = at::matmul(col, tangent_col(iname, batch, blk.options())).squeeze(-1);
-      acc = acc.defined() ? acc + contrib : contrib;
-    }
-    std::vector<int64_t> shape = batch;
-    shape.insert(shape.end(),
-                 _output_base_shapes[out_idx.at(o)].begin(),
-                 _output_base_shapes[out_idx.at(o)].end());
-    jvp_outputs[o] = acc.reshape(shape).contiguous();
+    std::vector<int64_t> shape(acc.sizes().begin(), acc.sizes().end() - 2);
+    shape.push_back(k);
+    const auto & obase = _output_base_shapes[out_idx.at(o)];
+    shape.insert(shape.end(), obase.begin(), obase.end());
+    jvp_outputs[o] = acc.transpose(-1, -2).reshape(shape).contiguous();
   }
 
   return {std::move(outputs), std::move(jvp_outputs)};
@@ -39,8 +39,10 @@
 #include <cctype>
 #include <cstdlib>
 #include <memory>
+#include <mutex>
 #include <string>
 
+#include <ATen/ExpandUtils.h>
 #include <torch/csrc/inductor/aoti_package/model_package_loader.h>
 
 namespace neml2::aoti
@@ -95,26 +97,94 @@ Model::Impl::_run_forward_segment(const Segment & seg,
     state[seg.fwd_outputs[i]] = outs[i];
 }
 
+void
+Model::Impl::_run_forward_step(const Segment & seg,
+                               const CallPlan::Step & step,
+                               std::vector<at::Tensor> & slots,
+                               const std::vector<int64_t> & batch) const
+{
+  std::vector<at::Tensor> inputs;
+  inputs.reserve(step.in_slots.size() + seg.param_inputs.size());
+  for (std::size_t k = 0; k < step.in_slots.size(); ++k)
+  {
+    const at::Tensor & t = slots[step.in_slots[k]];
+    _assert(t.defined(),
+            "aoti::Model: forward segment needs input '",
+            seg.fwd_inputs[k],
+            "' which no earlier segment produced.");
+    inputs.push_back(t.contiguous());
+  }
+  for (std::size_t k = 0; k < step.params.size(); ++k)
+    inputs.push_back(
+        broadcast_param_to_batch(_resolve_param(step.params[k]), batch, step.param_base_ndim[k]));
+
+  auto outs = seg.fwd_loader->run(inputs);
+  _assert(outs.size() == step.out_slots.size(),
+          "aoti::Model: forward segment returned ",
+          outs.size(),
+          " tensors, expected ",
+          step.out_slots.size());
+  for (std::size_t i = 0; i < step.out_slots.size(); ++i)
+    slots[step.out_slots[i]] = std::move(outs[i]);
+}
+
+void
+Model::Impl::_run_implicit_step(const Segment & seg,
+                                const CallPlan::Step & step,
+                                std::vector<at::Tensor> & slots,
+                                std::vector<at::Tensor> & u_solved_groups,
+                                std::vector<at::Tensor> & g_groups) const
+{
+  if (seg.max_substepping_level == 0)
+  {
+    _run_implicit_segment(seg, slots, u_solved_groups, g_groups);
+    return;
+  }
+
+  // The substep driver works on name-keyed span maps, so only the variables
+  // this segment touches cross into one; an undefined slot (an unknown with no
+  // incoming value) is simply absent, exactly as in the name-keyed state.
+  std::map<std::string, at::Tensor> state;
+  for (const auto & [name, slot] : step.bridge)
+    if (slots[slot].defined())
+      state.emplace(name, slots[slot]);
+
+  _run_implicit_segment_substepped_masked(seg, state);
+
+  for (const auto & [name, slot] : step.bridge)
+  {
+    auto it = state.find(name);
+    if (it != state.end())
+      slots[slot] = std::move(it->second);
+  }
+}
+
 std::vector<at::Tensor>
-Model::Impl::_pack_groups(const std::map<std::string, at::Tensor> & state,
-                          const std::vector<Segment::GroupInfo> & groups) const
+Model::Impl::_pack_groups(VarState state, const Segment & seg, GroupSide side, bool pooled) const
 {
+  const bool given = side == GroupSide::Given;
+  const auto & groups = given ? seg.given_groups : seg.unknown_groups;
+  const auto & step = _step_of(seg);
+  const auto & group_slots = given ? step.given_group_slots : step.unknown_group_slots;
+  const auto tag = given ? WsTag::GivenPack : WsTag::UnknownPack;
+
   // Mirrors :meth:`AssembledVector.from_dict` -- for each group, cat
   // per-var contributions along the last axis. BLOCK groups keep the
   // group's sub_batch axes (each var's sub matches the group's by
   // construction); DENSE groups fold each var's sub into base then cat.
   std::vector<at::Tensor> packed;
   packed.reserve(groups.size());
-  for (const auto & group : groups)
+  for (std::size_t gi = 0; gi < groups.size(); ++gi)
   {
+    const auto & group = groups[gi];
     std::vector<at::Tensor> parts;
     parts.reserve(group.per_var_info.size());
-    for (const auto & v : group.per_var_info)
+    for (std::size_t vi = 0; vi < group.per_var_info.size(); ++vi)
     {
-      auto it = state.find(v.name);
-      _assert(
-          it != state.end(), "aoti::Model::_pack_groups: state missing variable '", v.name, "'.");
-      const auto & t = it->second;
+      const auto & v = group.per_var_info[vi];
+      const at::Tensor * it = state.find(v.name, group_slots[gi][vi]);
+      _assert(it, "aoti::Model::_pack_groups: state missing variable '", v.name, "'.");
+      const auto & t = *it;
       const int64_t var_trail =
           static_cast<int64_t>(v.sub_batch_shape.size() + v.base_shape.size());
       _assert(t.dim() >= var_trail,
@@ -150,21 +220,40 @@ Model::Impl::_pack_groups(const std::map<std::string, at::Tensor> & state,
     _assert(!parts.empty(),
             "aoti::Model::_pack_groups: encountered an empty group; v7 layouts "
             "always have at least one variable per declared group.");
-    packed.push_back(at::cat(parts, /*dim=*/-1).contiguous());
+    at::Tensor buf;
+    if (pooled)
+    {
+      c10::SmallVector<int64_t, 8> shape(parts[0].sizes().begin(), parts[0].sizes().end());
+      shape.back() = 0;
+      for (const auto & p : parts)
+        shape.back() += p.size(-1);
+      buf = _ws_buffer(tag,
+                       static_cast<std::size_t>(&seg - _segments.data()),
+                       packed.size(),
+                       shape,
+                       parts[0].options());
+    }
+    if (buf.defined())
+      packed.push_back(at::cat_out(buf, parts, /*dim=*/-1));
+    else
+      packed.push_back(at::cat(parts, /*dim=*/-1).contiguous());
   }
   return packed;
 }
 
 void
 Model::Impl::_unpack_groups(const std::vector<at::Tensor> & group_tensors,
-                            const std::vector<Segment::GroupInfo> & groups,
-                            std::map<std::string, at::Tensor> & state) const
+                            const Segment & seg,
+                            VarState state) const
 {
+  const auto & groups = seg.unknown_groups;
+  const auto & group_slots = _step_of(seg).unknown_group_slots;
   _assert(group_tensors.size() == groups.size(),
           "aoti::Model::_unpack_groups: tensor count ",
           group_tensors.size(),
           " != group count ",
           groups.size());
+  const bool copy_out = _ctx().workspace != nullptr;
   for (std::size_t gi = 0; gi < groups.size(); ++gi)
   {
     const auto & gt = group_tensors[gi];
@@ -185,8 +274,9 @@ Model::Impl::_unpack_groups(const std::vector<at::Tensor> & group_tensors,
       batch_shape.push_back(gt.size(d));
 
     int64_t offset = 0;
-    for (const auto & v : group.per_var_info)
+    for (std::size_t vi = 0; vi < group.per_var_info.size(); ++vi)
     {
+      const auto & v = group.per_var_info[vi];
       int64_t base_total = 1;
       for (auto s : v.base_shape)
         base_total *= s;
@@ -202,7 +292,9 @@ Model::Impl::_unpack_groups(const std::vector<at::Tensor> & group_tensors,
         target.push_back(s);
       for (auto s : v.base_shape)
         target.push_back(s);
-      state[v.name] = part.reshape(target).contiguous();
+      state.get(v.name, group_slots[gi][vi]) =
+          copy_out ? part.reshape(target).clone(at::MemoryFormat::Contiguous)
+                   : part.reshape(target).contiguous();
       offset += segment_size;
     }
   }
@@ -222,11 +314,11 @@ Model::Impl::_make_implicit_system(const Segment & seg,
   };
   auto u_layouts = to_layouts(seg.unknown_groups);
   auto r_layouts = to_layouts(seg.residual_groups);
-  auto params = _gather_params(seg.param_inputs);
+  auto params = _gather_params(_step_of(seg).params);
 
   if (_solver_kind == "krylov")
   {
-    _assert(seg.matvec_loader != nullptr,
+    _assert(static_cast<bool>(seg.matvec_loader),
             "aoti::Model: solver_kind is 'krylov' but the segment has no matvec "
             "graph. Regenerate the artifact via `neml2-compile`.");
     // The preconditioner (if any) is a pair of authored setup/apply graphs; both
@@ -241,18 +333,23 @@ Model::Impl::_make_implicit_system(const Segment & seg,
                                                        std::move(params),
                                                        _krylov_config);
   }
+  // The split LU graphs are only worth loading when the Jacobian is reused.
+  const bool reuse = _solver_config.jacobian_refresh != 1;
   return std::make_unique<AOTINonlinearSystem>(*seg.residual_loader,
                                                *seg.jacobian_loader,
                                                *seg.solve_loader,
                                                std::move(u_layouts),
                                                std::move(r_layouts),
                                                g_groups,
-                                               std::move(params));
+                                               std::move(params),
+                                               _solver_config.jacobian_refresh,
+                                               reuse ? seg.factor_loader.get() : nullptr,
+                                               reuse ? seg.solve_factored_loader.get() : nullptr);
 }
 
 void
 Model::Impl::_run_predictor(const Segment & seg,
-                            std::map<std::string, at::Tensor> & state,
+                            VarState state,
                             const at::TensorOptions & opts,
                             const std::vector<int64_t> & batch_shape) const
 {
@@ -261,6 +358,7 @@ Model::Impl::_run_predictor(const Segment & seg,
 
   const auto & fb = seg.predictor_feedback;
   const bool iterating = fb.iterations > 0;
+  const auto & step = _step_of(seg);
 
   // Seed the feedback input at zero before the first pass -- the graph is one
   // step of a loop, so on entry there is no previous step to read.
@@ -277,7 +375,9 @@ Model::Impl::_run_predictor(const Segment & seg,
     std::vector<int64_t> shape(batch_shape);
     shape.insert(shape.end(), fb.sub_batch_shape.begin(), fb.sub_batch_shape.end());
     shape.insert(shape.end(), fb.base_shape.begin(), fb.base_shape.end());
-    state[fb.input] = at::zeros(shape, opts);
+    const auto seg_idx = static_cast<std::size_t>(&seg - _segments.data());
+    state.get(fb.input, step.feedback_in_slot) =
+        _ws_zeros(WsTag::FeedbackSeed, seg_idx, 0, shape, opts);
   }
 
   // A single-shot predictor runs the body once, so this loop is the pre-v14
@@ -287,18 +387,18 @@ Model::Impl::_run_predictor(const Segment & seg,
   {
     std::vector<at::Tensor> p_inputs;
     p_inputs.reserve(seg.predictor_inputs.size() + seg.predictor_param_inputs.size());
-    for (const auto & name : seg.predictor_inputs)
+    for (std::size_t k = 0; k < seg.predictor_inputs.size(); ++k)
     {
-      auto it = state.find(name);
-      _assert(it != state.end(),
+      const at::Tensor * it = state.find(seg.predictor_inputs[k], step.predictor_in_slots[k]);
+      _assert(it,
               "aoti::Model: implicit segment predictor needs input '",
-              name,
+              seg.predictor_inputs[k],
               "' which is not in the state map.");
-      p_inputs.push_back(it->second.contiguous());
+      p_inputs.push_back(it->contiguous());
     }
     // The predictor is compiled without the residual's promoted tail; pass its
     // own (currently always empty) promoted-param list, not seg.param_inputs.
-    for (auto & p : _gather_params(seg.predictor_param_inputs))
+    for (auto & p : _gather_params(step.predictor_params))
       p_inputs.push_back(std::move(p));
 
     const auto p_outs = seg.predictor_loader->run(p_inputs);
@@ -313,15 +413,95 @@ Model::Impl::_run_predictor(const Segment & seg,
     // feedback input on the next pass; it is not an unknown, so writing it is
     // harmless.
     for (std::size_t i = 0; i < p_outs.size(); ++i)
-      state[seg.predictor_outputs[i]] = p_outs[i].to(opts).contiguous();
+      state.get(seg.predictor_outputs[i], step.predictor_out_slots[i]) =
+          p_outs[i].to(opts).contiguous();
     if (iterating)
-      state[fb.input] = state[fb.output];
+      state.get(fb.input, step.feedback_in_slot) = state.get(fb.output, step.feedback_out_slot);
+  }
+}
+
+Model::Impl::InitialGuessGuard::InitialGuessGuard(const Impl * i,
+                                                  const std::map<std::string, at::Tensor> & guess)
+  : ContextFrame(i)
+{
+  if (guess.empty())
+    return;
+  for (const auto & [name, t] : guess)
+  {
+    const Segment * owner = nullptr;
+    for (const auto & seg : i->_segments)
+      for (const auto & u : seg.unknowns)
+        if (u.name == name)
+          owner = &seg;
+    _assert(owner,
+            "aoti::Model: initial_guess names '",
+            name,
+            "', which is not an unknown of any implicit segment.");
+    _assert(owner->max_substepping_level == 0,
+            "aoti::Model: initial_guess names '",
+            name,
+            "', an unknown of a segment that substeps; its sub-steps start from their own "
+            "chained state, so it cannot take a guess.");
+    _assert(t.defined(), "aoti::Model: initial_guess for '", name, "' is undefined.");
+    // Whether some entry is left to the predictor: one read-back per guessed
+    // unknown until the first NaN turns up.
+    ctx.initial_guess_partial = ctx.initial_guess_partial || at::isnan(t).any().item<bool>();
+  }
+  ctx.initial_guess = &guess;
+}
+
+bool
+Model::Impl::_guesses_all(const Segment & seg) const
+{
+  const auto & ctx = _ctx();
+  const auto * guess = ctx.initial_guess;
+  if (guess == nullptr || ctx.initial_guess_partial)
+    return false;
+  for (const auto & u : seg.unknowns)
+    if (guess->find(u.name) == guess->end())
+      return false;
+  return true;
+}
+
+void
+Model::Impl::_apply_initial_guess(const Segment & seg,
+                                  VarState state,
+                                  const at::TensorOptions & opts,
+                                  const std::vector<int64_t> & batch_shape) const
+{
+  const auto & ctx = _ctx();
+  const auto * guess = ctx.initial_guess;
+  if (guess == nullptr)
+    return;
+  const auto & step = _step_of(seg);
+  for (std::size_t i = 0; i < seg.unknowns.size(); ++i)
+  {
+    const auto & u = seg.unknowns[i];
+    auto it = guess->find(u.name);
+    if (it == guess->end())
+      continue;
+    std::vector<int64_t> shape(batch_shape);
+    shape.insert(shape.end(), u.sub_batch_shape.begin(), u.sub_batch_shape.end());
+    shape.insert(shape.end(), u.base_shape.begin(), u.base_shape.end());
+    const auto & g = it->second;
+    _assert(at::is_expandable_to(g.sizes(), shape),
+            "aoti::Model: initial_guess for '",
+            u.name,
+            "' has shape ",
+            g.sizes(),
+            ", which does not broadcast to the unknown's shape ",
+            at::IntArrayRef(shape),
+            ".");
+    auto gu = g.to(opts).expand(shape);
+    // A NaN entry has no guess and keeps its predicted / incoming value.
+    auto & slot = state.get(u.name, step.unknown_slots[i]);
+    slot = ctx.initial_guess_partial ? at::where(at::isnan(gu), slot, gu) : gu;
   }
 }
 
 void
 Model::Impl::_run_implicit_segment(const Segment & seg,
-                                   std::map<std::string, at::Tensor> & state,
+                                   VarState state,
                                    std::vector<at::Tensor> & u_solved_groups,
                                    std::vector<at::Tensor> & g_groups) const
 {
@@ -331,13 +511,14 @@ Model::Impl::_run_implicit_segment(const Segment & seg,
   // predictor overrides matching names.
   _assert(!seg.givens.empty(),
           "aoti::Model: implicit segment has no givens; cannot infer batch shape.");
-  auto it_g0 = state.find(seg.givens[0].name);
-  _assert(it_g0 != state.end(),
+  const auto & step = _step_of(seg);
+  const at::Tensor * it_g0 = state.find(seg.givens[0].name, step.given_slots[0]);
+  _assert(it_g0,
           "aoti::Model: implicit segment needs given '",
           seg.givens[0].name,
           "' which is not in the state map.");
-  const auto opts = it_g0->second.options();
-  const auto g0 = it_g0->second;
+  const auto opts = it_g0->options();
+  const auto g0 = *it_g0;
   const auto & g0_info = seg.givens[0];
   const int64_t g0_trail =
       static_cast<int64_t>(g0_info.sub_batch_shape.size() + g0_info.base_shape.size());
@@ -366,21 +547,46 @@ Model::Impl::_run_implicit_segment(const Segment & seg,
   // seeding zeros unconditionally (the previous behavior) diverged the Newton on
   // stiff no-predictor models that eager solves fine (a parity violation). A
   // predictor, if present, overrides below.
-  for (const auto & v : seg.unknowns)
-    if (state.find(v.name) == state.end())
-      state[v.name] = at::zeros(_full_shape(v), opts);
-
-  _run_predictor(seg, state, opts, batch_shape);
-
-  // Pack per-group inputs at solve start (one at::cat per group).
-  g_groups = _pack_groups(state, seg.given_groups);
-  auto u0_groups = _pack_groups(state, seg.unknown_groups);
+  const auto seg_idx = static_cast<std::size_t>(&seg - _segments.data());
+  for (std::size_t i = 0; i < seg.unknowns.size(); ++i)
+    if (!state.find(seg.unknowns[i].name, step.unknown_slots[i]))
+      state.get(seg.unknowns[i].name, step.unknown_slots[i]) =
+          _ws_zeros(WsTag::U0, seg_idx, i, _full_shape(seg.unknowns[i]), opts);
+
+  // A caller-supplied guess outranks the predictor, so the predictor only runs
+  // when some unknown is left unguessed.
+  if (!_guesses_all(seg))
+    _run_predictor(seg, state, opts, batch_shape);
+  _apply_initial_guess(seg, state, opts, batch_shape);
+
+  // Pack per-group inputs at solve start (one at::cat per group), into the
+  // workspace's buffers when there is one.
+  g_groups = _pack_groups(state, seg, GroupSide::Given, /*pooled=*/true);
+  auto u0_groups = _pack_groups(state, seg, GroupSide::Unknown, /*pooled=*/true);
+
+  // Two trial-iterate slots per unknown group, when there is a workspace.
+  IterateBuffers trials;
+  if (_ctx().workspace)
+  {
+    trials.groups.resize(u0_groups.size());
+    for (std::size_t k = 0; k < u0_groups.size(); ++k)
+      for (std::size_t j = 0; j < 2; ++j)
+        trials.groups[k][j] = _ws_slot(WsTag::Trial, seg_idx, 2 * k + j, u0_groups[k].sizes());
+  }
 
   // Drive the shared Newton solver over an AOTI-backed system (direct or
   // matrix-free Krylov, per `_solver_kind`). The givens + promoted-parameter tail
   // are bound into the system (constant across the solve); the solver config comes
   // from the segment metadata.
   auto sys = _make_implicit_system(seg, g_groups);
+  // A recycling GMRES solve (`KrylovConfig::recycle`) keeps its recycle space in
+  // the caller's workspace, so the next call at this batch shape -- typically
+  // the next time step of the same material points -- starts from it.
+  at::Tensor * recycle = _solver_kind == "krylov" && _krylov_config.recycle > 0
+                             ? _ws_slot(WsTag::KrylovRecycle, seg_idx, 0, batch_shape)
+                             : nullptr;
+  if (recycle && recycle->defined())
+    sys->seed_recycle_space(*recycle);
   // Solver config is read from the shared metadata.json at construction
   // (overridable via set_solver_config). A failed solve (divergence or max-iterations) throws
   // ConvergenceError out of solve(), so reaching `.u` means it converged -- the
@@ -388,7 +594,11 @@ Model::Impl::_run_implicit_segment(const Segment & seg,
   // caller, who can cut the time step and retry.
   try
   {
-    u_solved_groups = Newton(_solver_config).solve(*sys, u0_groups).u;
+    auto res = Newton(_solver_config).solve(*sys, u0_groups, &trials);
+    _record_solve(seg, res);
+    u_solved_groups = std::move(res.u);
+    if (recycle)
+      *recycle = sys->recycle_space();
   }
   catch (const ConvergenceError & e)
   {
@@ -400,21 +610,77 @@ Model::Impl::_run_implicit_segment(const Segment & seg,
     // enriched with the context. Only the (debug) capture path pays the extra
     // masked solve; the normal failure path re-throws untouched above.
     const auto res = Newton(_solver_config).solve_masked(*sys, u0_groups);
-    _unpack_groups(res.u, seg.unknown_groups, state);
+    _unpack_groups(res.u, seg, state);
     std::map<std::string, at::Tensor> stuck;
-    for (const auto & v : seg.unknowns)
-      stuck[v.name] = state.at(v.name);
+    for (std::size_t i = 0; i < seg.unknowns.size(); ++i)
+      stuck[seg.unknowns[i].name] = state.get(seg.unknowns[i].name, step.unknown_slots[i]);
     throw ConvergenceError(e.what(), res.converged_mask, std::move(stuck));
   }
 
   // Unpack converged per-group unknowns back to per-variable state for
   // downstream forward segments / master outputs to read by name.
-  _unpack_groups(u_solved_groups, seg.unknown_groups, state);
+  _unpack_groups(u_solved_groups, seg, state);
+}
+
+void
+Model::Impl::_solve_or_recall(std::size_t i,
+                              const Segment & seg,
+                              std::map<std::string, at::Tensor> & state,
+                              std::vector<at::Tensor> & u_solved_groups,
+                              std::vector<at::Tensor> & g_groups,
+                              const ForwardMemo * memo) const
+{
+  if (memo == nullptr || memo->u_groups[i].empty())
+  {
+    _run_implicit_segment(seg, state, u_solved_groups, g_groups);
+    return;
+  }
+  // The memo's givens were packed from the same upstream values this call has
+  // just recomputed, so only the unknowns need to reach `state`.
+  u_solved_groups.clear();
+  g_groups.clear();
+  for (const auto & s : memo->u_groups[i])
+    u_solved_groups.push_back(s.t);
+  for (const auto & s : memo->g_groups[i])
+    g_groups.push_back(s.t);
+  _unpack_groups(u_solved_groups, seg, state);
+}
+
+void
+Model::Impl::_record_solve(const Segment & seg,
+                           const NewtonResult & res,
+                           const at::Tensor & rows) const
+{
+  auto * s = _seg_stats(seg);
+  if (s == nullptr)
+    return;
+  std::unique_lock<std::mutex> lock;
+  if (auto * m = _ctx().stats_mutex)
+    lock = std::unique_lock<std::mutex>(*m);
+  ++s->solves;
+  s->iterations += res.iterations;
+  s->linesearch_trials += res.stats.linesearch_trials;
+  s->matvecs += res.stats.matvecs;
+  s->precond_rebuilds += res.stats.precond_rebuilds;
+  s->residual_seconds += res.stats.residual_seconds;
+  s->step_seconds += res.stats.step_seconds;
+  // Per-row counts stay on the device; the substep driver pre-sizes the flat
+  // segment batch and passes the rows this solve covered.
+  const auto & n = res.stats.row_iterations;
+  if (!n.defined())
+    return;
+  if (rows.defined())
+    s->row_iterations.index_add_(0, rows, n.reshape({-1}));
+  else if (s->row_iterations.defined() && s->row_iterations.sizes().equals(n.sizes()))
+    s->row_iterations += n;
+  else
+    s->row_iterations = n.clone();
 }
 
 at::Tensor
 Model::Impl::_run_implicit_segment_masked(const Segment & seg,
-                                          std::map<std::string, at::Tensor> & state) const
+                                          std::map<std::string, at::Tensor> & state,
+                                          const at::Tensor & rows) const
 {
   // Same seed + predictor + pack path as `_run_implicit_segment`, but drives
   // `Newton::solve_masked` (returns the per-element convergence mask, no throw)
@@ -451,18 +717,19 @@ Model::Impl::_run_implicit_segment_masked(const Segment & seg,
   // Warm-start each unknown from its incoming state value (parity with eager's
   // `ImplicitUpdate._initial_unknowns`); zeros only when none is present. See the
   // value-path seed above for the rationale.
-  for (const auto & v : seg.unknowns)
-    if (state.find(v.name) == state.end())
-      state[v.name] = at::zeros(_full_shape(v), opts);
+  for (std::size_t i = 0; i < seg.unknowns.size(); ++i)
+    if (state.find(seg.unknowns[i].name) == state.end())
+      state[seg.unknowns[i].name] = at::zeros(_full_shape(seg.unknowns[i]), opts);
 
   _run_predictor(seg, state, opts, batch_shape);
 
-  auto g_groups = _pack_groups(state, seg.given_groups);
-  auto u0_groups = _pack_groups(state, seg.unknown_groups);
+  auto g_groups = _pack_groups(state, seg, GroupSide::Given);
+  auto u0_groups = _pack_groups(state, seg, GroupSide::Unknown);
 
   auto sys = _make_implicit_system(seg, g_groups);
   auto res = Newton(_solver_config).solve_masked(*sys, u0_groups);
-  _unpack_groups(res.u, seg.unknown_groups, state);
+  _record_solve(seg, res, rows);
+  _unpack_groups(res.u, seg, state);
   return res.converged_mask;
 }
 } // namespace neml2::aoti
@@ -37,21 +37,75 @@
 #include "neml2/csrc/aoti/log.h"
 #include "neml2/csrc/dispatchers/batch_chunk.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
 #include <functional>
+#include <mutex>
 #include <sstream>
+#include <thread>
+#include <vector>
+
+#include <ATen/Parallel.h>
+
+#if AT_PARALLEL_OPENMP && defined(__ELF__)
+// Bound at load time to the OpenMP runtime libtorch itself brought in. Weak, so
+// the library neither links a runtime of its own (a second copy next to the one
+// bundled with the torch wheels, which would cap nothing) nor fails to load.
+extern "C" void omp_set_num_threads(int) __attribute__((weak));
+#endif
 
 // Alias so the logging namespace is reachable as ``nlog``.
 namespace nlog = neml2::aoti::log;
 
 namespace neml2::aoti
 {
+namespace
+{
+// How a substep worker caps its own intra-op team, or null where it cannot.
+// Under OpenMP the team size is a per-thread setting, while
+// `at::set_num_threads` also moves the process-wide default; torch's native
+// pool is shared by all callers, so there is nothing to cap.
+using ThreadCap = void (*)(int);
+
+ThreadCap
+intraop_thread_cap()
+{
+#if AT_PARALLEL_OPENMP && defined(__ELF__)
+  return omp_set_num_threads;
+#elif AT_PARALLEL_OPENMP
+  return nullptr;
+#else
+  return [](int) {};
+#endif
+}
+
+// A sub-span coefficient as it multiplies the given `t`: a scalar as is, a
+// per-row vector broadcast over the trailing axes of `t`.
+inline double
+span_coef(double c, const at::Tensor & /*t*/)
+{
+  return c;
+}
+
+inline at::Tensor
+span_coef(const at::Tensor & c, const at::Tensor & t)
+{
+  std::vector<int64_t> shape(static_cast<std::size_t>(std::max<int64_t>(t.dim(), 1)), 1);
+  shape[0] = -1;
+  return c.to(t.scalar_type()).reshape(shape);
+}
+
+// The body of both `_apply_substep_span` overloads.
+template <typename GivenT, typename Coef>
 void
-Model::Impl::_apply_substep_span(const Segment & seg,
-                                 const std::map<std::string, at::Tensor> & orig,
-                                 double a,
-                                 double b,
-                                 const std::map<std::string, at::Tensor> & chained,
-                                 std::map<std::string, at::Tensor> & dst) const
+apply_substep_span(const std::vector<GivenT> & givens,
+                   const std::map<std::string, at::Tensor> & orig,
+                   const Coef & a,
+                   const Coef & b,
+                   const std::map<std::string, at::Tensor> & chained,
+                   std::map<std::string, at::Tensor> & dst)
 {
   // Paired forces interpolate linearly between the increment's endpoints (so the
   // deformation *rate* over dt/M is unchanged -- time is itself an old/cur force
@@ -59,7 +113,7 @@ Model::Impl::_apply_substep_span(const Segment & seg,
   // anything else is held at its endpoint value. The same coefficients apply to
   // the primal state and to the dstate (chain-rule) carrier -- that is why this
   // is shared.
-  for (const auto & g : seg.givens)
+  for (const auto & g : givens)
   {
     if (g.role == "old_state")
     {
@@ -75,14 +129,14 @@ Model::Impl::_apply_substep_span(const Segment & seg,
       // name is the OLD endpoint (~1); pair (the current force) is the NEW.
       const auto & old_e = orig.at(g.name);
       const auto & new_e = orig.at(g.pair);
-      dst[g.name] = old_e + (new_e - old_e) * a;
+      dst[g.name] = old_e + (new_e - old_e) * span_coef(a, old_e);
     }
     else if (g.role == "cur_force")
     {
       // pair (the ~1 force) is the OLD endpoint; name is the NEW.
       const auto & old_e = orig.at(g.pair);
       const auto & new_e = orig.at(g.name);
-      dst[g.name] = old_e + (new_e - old_e) * b;
+      dst[g.name] = old_e + (new_e - old_e) * span_coef(b, old_e);
     }
     else
     {
@@ -91,6 +145,29 @@ Model::Impl::_apply_substep_span(const Segment & seg,
     }
   }
 }
+} // namespace
+
+void
+Model::Impl::_apply_substep_span(const Segment & seg,
+                                 const std::map<std::string, at::Tensor> & orig,
+                                 double a,
+                                 double b,
+                                 const std::map<std::string, at::Tensor> & chained,
+                                 std::map<std::string, at::Tensor> & dst) const
+{
+  apply_substep_span(seg.givens, orig, a, b, chained, dst);
+}
+
+void
+Model::Impl::_apply_substep_span(const Segment & seg,
+                                 const std::map<std::string, at::Tensor> & orig,
+                                 const at::Tensor & a,
+                                 const at::Tensor & b,
+                                 const std::map<std::string, at::Tensor> & chained,
+                                 std::map<std::string, at::Tensor> & dst) const
+{
+  apply_substep_span(seg.givens, orig, a, b, chained, dst);
+}
 
 // ----------------------------------------------------------------------------
 // Per-element (masked) substepping -- the ONLY substepping path
@@ -150,12 +227,291 @@ unflatten_dyn(const at::Tensor & t, const std::vector<int64_t> & dyn, int64_t tr
   return t.reshape(shape);
 }
 
+// collect_stats bookkeeping around one driver run. Each masked solve adds its
+// per-row iterations at its `active` rows of the flat batch, so the segment's
+// count is swapped for zeros(B) here and the earlier count (a previous solve of
+// this segment in the same call) handed back to `end_row_stats`.
+at::Tensor
+begin_row_stats(SegmentStats * st, int64_t B, const at::TensorOptions & idx_opts)
+{
+  if (st == nullptr)
+    return {};
+  auto prior = std::move(st->row_iterations);
+  st->row_iterations = at::zeros({B}, idx_opts);
+  return prior;
+}
+
+// Reshape the driver's per-row count back to the call batch `dyn`, fold in the
+// `prior` count, and record the sub-step depth reached, overall and per row.
+void
+end_row_stats(SegmentStats * st,
+              const at::Tensor & prior,
+              const std::vector<int64_t> & dyn,
+              int64_t depth,
+              const at::Tensor & row_depth)
+{
+  if (st == nullptr)
+    return;
+  st->substep_depth = std::max(st->substep_depth, static_cast<std::size_t>(depth));
+  auto n = st->row_iterations.reshape(dyn);
+  if (prior.defined() && prior.sizes().equals(n.sizes()))
+    n = n + prior;
+  st->row_iterations = std::move(n);
+  auto d = row_depth.reshape(dyn);
+  const auto & prior_d = st->row_substep_depth;
+  if (prior_d.defined() && prior_d.sizes().equals(d.sizes()))
+    d = at::maximum(d, prior_d);
+  st->row_substep_depth = std::move(d);
+}
+
+// Whether the driver runs the adaptive schedule (`SolverConfig::substep_method`).
+bool
+adaptive_substeps(const SolverConfig & cfg)
+{
+  _assert(cfg.substep_method == "BISECT" || cfg.substep_method == "ADAPTIVE",
+          "SolverConfig::substep_method must be BISECT or ADAPTIVE, got '",
+          cfg.substep_method,
+          "'");
+  return cfg.substep_method == "ADAPTIVE";
+}
+
+// Per-row step control of the adaptive schedule. Row i sits at `pos[i]` and
+// steps by `2^(L - lvl[i])`, both in units of the finest step 2^-L allowed by
+// the depth cap L, so the positions stay exact and every span lies on the
+// bisection grid. A failed span halves the row's step. After `grow_after`
+// converged spans in a row the step doubles again, as soon as the row sits on
+// the coarser grid. Rows start at level `start` (a substep hint) or at 0. The
+// level a row ends the increment on (its last converged step, coarsened if that
+// completed a streak) is what it reports as its next hint, so a hint relaxes
+// again once a row stops failing. The state lives on the device; the driver
+// syncs once per round, in `next`.
+class SubstepSchedule
+{
+public:
+  SubstepSchedule(int64_t B,
+                  int L,
+                  std::size_t grow_after,
+                  const at::TensorOptions & idx_opts,
+                  const at::Tensor & start = {})
+    : _cap(L),
+      _end(int64_t(1) << L),
+      _grow_after(std::max<int64_t>(static_cast<int64_t>(grow_after), 1)),
+      _pos(at::zeros({B}, idx_opts)),
+      _lvl(start.defined() ? start.clone() : at::zeros({B}, idx_opts)),
+      _streak(at::zeros({B}, idx_opts)),
+      _deepest(_lvl.clone())
+  {
+  }
+
+  /// The rows short of the end of the increment, with their next spans [a, b]
+  /// as fractions of it (dtype and device of `opts`).
+  at::Tensor next(at::Tensor & a, at::Tensor & b, const at::TensorOptions & opts) const
+  {
+    auto active = mask_to_idx(_pos < _end);
+    const auto pos = _pos.index_select(0, active);
+    const auto step = step_of(_lvl.index_select(0, active));
+    a = pos.to(opts) / static_cast<double>(_end);
+    b = (pos + step).to(opts) / static_cast<double>(_end);
+    return active;
+  }
+
+  /// How many of the failed rows (`fail` indexes `active`) were already at the
+  /// finest step.
+  int64_t at_cap(const at::Tensor & active, const at::Tensor & fail) const
+  {
+    return (_lvl.index_select(0, active.index_select(0, fail)) >= _cap).sum().item<int64_t>();
+  }
+
+  /// Advance the converged rows of `active` and refine the failed ones.
+  void update(const at::Tensor & active, const at::Tensor & fail)
+  {
+    auto ok = at::ones({active.numel()}, active.options().dtype(at::kBool));
+    ok.index_fill_(0, fail, false);
+    const auto lvl = _lvl.index_select(0, active);
+    const auto step = step_of(lvl);
+    auto pos = _pos.index_select(0, active);
+    pos = at::where(ok, pos + step, pos);
+    auto streak = at::where(ok, _streak.index_select(0, active) + 1, 0);
+    // Grow only onto the coarser grid: pos a multiple of the doubled step.
+    const auto aligned = at::remainder(pos, 2 * step) == 0;
+    const auto grow = ok & (streak >= _grow_after) & (lvl > 0) & aligned;
+    const auto new_lvl = at::where(grow, lvl - 1, at::where(ok, lvl, lvl + 1));
+    streak = at::where(grow, 0, streak);
+    _pos.index_copy_(0, active, pos);
+    _lvl.index_copy_(0, active, new_lvl);
+    _streak.index_copy_(0, active, streak);
+    _deepest.index_copy_(0, active, at::maximum(_deepest.index_select(0, active), new_lvl));
+  }
+
+  /// The level each row finished the increment on (its next hint), and the
+  /// deepest level reached over all rows.
+  const at::Tensor & row_depth() const { return _lvl; }
+  int64_t depth() const { return _deepest.numel() > 0 ? _deepest.max().item<int64_t>() : 0; }
+
+private:
+  at::Tensor step_of(const at::Tensor & lvl) const { return at::pow(2, _cap - lvl); }
+
+  const int64_t _cap;
+  const int64_t _end;
+  const int64_t _grow_after;
+  at::Tensor _pos, _lvl, _streak, _deepest;
+};
 } // namespace
 
+at::Tensor
+Model::Impl::_substep_hint(const Segment & seg,
+                           int64_t B,
+                           const at::TensorOptions & idx_opts) const
+{
+  const auto * hint = _ctx().substep_hint;
+  if (hint == nullptr)
+    return {};
+  // The hint is indexed like `SolveStats::segments`: implicit segments only.
+  std::size_t k = 0;
+  for (const auto & s : _segments)
+  {
+    if (&s == &seg)
+      break;
+    if (s.kind == SegmentKind::Implicit)
+      ++k;
+  }
+  if (k >= hint->size() || !(*hint)[k].defined())
+    return {};
+  const auto & h = (*hint)[k];
+  _assert(h.numel() == B,
+          "aoti::Model: substep_hint for implicit segment ",
+          k,
+          " has ",
+          h.numel(),
+          " elements; expected one per batch element (",
+          B,
+          ").");
+  return h.reshape({B}).to(idx_opts).clamp(0, seg.max_substepping_level);
+}
+
+int64_t
+Model::Impl::_substep_parts(const at::Tensor & rows) const
+{
+  const auto workers = static_cast<int64_t>(_solver_config.substep_workers);
+  const auto min_rows =
+      std::max<int64_t>(static_cast<int64_t>(_solver_config.substep_split_rows), 1);
+  if (workers < 2 || !rows.device().is_cpu() || !intraop_thread_cap())
+    return 1;
+  return std::clamp<int64_t>(rows.numel() / min_rows, 1, workers);
+}
+
+void
+Model::Impl::_run_substep_parts(const at::Tensor & rows,
+                                int64_t parts,
+                                std::mutex & stats_mutex,
+                                const std::function<void(const at::Tensor &)> & fn) const
+{
+  const auto chunks = rows.tensor_split(parts);
+  const auto cap = intraop_thread_cap();
+  const int share = std::max(1, at::get_num_threads() / static_cast<int>(parts));
+  auto ctx = _ctx();
+  ctx.stats_mutex = &stats_mutex;
+  std::vector<std::exception_ptr> errors(chunks.size());
+  // Every part runs on a pool worker and the caller only waits, so its own
+  // intra-op setting is never touched. A worker first takes the process-wide
+  // setting (`at::init_num_threads`, as ATen's own threads do) and then caps
+  // its own team at `share`.
+  std::mutex done_mutex;
+  std::condition_variable done_cv;
+  std::size_t pending = chunks.size();
+  const auto wait_all = [&]
+  {
+    std::unique_lock<std::mutex> lock(done_mutex);
+    done_cv.wait(lock, [&] { return pending == 0; });
+  };
+  std::size_t queued = 0;
+  try
+  {
+    for (; queued < chunks.size(); ++queued)
+      _substep_pool.run(chunks.size(),
+                        [&, k = queued]
+                        {
+                          try
+                          {
+                            at::init_num_threads();
+                            cap(share);
+                            const InheritedFrame frame(this, ctx);
+                            fn(chunks[k]);
+                          }
+                          catch (...)
+                          {
+                            errors[k] = std::current_exception();
+                          }
+                          const std::lock_guard<std::mutex> lock(done_mutex);
+                          if (--pending == 0)
+                            done_cv.notify_one();
+                        });
+  }
+  catch (...)
+  {
+    // Failed to start a worker or queue a part: the parts already queued refer
+    // to this frame, so they must finish before the failure propagates.
+    {
+      const std::lock_guard<std::mutex> lock(done_mutex);
+      pending -= chunks.size() - queued;
+    }
+    wait_all();
+    throw;
+  }
+  wait_all();
+  for (const auto & e : errors)
+    if (e)
+      std::rethrow_exception(e);
+}
+
+Model::Impl::SubstepPool::~SubstepPool()
+{
+  {
+    const std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _cv.notify_all();
+  for (auto & t : _threads)
+    t.join();
+}
+
+void
+Model::Impl::SubstepPool::run(std::size_t workers, std::function<void()> task)
+{
+  {
+    const std::lock_guard<std::mutex> lock(_mutex);
+    while (_threads.size() < workers)
+      _threads.emplace_back([this] { worker_main(); });
+    _tasks.push(std::move(task));
+  }
+  _cv.notify_one();
+}
+
+void
+Model::Impl::SubstepPool::worker_main()
+{
+  while (true)
+  {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _cv.wait(lock, [&] { return _stop || !_tasks.empty(); });
+      if (_stop && _tasks.empty())
+        return;
+      task = std::move(_tasks.front());
+      _tasks.pop();
+    }
+    task();
+  }
+}
+
 void
 Model::Impl::_run_implicit_segment_substepped_masked(
     const Segment & seg, std::map<std::string, at::Tensor> & state) const
 {
+  // Sub-step solves run on row subsets whose sizes change from call to call, so
+  // a workspace would only collect buffers it never reuses; solve without it.
+  const WorkspaceGuard _nows(this, nullptr);
   const bool capture = capture_solve_failure_enabled();
 
   // Flatten the dynamic batch to a single leading axis (see the file-level note);
@@ -200,6 +556,8 @@ Model::Impl::_run_implicit_segment_substepped_masked(
     result[u.name] = at::zeros(full_shape(u), opts);
 
   const auto idx_opts = at::TensorOptions().dtype(at::kLong).device(g0.device());
+  auto * seg_stats = _seg_stats(seg);
+  const auto prior_rows = begin_row_stats(seg_stats, B, idx_opts);
 
   const bool console_info = nlog::enabled(nlog::Channel::Substep, nlog::Level::Info);
   const bool console_debug = nlog::enabled(nlog::Channel::Substep, nlog::Level::Debug);
@@ -208,40 +566,32 @@ Model::Impl::_run_implicit_segment_substepped_masked(
   at::Tensor cap_mask;
   std::map<std::string, at::Tensor> cap_unknowns;
   int64_t n_solves = 0, max_depth = 0, n_substepped = 0;
-  std::function<void(double, double, const at::Tensor &, int)> solve_to =
-      [&](double a, double b, const at::Tensor & active, int level)
+  // Guards the running buffers and counters once failing rows are solved as
+  // concurrent sub-batches, and serializes their statistics.
+  std::mutex mtx;
+  // Solve the sub-step givens `span` of the `active` rows and freeze the rows
+  // that converged: their unknowns go to `result`, their new old-state to
+  // `chained`. `first` marks the single-shot solve over the full increment.
+  // Returns the indices (into `active`) of the rows that failed.
+  const auto solve_span =
+      [&](std::map<std::string, at::Tensor> & span, const at::Tensor & active, bool first)
   {
-    auto orig_a = index_select_batch(orig, active);
-    auto chained_a = index_select_batch(chained, active);
-    std::map<std::string, at::Tensor> span;
-    _apply_substep_span(seg, orig_a, a, b, chained_a, span);
-    auto mask = _run_implicit_segment_masked(seg, span);
+    auto mask = _run_implicit_segment_masked(seg, span, seg_stats ? active : at::Tensor());
     auto conv = mask_to_idx(mask);
     auto fail = mask_to_idx(at::logical_not(mask));
+    const std::lock_guard<std::mutex> lock(mtx);
     ++n_solves;
-    max_depth = std::max(max_depth, static_cast<int64_t>(level));
-    if (level == 0)
+    if (first)
       n_substepped = fail.numel(); // rows that failed the full step need substepping
-    if (capture && level == 0)
+    if (capture && first)
     {
-      // Level 0 = the single-shot masked solve over the full increment (all rows
-      // active): its mask + best-effort iterate are the failure context, matching
-      // the non-substepped capture in solve.cpp.
+      // The single-shot masked solve over the full increment (all rows active):
+      // its mask + best-effort iterate are the failure context, matching the
+      // non-substepped capture in solve.cpp.
       cap_mask = mask;
       for (const auto & u : seg.unknowns)
         cap_unknowns[u.name] = span.at(u.name);
     }
-    // LCOV_EXCL_START -- diagnostic per-sub-span trace (verbosity-gated; see neml2.log)
-    if (console_debug)
-    {
-      std::ostringstream oss;
-      // Indent by bisection depth so the sub-span tree is visible at a glance.
-      oss << std::string(static_cast<std::size_t>(2 * (level + 1)), ' ') << "span [" << a << ", "
-          << b << "] L" << level << ": active=" << active.numel()
-          << " -> converged=" << conv.numel() << " failed=" << fail.numel();
-      nlog::emit(nlog::Channel::Substep, nlog::Level::Debug, oss.str());
-    }
-    // LCOV_EXCL_STOP
     if (conv.numel() > 0)
     {
       auto conv_g = active.index_select(0, conv);
@@ -254,41 +604,128 @@ Model::Impl::_run_implicit_segment_substepped_masked(
           cc[g.name] = span.at(g.pair).index_select(0, conv);
       scatter_batch_(chained, conv_g, cc);
     }
+    return fail;
+  };
+  // Maxing out substepping is a RECOVERABLE convergence failure -- a
+  // time-stepping consumer (e.g. MOOSE) cuts the outer step and retries -- so
+  // it must throw the recoverable ConvergenceError, NOT `_assert` (which
+  // throws the non-recoverable FatalError, defeating a `recoverable()` retry
+  // and making a maxed-out substep unrecoverable downstream).
+  const auto give_up = [&](int64_t n_fail)
+  {
+    const std::string msg = "aoti::Model substepping: " + std::to_string(n_fail) +
+                            " element(s) failed to converge at max_substepping_level=" +
+                            std::to_string(seg.max_substepping_level) +
+                            ". Reduce the outer time step.";
+    // Attach the level-0 (single-shot) failure context when capture is on,
+    // reshaped back to the original dynamic batch.
+    if (capture)
+    {
+      std::map<std::string, at::Tensor> stuck;
+      for (const auto & u : seg.unknowns)
+        stuck[u.name] = reshape_needed ? unflatten_dyn(cap_unknowns.at(u.name), dyn, var_trail(u))
+                                       : cap_unknowns.at(u.name);
+      throw ConvergenceError(
+          msg, reshape_needed ? cap_mask.reshape(dyn) : cap_mask, std::move(stuck));
+    }
+    throw ConvergenceError(msg);
+  };
+  // Deepest level per row, for the statistics (and the caller's next hint).
+  auto row_depth = seg_stats ? at::zeros({B}, idx_opts) : at::Tensor();
+  // Whether failing rows are being solved as concurrent sub-batches
+  // (`_run_substep_parts`); the sub-batches themselves do not split again.
+  std::atomic<bool> splitting{false};
+  const auto hint = _substep_hint(seg, B, idx_opts);
+  std::function<void(double, double, const at::Tensor &, int)> solve_to =
+      [&](double a, double b, const at::Tensor & active, int level)
+  {
+    std::map<std::string, at::Tensor> span;
+    {
+      const std::lock_guard<std::mutex> lock(mtx);
+      auto orig_a = index_select_batch(orig, active);
+      auto chained_a = index_select_batch(chained, active);
+      _apply_substep_span(seg, orig_a, a, b, chained_a, span);
+    }
+    auto fail = solve_span(span, active, level == 0);
+    {
+      const std::lock_guard<std::mutex> lock(mtx);
+      max_depth = std::max(max_depth, static_cast<int64_t>(level));
+      if (row_depth.defined())
+        row_depth.index_copy_(0, active, row_depth.index_select(0, active).clamp_min(level));
+    }
+    // LCOV_EXCL_START -- diagnostic per-sub-span trace (verbosity-gated; see neml2.log)
+    if (console_debug)
+    {
+      std::ostringstream oss;
+      // Indent by bisection depth so the sub-span tree is visible at a glance.
+      oss << std::string(static_cast<std::size_t>(2 * (level + 1)), ' ') << "span [" << a << ", "
+          << b << "] L" << level << ": active=" << active.numel()
+          << " -> converged=" << active.numel() - fail.numel() << " failed=" << fail.numel();
+      nlog::emit(nlog::Channel::Substep, nlog::Level::Debug, oss.str());
+    }
+    // LCOV_EXCL_STOP
     if (fail.numel() > 0)
     {
-      // Maxing out substepping is a RECOVERABLE convergence failure -- a
-      // time-stepping consumer (e.g. MOOSE) cuts the outer step and retries -- so
-      // it must throw the recoverable ConvergenceError, NOT `_assert` (which
-      // throws the non-recoverable FatalError, defeating a `recoverable()` retry
-      // and making a maxed-out substep unrecoverable downstream).
       if (level >= seg.max_substepping_level)
-      {
-        const std::string msg = "aoti::Model substepping: " + std::to_string(fail.numel()) +
-                                " element(s) failed to converge at max_substepping_level=" +
-                                std::to_string(seg.max_substepping_level) +
-                                ". Reduce the outer time step.";
-        // Attach the level-0 (single-shot) failure context when capture is on,
-        // reshaped back to the original dynamic batch.
-        if (capture)
-        {
-          std::map<std::string, at::Tensor> stuck;
-          for (const auto & u : seg.unknowns)
-            stuck[u.name] = reshape_needed
-                                ? unflatten_dyn(cap_unknowns.at(u.name), dyn, var_trail(u))
-                                : cap_unknowns.at(u.name);
-          throw ConvergenceError(
-              msg, reshape_needed ? cap_mask.reshape(dyn) : cap_mask, std::move(stuck));
-        }
-        throw ConvergenceError(msg);
-      }
+        give_up(fail.numel());
       auto fail_g = active.index_select(0, fail);
       const double mid = 0.5 * (a + b);
-      solve_to(a, mid, fail_g, level + 1);
-      solve_to(mid, b, fail_g, level + 1);
+      const auto descend = [&, a, b, mid, level](const at::Tensor & rows)
+      {
+        solve_to(a, mid, rows, level + 1);
+        solve_to(mid, b, rows, level + 1);
+      };
+      // The failing rows' sub-steps are independent of each other, so a large
+      // enough subset runs as concurrent sub-batches.
+      if (const auto parts = splitting ? 1 : _substep_parts(fail_g); parts > 1)
+      {
+        splitting = true;
+        _run_substep_parts(fail_g, parts, mtx, descend);
+        splitting = false;
+      }
+      else
+        descend(fail_g);
     }
   };
 
-  solve_to(0.0, 1.0, at::arange(B, idx_opts), 0);
+  if (adaptive_substeps(_solver_config) || hint.defined())
+  {
+    // Every row marches on its own step; one masked solve per round advances
+    // all the rows still short of the end of the increment. A hinted row takes
+    // its first step at its hinted level rather than across the full increment.
+    SubstepSchedule sched(
+        B, seg.max_substepping_level, _solver_config.substep_grow_after, idx_opts, hint);
+    at::Tensor a, b;
+    for (int64_t round = 0;; ++round)
+    {
+      const auto active = sched.next(a, b, opts);
+      if (active.numel() == 0)
+        break;
+      auto orig_a = index_select_batch(orig, active);
+      auto chained_a = index_select_batch(chained, active);
+      std::map<std::string, at::Tensor> span;
+      _apply_substep_span(seg, orig_a, a, b, chained_a, span);
+      auto fail = solve_span(span, active, round == 0);
+      // LCOV_EXCL_START -- diagnostic per-round trace (verbosity-gated; see neml2.log)
+      if (console_debug)
+      {
+        std::ostringstream oss;
+        oss << "  round " << round << ": active=" << active.numel()
+            << " -> converged=" << active.numel() - fail.numel() << " failed=" << fail.numel();
+        nlog::emit(nlog::Channel::Substep, nlog::Level::Debug, oss.str());
+      }
+      // LCOV_EXCL_STOP
+      if (fail.numel() > 0)
+        if (const auto n_stuck = sched.at_cap(active, fail); n_stuck > 0)
+          give_up(n_stuck);
+      sched.update(active, fail);
+    }
+    max_depth = sched.depth();
+    row_depth = sched.row_depth();
+  }
+  else
+    solve_to(0.0, 1.0, at::arange(B, idx_opts), 0);
+  end_row_stats(seg_stats, prior_rows, dyn, max_depth, row_depth);
   // LCOV_EXCL_START -- diagnostic per-solve substep summary
   if (console_info)
   {
@@ -318,6 +755,7 @@ Model::Impl::_run_implicit_segment_substepped_masked_jacobian(
     std::map<std::string, at::Tensor> & state,
     std::map<std::string, at::Tensor> & dstate) const
 {
+  const WorkspaceGuard _nows(this, nullptr); // see the value driver
   const bool capture = capture_solve_failure_enabled();
 
   // Flatten the dynamic batch to a single leading axis (see the file-level note).
@@ -378,6 +816,8 @@ Model::Impl::_run_implicit_segment_substepped_masked_jacobian(
   }
 
   const auto idx_opts = at::TensorOptions().dtype(at::kLong).device(g0.device());
+  auto * seg_stats = _seg_stats(seg);
+  const auto prior_rows = begin_row_stats(seg_stats, B, idx_opts);
 
   const bool console_info = nlog::enabled(nlog::Channel::Substep, nlog::Level::Info);
   const bool console_debug = nlog::enabled(nlog::Channel::Substep, nlog::Level::Debug);
@@ -385,52 +825,47 @@ Model::Impl::_run_implicit_segment_substepped_masked_jacobian(
   at::Tensor cap_mask;
   std::map<std::string, at::Tensor> cap_unknowns;
   int64_t n_solves = 0, max_depth = 0, n_substepped = 0;
-  std::function<void(double, double, const at::Tensor &, int)> solve_to =
-      [&](double a, double b, const at::Tensor & active, int level)
+  // Guards the running buffers and counters once failing rows are solved as
+  // concurrent sub-batches, and serializes their statistics.
+  std::mutex mtx;
+  // Solve the sub-step givens `span` (tangent carrier `span_d`) of the `active`
+  // rows; for the rows that converged, run the IFT and freeze unknowns and
+  // tangents into `result` / `result_d`, their new old-state into `chained` /
+  // `chained_d`. `first` marks the single-shot solve over the full increment.
+  // Returns the indices (into `active`) of the rows that failed.
+  const auto solve_span = [&](std::map<std::string, at::Tensor> & span,
+                              std::map<std::string, at::Tensor> & span_d,
+                              const at::Tensor & active,
+                              bool first)
   {
-    auto orig_a = index_select_batch(orig, active);
-    auto chained_a = index_select_batch(chained, active);
-    auto orig_da = index_select_batch(orig_d, active);
-    auto chained_da = index_select_batch(chained_d, active);
-    std::map<std::string, at::Tensor> span, span_d;
-    _apply_substep_span(seg, orig_a, a, b, chained_a, span);
-    _apply_substep_span(seg, orig_da, a, b, chained_da, span_d);
-    auto mask = _run_implicit_segment_masked(seg, span);
+    auto mask = _run_implicit_segment_masked(seg, span, seg_stats ? active : at::Tensor());
     auto conv = mask_to_idx(mask);
     auto fail = mask_to_idx(at::logical_not(mask));
-    ++n_solves;
-    max_depth = std::max(max_depth, static_cast<int64_t>(level));
-    if (level == 0)
-      n_substepped = fail.numel();
-    if (capture && level == 0)
-    {
-      // Level 0 = the single-shot masked solve; its mask + best-effort value
-      // iterate are the failure context (same semantics as solve.cpp).
-      cap_mask = mask;
-      for (const auto & u : seg.unknowns)
-        cap_unknowns[u.name] = span.at(u.name);
-    }
-    // LCOV_EXCL_START -- diagnostic per-sub-span trace (verbosity-gated; see neml2.log)
-    if (console_debug)
     {
-      std::ostringstream oss;
-      // Indent by bisection depth so the sub-span tree is visible at a glance.
-      oss << std::string(static_cast<std::size_t>(2 * (level + 1)), ' ') << "span [" << a << ", "
-          << b << "] L" << level << ": active=" << active.numel()
-          << " -> converged=" << conv.numel() << " failed=" << fail.numel();
-      nlog::emit(nlog::Channel::Substep, nlog::Level::Debug, oss.str());
+      const std::lock_guard<std::mutex> lock(mtx);
+      ++n_solves;
+      if (first)
+        n_substepped = fail.numel();
+      if (capture && first)
+      {
+        // The single-shot masked solve; its mask + best-effort value iterate
+        // are the failure context (same semantics as solve.cpp).
+        cap_mask = mask;
+        for (const auto & u : seg.unknowns)
+          cap_unknowns[u.name] = span.at(u.name);
+      }
     }
-    // LCOV_EXCL_STOP
     if (conv.numel() > 0)
     {
       auto conv_g = active.index_select(0, conv);
       auto conv_span = index_select_batch(span, conv);
       auto conv_span_d = index_select_batch(span_d, conv);
-      auto u_groups = _pack_groups(conv_span, seg.unknown_groups);
-      auto g_groups = _pack_groups(conv_span, seg.given_groups);
+      auto u_groups = _pack_groups(conv_span, seg, GroupSide::Unknown);
+      auto g_groups = _pack_groups(conv_span, seg, GroupSide::Given);
       // Overwrites conv_span_d[unknown] = Σ (-A⁻¹B)_{u,g}·conv_span_d[g]
       //   = A_k·J_{k-1} + B_k·frac_k·J_endpoint for this span's converged rows.
       _run_implicit_segment_jacobian(seg, u_groups, g_groups, conv_span_d);
+      const std::lock_guard<std::mutex> lock(mtx);
       std::map<std::string, at::Tensor> cs, csd, cc, ccd;
       for (const auto & u : seg.unknowns)
       {
@@ -448,41 +883,133 @@ Model::Impl::_run_implicit_segment_substepped_masked_jacobian(
       scatter_batch_(chained, conv_g, cc);
       scatter_batch_(chained_d, conv_g, ccd);
     }
+    return fail;
+  };
+  // Maxing out substepping is a RECOVERABLE convergence failure -- a
+  // time-stepping consumer (e.g. MOOSE) cuts the outer step and retries -- so
+  // it must throw the recoverable ConvergenceError, NOT `_assert` (which
+  // throws the non-recoverable FatalError, defeating a `recoverable()` retry
+  // and making a maxed-out substep unrecoverable downstream).
+  const auto give_up = [&](int64_t n_fail)
+  {
+    const std::string msg = "aoti::Model substepping: " + std::to_string(n_fail) +
+                            " element(s) failed to converge at max_substepping_level=" +
+                            std::to_string(seg.max_substepping_level) +
+                            ". Reduce the outer time step.";
+    // Attach the level-0 (single-shot) failure context when capture is on,
+    // reshaped back to the original dynamic batch.
+    if (capture)
+    {
+      std::map<std::string, at::Tensor> stuck;
+      for (const auto & u : seg.unknowns)
+        stuck[u.name] = reshape_needed ? unflatten_dyn(cap_unknowns.at(u.name), dyn, var_trail(u))
+                                       : cap_unknowns.at(u.name);
+      throw ConvergenceError(
+          msg, reshape_needed ? cap_mask.reshape(dyn) : cap_mask, std::move(stuck));
+    }
+    throw ConvergenceError(msg);
+  };
+  // Deepest level per row, for the statistics (and the caller's next hint).
+  auto row_depth = seg_stats ? at::zeros({B}, idx_opts) : at::Tensor();
+  // Whether failing rows are being solved as concurrent sub-batches
+  // (`_run_substep_parts`); the sub-batches themselves do not split again.
+  std::atomic<bool> splitting{false};
+  const auto hint = _substep_hint(seg, B, idx_opts);
+  std::function<void(double, double, const at::Tensor &, int)> solve_to =
+      [&](double a, double b, const at::Tensor & active, int level)
+  {
+    std::map<std::string, at::Tensor> span, span_d;
+    {
+      const std::lock_guard<std::mutex> lock(mtx);
+      auto orig_a = index_select_batch(orig, active);
+      auto chained_a = index_select_batch(chained, active);
+      auto orig_da = index_select_batch(orig_d, active);
+      auto chained_da = index_select_batch(chained_d, active);
+      _apply_substep_span(seg, orig_a, a, b, chained_a, span);
+      _apply_substep_span(seg, orig_da, a, b, chained_da, span_d);
+    }
+    auto fail = solve_span(span, span_d, active, level == 0);
+    {
+      const std::lock_guard<std::mutex> lock(mtx);
+      max_depth = std::max(max_depth, static_cast<int64_t>(level));
+      if (row_depth.defined())
+        row_depth.index_copy_(0, active, row_depth.index_select(0, active).clamp_min(level));
+    }
+    // LCOV_EXCL_START -- diagnostic per-sub-span trace (verbosity-gated; see neml2.log)
+    if (console_debug)
+    {
+      std::ostringstream oss;
+      // Indent by bisection depth so the sub-span tree is visible at a glance.
+      oss << std::string(static_cast<std::size_t>(2 * (level + 1)), ' ') << "span [" << a << ", "
+          << b << "] L" << level << ": active=" << active.numel()
+          << " -> converged=" << active.numel() - fail.numel() << " failed=" << fail.numel();
+      nlog::emit(nlog::Channel::Substep, nlog::Level::Debug, oss.str());
+    }
+    // LCOV_EXCL_STOP
     if (fail.numel() > 0)
     {
-      // Maxing out substepping is a RECOVERABLE convergence failure -- a
-      // time-stepping consumer (e.g. MOOSE) cuts the outer step and retries -- so
-      // it must throw the recoverable ConvergenceError, NOT `_assert` (which
-      // throws the non-recoverable FatalError, defeating a `recoverable()` retry
-      // and making a maxed-out substep unrecoverable downstream).
       if (level >= seg.max_substepping_level)
-      {
-        const std::string msg = "aoti::Model substepping: " + std::to_string(fail.numel()) +
-                                " element(s) failed to converge at max_substepping_level=" +
-                                std::to_string(seg.max_substepping_level) +
-                                ". Reduce the outer time step.";
-        // Attach the level-0 (single-shot) failure context when capture is on,
-        // reshaped back to the original dynamic batch.
-        if (capture)
-        {
-          std::map<std::string, at::Tensor> stuck;
-          for (const auto & u : seg.unknowns)
-            stuck[u.name] = reshape_needed
-                                ? unflatten_dyn(cap_unknowns.at(u.name), dyn, var_trail(u))
-                                : cap_unknowns.at(u.name);
-          throw ConvergenceError(
-              msg, reshape_needed ? cap_mask.reshape(dyn) : cap_mask, std::move(stuck));
-        }
-        throw ConvergenceError(msg);
-      }
+        give_up(fail.numel());
       auto fail_g = active.index_select(0, fail);
       const double mid = 0.5 * (a + b);
-      solve_to(a, mid, fail_g, level + 1);
-      solve_to(mid, b, fail_g, level + 1);
+      const auto descend = [&, a, b, mid, level](const at::Tensor & rows)
+      {
+        solve_to(a, mid, rows, level + 1);
+        solve_to(mid, b, rows, level + 1);
+      };
+      // The failing rows' sub-steps are independent of each other, so a large
+      // enough subset runs as concurrent sub-batches.
+      if (const auto parts = splitting ? 1 : _substep_parts(fail_g); parts > 1)
+      {
+        splitting = true;
+        _run_substep_parts(fail_g, parts, mtx, descend);
+        splitting = false;
+      }
+      else
+        descend(fail_g);
     }
   };
 
-  solve_to(0.0, 1.0, at::arange(B, idx_opts), 0);
+  if (adaptive_substeps(_solver_config) || hint.defined())
+  {
+    // As in the value driver: one masked solve per round, every row on its own
+    // step. The tangent carrier takes the same per-row spans.
+    SubstepSchedule sched(
+        B, seg.max_substepping_level, _solver_config.substep_grow_after, idx_opts, hint);
+    at::Tensor a, b;
+    for (int64_t round = 0;; ++round)
+    {
+      const auto active = sched.next(a, b, opts);
+      if (active.numel() == 0)
+        break;
+      auto orig_a = index_select_batch(orig, active);
+      auto chained_a = index_select_batch(chained, active);
+      auto orig_da = index_select_batch(orig_d, active);
+      auto chained_da = index_select_batch(chained_d, active);
+      std::map<std::string, at::Tensor> span, span_d;
+      _apply_substep_span(seg, orig_a, a, b, chained_a, span);
+      _apply_substep_span(seg, orig_da, a, b, chained_da, span_d);
+      auto fail = solve_span(span, span_d, active, round == 0);
+      // LCOV_EXCL_START -- diagnostic per-round trace (verbosity-gated; see neml2.log)
+      if (console_debug)
+      {
+        std::ostringstream oss;
+        oss << "  round " << round << ": active=" << active.numel()
+            << " -> converged=" << active.numel() - fail.numel() << " failed=" << fail.numel();
+        nlog::emit(nlog::Channel::Substep, nlog::Level::Debug, oss.str());
+      }
+      // LCOV_EXCL_STOP
+      if (fail.numel() > 0)
+        if (const auto n_stuck = sched.at_cap(active, fail); n_stuck > 0)
+          give_up(n_stuck);
+      sched.update(active, fail);
+    }
+    max_depth = sched.depth();
+    row_depth = sched.row_depth();
+  }
+  else
+    solve_to(0.0, 1.0, at::arange(B, idx_opts), 0);
+  end_row_stats(seg_stats, prior_rows, dyn, max_depth, row_depth);
   // LCOV_EXCL_START -- diagnostic per-solve substep summary
   if (console_info)
   {
@@ -0,0 +1,281 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <set>
+
+#include "neml2/csrc/aoti/assertions.h"
+#include "neml2/csrc/dispatchers/AdaptiveHybridScheduler.h"
+
+namespace neml2::aoti
+{
+namespace
+{
+// Expand a per-device config vector: length 1 broadcasts to n; length n passes
+// through; anything else is an error.
+template <typename T>
+std::vector<T>
+broadcast(const std::vector<T> & v, std::size_t n, const char * what)
+{
+  _assert(v.size() == 1 || v.size() == n,
+          "AdaptiveHybridScheduler: `",
+          what,
+          "` must have length 1 (broadcast) or match `devices` (",
+          n,
+          "); got ",
+          v.size(),
+          ".");
+  if (v.size() == n)
+    return v;
+  return std::vector<T>(n, v.front());
+}
+} // namespace
+
+AdaptiveHybridScheduler::AdaptiveHybridScheduler(const Config & config)
+  : _min_batch_size(config.min_batch_size),
+    _smoothing(config.smoothing)
+{
+  const auto n = config.devices.size();
+  _assert(n > 0, "AdaptiveHybridScheduler: `devices` must be non-empty.");
+  _assert(!config.batch_sizes.empty(), "AdaptiveHybridScheduler: `batch_sizes` must be non-empty.");
+  _assert(_min_batch_size > 0, "AdaptiveHybridScheduler: `min_batch_size` must be positive.");
+  _assert(_smoothing > 0.0 && _smoothing <= 1.0,
+          "AdaptiveHybridScheduler: `smoothing` must be in (0, 1]; got ",
+          _smoothing,
+          ".");
+
+  const auto batch_sizes = broadcast(config.batch_sizes, n, "batch_sizes");
+  const auto capacities =
+      config.capacities.empty() ? batch_sizes : broadcast(config.capacities, n, "capacities");
+
+  std::set<std::string> seen;
+  std::size_t cpu_count = 0;
+  _status.reserve(n);
+  _devices.reserve(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    _assert(seen.insert(config.devices[i]).second,
+            "AdaptiveHybridScheduler: duplicate device '",
+            config.devices[i],
+            "'. Each device may appear at most once.");
+    // As in StaticHybridScheduler: two CPU workers would oversubscribe the
+    // intra-op thread pool each CPU graph already saturates.
+    if (parse_device(config.devices[i]).is_cpu())
+      _assert(++cpu_count == 1,
+              "AdaptiveHybridScheduler: more than one CPU device requested. A hybrid pool "
+              "may include at most one CPU (concurrent CPU graphs only oversubscribe the "
+              "intra-op thread pool); use one CPU plus distinct GPUs.");
+    _assert(batch_sizes[i] > 0,
+            "AdaptiveHybridScheduler: device '",
+            config.devices[i],
+            "' has batch_size 0; hybrid chunks must be positive.");
+    _assert(capacities[i] >= batch_sizes[i],
+            "AdaptiveHybridScheduler: device '",
+            config.devices[i],
+            "' capacity (",
+            capacities[i],
+            ") is smaller than its batch_size (",
+            batch_sizes[i],
+            "); a chunk could never be placed.");
+    const auto dev = parse_device(config.devices[i]);
+    _status.push_back({dev, batch_sizes[i], capacities[i], /*load=*/0, /*throughput=*/0.0, {}, {}});
+    _devices.push_back(dev);
+  }
+}
+
+std::vector<double>
+AdaptiveHybridScheduler::throughputs() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  std::vector<double> r;
+  r.reserve(_status.size());
+  for (const auto & s : _status)
+    r.push_back(s.throughput);
+  return r;
+}
+
+void
+AdaptiveHybridScheduler::begin_batch_impl(std::size_t n)
+{
+  _remaining = n;
+}
+
+bool
+AdaptiveHybridScheduler::schedule_work_impl(at::Device & dev, std::size_t & n) const
+{
+  const auto now = Clock::now();
+  const auto m = _status.size();
+
+  // Throughput estimates. A device not measured yet borrows the mean of the
+  // measured ones (all equal when none is), bounded by what its running probe
+  // chunk shows: a chunk of c items still running after e seconds means less
+  // than c / e items per second.
+  double measured = 0.0;
+  std::size_t n_measured = 0;
+  for (const auto & s : _status)
+    if (s.throughput > 0.0)
+    {
+      measured += s.throughput;
+      ++n_measured;
+    }
+  const double prior = n_measured > 0 ? measured / static_cast<double>(n_measured) : 1.0;
+  std::vector<double> rate(m);
+  for (std::size_t i = 0; i < m; ++i)
+  {
+    const auto & s = _status[i];
+    rate[i] = s.throughput > 0.0 ? s.throughput : prior;
+    if (s.throughput == 0.0 && !s.chunks.empty())
+    {
+      const auto & c = s.chunks.front();
+      const std::chrono::duration<double> e = now - std::max(c.dispatched, s.last_done);
+      if (e.count() > 0.0)
+        rate[i] = std::min(rate[i], static_cast<double>(c.n) / e.count());
+    }
+  }
+
+  // Each device's share of the work left so that all are estimated to finish
+  // together at T (seconds from now): share = rate * T - load, for the devices
+  // whose backlog (load / rate) ends before T, and the shares sum to the work
+  // left. Filled in backlog order.
+  std::vector<double> share(m, std::numeric_limits<double>::infinity());
+  if (_remaining > 0)
+  {
+    std::vector<std::size_t> order(m);
+    std::iota(order.begin(), order.end(), 0);
+    const auto backlog = [&](std::size_t i)
+    { return static_cast<double>(_status[i].load) / rate[i]; };
+    std::sort(order.begin(),
+              order.end(),
+              [&](std::size_t a, std::size_t b) { return backlog(a) < backlog(b); });
+    double load = 0.0, total_rate = 0.0, T = 0.0;
+    for (std::size_t j = 0; j < m; ++j)
+    {
+      load += static_cast<double>(_status[order[j]].load);
+      total_rate += rate[order[j]];
+      T = (static_cast<double>(_remaining) + load) / total_rate;
+      if (j + 1 == m || T <= backlog(order[j + 1]))
+        break;
+    }
+    for (std::size_t i = 0; i < m; ++i)
+      share[i] = std::max(0.0, rate[i] * T - static_cast<double>(_status[i].load));
+  }
+
+  // Among the devices that can take their next chunk now, pick the one that
+  // goes idle first (fastest on ties).
+  const DeviceStatus * best = nullptr;
+  std::size_t best_n = 0;
+  double best_idle = 0.0, best_rate = 0.0;
+  for (std::size_t i = 0; i < m; ++i)
+  {
+    const auto & s = _status[i];
+    if (s.throughput == 0.0 && !s.chunks.empty())
+      continue; // one probe chunk at a time until measured
+    auto want = s.batch_size;
+    if (_remaining > 0)
+    {
+      // The tolerance keeps round-off from handing a device one stray item.
+      const double w = std::ceil(share[i] - 1e-6);
+      if (w <= 0.0)
+        continue;
+      want = std::min(want, std::max(static_cast<std::size_t>(w), _min_batch_size));
+    }
+    const auto take = std::min(want, s.capacity - s.load);
+    if (take == 0 || (take < want && take < _min_batch_size))
+      continue;
+    const double idle = static_cast<double>(s.load) / rate[i];
+    if (best == nullptr || idle < best_idle || (idle == best_idle && rate[i] > best_rate))
+    {
+      best = &s;
+      best_n = take;
+      best_idle = idle;
+      best_rate = rate[i];
+    }
+  }
+
+  if (best == nullptr)
+    return false;
+  dev = best->device;
+  n = best_n;
+  return true;
+}
+
+AdaptiveHybridScheduler::DeviceStatus &
+AdaptiveHybridScheduler::status(at::Device dev, const char * what)
+{
+  for (auto & s : _status)
+    if (s.device == dev)
+      return s;
+  _throw("AdaptiveHybridScheduler: ", what, " for unknown device '", dev.str(), "'.");
+}
+
+void
+AdaptiveHybridScheduler::dispatched_work_impl(at::Device dev, std::size_t n)
+{
+  auto & s = status(dev, "dispatched_work");
+  s.load += n;
+  s.chunks.push_back({n, Clock::now()});
+  _remaining -= std::min(n, _remaining);
+}
+
+void
+AdaptiveHybridScheduler::completed_work_impl(at::Device dev, std::size_t n)
+{
+  const auto now = Clock::now();
+  auto & s = status(dev, "completed_work");
+  _assert(s.load >= n,
+          "AdaptiveHybridScheduler: completed_work (",
+          n,
+          ") exceeds the outstanding load (",
+          s.load,
+          ") on device '",
+          dev.str(),
+          "'.");
+  s.load -= n;
+  if (s.chunks.empty())
+    return;
+  // A device runs its chunks in dispatch order, so the oldest one finished; it
+  // started when it was dispatched or when the previous one finished.
+  const auto c = s.chunks.front();
+  s.chunks.pop_front();
+  const std::chrono::duration<double> dt = now - std::max(c.dispatched, s.last_done);
+  s.last_done = now;
+  if (dt.count() <= 0.0)
+    return;
+  const double sample = static_cast<double>(c.n) / dt.count();
+  s.throughput =
+      s.throughput == 0.0 ? sample : _smoothing * sample + (1.0 - _smoothing) * s.throughput;
+}
+
+bool
+AdaptiveHybridScheduler::all_work_completed() const
+{
+  for (const auto & s : _status)
+    if (s.load != 0)
+      return false;
+  return true;
+}
+} // namespace neml2::aoti
@@ -0,0 +1,129 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <c10/core/Device.h>
+
+#include "neml2/csrc/aoti/aoti_export.h"
+#include "neml2/csrc/dispatchers/AsyncScheduler.h"
+
+namespace neml2::aoti
+{
+/**
+ * @brief Spread one batch across several devices, sized by measured throughput.
+ *
+ * Same pool and protocol as @ref StaticHybridScheduler, but no priorities: each
+ * device's throughput (items per second) is measured from the
+ * `dispatched_work` / `completed_work` timestamps of its chunks and kept as an
+ * exponential moving average, across calls. Each `schedule_work` then splits
+ * the work left in the call (`begin_batch`) so that every device is estimated
+ * to finish at the same time -- a device's share is its throughput times the
+ * common finish time, less the items it already holds -- and hands the next
+ * chunk to the device that will go idle first. `batch_sizes` only caps the
+ * chunk size, so chunks shrink towards the end of a call instead of leaving a
+ * slow device holding a full chunk after the fast ones are done.
+ *
+ * A device without a measurement yet is given one chunk at a time; while that
+ * chunk runs its throughput is taken as at most `chunk / elapsed`, so a slow
+ * device is not handed the share of a fast one. The same one-CPU rule as
+ * @ref StaticHybridScheduler applies.
+ */
+class AOTI_EXPORT AdaptiveHybridScheduler : public AsyncScheduler
+{
+public:
+  struct Config
+  {
+    /// Devices to dispatch to, e.g. {"cpu", "cuda:0"}. Must be distinct.
+    std::vector<std::string> devices;
+    /// Per-device largest chunk (must be > 0). Length 1 broadcasts to all
+    /// devices; otherwise it must match `devices`.
+    std::vector<std::size_t> batch_sizes;
+    /// Per-device max in-flight items. Empty defaults each to its `batch_size`;
+    /// length 1 broadcasts; otherwise must match `devices`. Each capacity must
+    /// be >= the device's batch_size.
+    std::vector<std::size_t> capacities;
+    /// Smallest chunk handed out while more work is left, to bound the
+    /// per-chunk overhead at the end of a call. Must be > 0.
+    std::size_t min_batch_size = 1;
+    /// Weight of the newest sample in each device's throughput average, in
+    /// (0, 1]. 1 keeps only the last chunk.
+    double smoothing = 0.5;
+  };
+
+  explicit AdaptiveHybridScheduler(const Config & config);
+
+  std::vector<at::Device> devices() const override { return _devices; }
+
+  /// The measured throughput of each device (items per second), in `devices()`
+  /// order; 0 for a device that has not completed a chunk yet.
+  std::vector<double> throughputs() const;
+
+protected:
+  void begin_batch_impl(std::size_t n) override;
+  bool schedule_work_impl(at::Device & dev, std::size_t & n) const override;
+  void dispatched_work_impl(at::Device dev, std::size_t n) override;
+  void completed_work_impl(at::Device dev, std::size_t n) override;
+  bool all_work_completed() const override;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Chunk
+  {
+    std::size_t n;
+    Clock::time_point dispatched;
+  };
+
+  struct DeviceStatus
+  {
+    at::Device device;
+    std::size_t batch_size;
+    std::size_t capacity;
+    std::size_t load = 0;
+    /// Smoothed items per second; 0 until the first chunk completes.
+    double throughput = 0.0;
+    /// In-flight chunks in dispatch order (each device runs them in order).
+    std::deque<Chunk> chunks;
+    /// When the device's last chunk completed.
+    Clock::time_point last_done;
+  };
+
+  DeviceStatus & status(at::Device dev, const char * what);
+
+  std::vector<DeviceStatus> _status;
+  std::vector<at::Device> _devices; // cached for devices()
+  std::size_t _min_batch_size;
+  double _smoothing;
+  /// Items of the current call not dispatched yet; 0 when no call announced
+  /// its size, in which case every chunk is a full `batch_size`.
+  std::size_t _remaining = 0;
+};
+} // namespace neml2::aoti
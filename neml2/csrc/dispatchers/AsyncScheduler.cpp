@@ -26,6 +26,13 @@
 
 namespace neml2::aoti
 {
+void
+AsyncScheduler::begin_batch(std::size_t n)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  begin_batch_impl(n);
+}
+
 void
 AsyncScheduler::schedule_work(at::Device & dev, std::size_t & n)
 {
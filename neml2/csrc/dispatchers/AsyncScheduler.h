@@ -39,12 +39,13 @@ namespace neml2::aoti
  * @brief Base for asynchronous, multi-device schedulers.
  *
  * Provides the blocking load-tracking coordination shared by every async
- * policy: a mutex + condition variable, and the four-call protocol the
- * @ref DispatchedModel async pool drives against --
- * `schedule_work` / `dispatched_work` / `completed_work` / `wait_for_completion`.
- * Subclasses supply only the device-assignment *policy* through the `*_impl`
- * hooks (all invoked while `_mutex` is held). `StaticHybridScheduler` is the
- * concrete policy.
+ * policy: a mutex + condition variable, and the protocol the
+ * @ref DispatchedModel async pool drives against -- `begin_batch` once per
+ * call, then `schedule_work` / `dispatched_work` / `completed_work` per chunk,
+ * then `wait_for_completion`. Subclasses supply only the device-assignment
+ * *policy* through the `*_impl` hooks (all invoked while `_mutex` is held).
+ * `StaticHybridScheduler` and `AdaptiveHybridScheduler` are the concrete
+ * policies.
  *
  * @ref DispatchedModel picks the async pool over the synchronous loop by
  * `dynamic_cast`-ing its scheduler to `AsyncScheduler`.
@@ -52,6 +53,11 @@ namespace neml2::aoti
 class AOTI_EXPORT AsyncScheduler : public WorkScheduler
 {
 public:
+  /// Announce that @p n items are about to be dispatched, before the first
+  /// `schedule_work` of a call. A policy that sizes chunks by the work left
+  /// uses it; the default ignores it.
+  void begin_batch(std::size_t n);
+
   /// Block until some device has spare capacity, then set @p dev / @p n to the
   /// next chunk's target device and the chunk size that device will accept. The
   /// caller clamps @p n to the work it has left.
@@ -68,6 +74,8 @@ public:
   void wait_for_completion();
 
 protected:
+  /// Note the size of the batch `begin_batch` announced. Called under `_mutex`.
+  virtual void begin_batch_impl(std::size_t /*n*/) {}
   /// Pick the next (dev, n) if a device has spare capacity now; return false to
   /// keep waiting. Called under `_mutex`.
   virtual bool schedule_work_impl(at::Device & dev, std::size_t & n) const = 0;
@@ -0,0 +1,296 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <system_error>
+#include <thread>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include <ATen/Parallel.h>
+
+#include "neml2/csrc/aoti/assertions.h"
+#include "neml2/csrc/dispatchers/AutotuneScheduler.h"
+
+namespace neml2::aoti
+{
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// 64-bit FNV-1a in hex: a stable digest for the cache (std::hash is not
+// guaranteed to agree across builds).
+std::string
+fnv1a(const std::string & s)
+{
+  std::uint64_t h = 14695981039346656037ull;
+  for (const unsigned char c : s)
+  {
+    h ^= c;
+    h *= 1099511628211ull;
+  }
+  char hex[17];
+  std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(h));
+  return hex;
+}
+
+std::string
+env(const char * name)
+{
+  const char * v = std::getenv(name);
+  return v != nullptr ? v : "";
+}
+
+std::filesystem::path
+default_cache_dir()
+{
+  if (const auto d = env("NEML2_AUTOTUNE_CACHE"); !d.empty())
+    return d;
+#ifdef _WIN32
+  if (const auto d = env("LOCALAPPDATA"); !d.empty())
+    return std::filesystem::path(d) / "neml2" / "autotune";
+#else
+  if (const auto d = env("XDG_CACHE_HOME"); !d.empty())
+    return std::filesystem::path(d) / "neml2" / "autotune";
+  if (const auto d = env("HOME"); !d.empty())
+    return std::filesystem::path(d) / ".cache" / "neml2" / "autotune";
+#endif
+  return {};
+}
+
+// What a cache entry must match: the artifact digest, the operation and the
+// host fingerprint, one per line.
+std::string
+entry_key(const std::string & artifact_key, const std::string & op, const std::string & host)
+{
+  return fnv1a(artifact_key) + '\n' + op + '\n' + host;
+}
+
+std::string
+hostname()
+{
+#ifdef _WIN32
+  return env("COMPUTERNAME");
+#else
+  char buf[256] = {};
+  if (gethostname(buf, sizeof(buf) - 1) != 0)
+    return "";
+  return buf;
+#endif
+}
+} // namespace
+
+AutotuneScheduler::AutotuneScheduler(const Config & config)
+  // at::Device(std::string) parses "cpu" / "cuda" / "cuda:N" and throws a
+  // c10::Error on an unrecognised string.
+  : _device(config.device),
+    _config(config)
+{
+  _assert(config.min_batch_size > 0, "AutotuneScheduler: `min_batch_size` must be positive.");
+  _assert(config.max_batch_size >= config.min_batch_size,
+          "AutotuneScheduler: `max_batch_size` (",
+          config.max_batch_size,
+          ") is smaller than `min_batch_size` (",
+          config.min_batch_size,
+          ").");
+  _assert(config.growth >= 2, "AutotuneScheduler: `growth` must be at least 2.");
+  _assert(config.repeats > 0, "AutotuneScheduler: `repeats` must be positive.");
+  _assert(config.max_seconds > 0.0, "AutotuneScheduler: `max_seconds` must be positive.");
+}
+
+std::string
+AutotuneScheduler::host_fingerprint() const
+{
+  std::ostringstream os;
+  os << hostname() << '|' << std::thread::hardware_concurrency() << '|'
+     << at::get_num_threads() << '|' << _device.str();
+  return os.str();
+}
+
+std::filesystem::path
+AutotuneScheduler::cache_file(const std::string & artifact_key, const std::string & op) const
+{
+  if (!_config.use_cache || artifact_key.empty())
+    return {};
+  const auto dir = _config.cache_dir.empty() ? default_cache_dir()
+                                             : std::filesystem::path(_config.cache_dir);
+  if (dir.empty())
+    return {};
+  return dir / (fnv1a(entry_key(artifact_key, op, host_fingerprint())) + ".txt");
+}
+
+std::size_t
+AutotuneScheduler::batch_size(const std::string & op) const
+{
+  const std::lock_guard<std::mutex> lock(_mutex);
+  const auto it = _batch_sizes.find(op);
+  return it != _batch_sizes.end() ? it->second : 0;
+}
+
+bool
+AutotuneScheduler::calibrated(const std::string & op) const
+{
+  const std::lock_guard<std::mutex> lock(_mutex);
+  return _batch_sizes.count(op) > 0;
+}
+
+std::size_t
+AutotuneScheduler::read_cache(const std::string & artifact_key, const std::string & op)
+{
+  // A cache entry holds the artifact digest, the operation and the host
+  // fingerprint next to the size, so that a file-name collision reads as a miss.
+  const auto file = cache_file(artifact_key, op);
+  if (file.empty())
+    return 0;
+  std::ifstream in(file);
+  std::string artifact, entry_op, host;
+  std::size_t n = 0;
+  if (std::getline(in, artifact) && std::getline(in, entry_op) && std::getline(in, host) &&
+      (in >> n) && n > 0 &&
+      artifact + '\n' + entry_op + '\n' + host == entry_key(artifact_key, op, host_fingerprint()))
+  {
+    _sweeps.erase(op);
+    _batch_sizes[op] = n;
+    return n;
+  }
+  return 0;
+}
+
+std::size_t
+AutotuneScheduler::load_cached(const std::string & artifact_key, const std::string & op)
+{
+  const std::lock_guard<std::mutex> lock(_mutex);
+  if (const auto it = _batch_sizes.find(op); it != _batch_sizes.end())
+    return it->second;
+  if (!_looked_up.insert(op).second)
+    return 0;
+  return read_cache(artifact_key, op);
+}
+
+std::size_t
+AutotuneScheduler::calibrate(const TimeFn & time_call,
+                             const std::string & artifact_key,
+                             bool force,
+                             const std::string & op)
+{
+  const std::lock_guard<std::mutex> lock(_mutex);
+  if (!force)
+  {
+    if (const auto it = _batch_sizes.find(op); it != _batch_sizes.end())
+      return it->second;
+    if (const auto n = read_cache(artifact_key, op); n > 0)
+      return n;
+  }
+
+  const auto n = run_sweep(time_call, op);
+  _batch_sizes[op] = n;
+
+  if (const auto file = cache_file(artifact_key, op); !file.empty())
+  {
+    // Write then rename, so a concurrent reader never sees a partial entry.
+    std::error_code ec;
+    std::filesystem::create_directories(file.parent_path(), ec);
+    const auto stamp = static_cast<std::size_t>(Clock::now().time_since_epoch().count()) ^
+                       std::hash<std::thread::id>{}(std::this_thread::get_id());
+    auto tmp = file;
+    tmp += ".tmp" + std::to_string(stamp);
+    {
+      std::ofstream out(tmp);
+      out << entry_key(artifact_key, op, host_fingerprint()) << '\n' << n << '\n';
+    }
+    std::filesystem::rename(tmp, file, ec);
+    if (ec)
+      std::filesystem::remove(tmp, ec);
+  }
+  return n;
+}
+
+std::size_t
+AutotuneScheduler::run_sweep(const TimeFn & time_call, const std::string & op)
+{
+  auto & sweep = _sweeps[op];
+  sweep.clear();
+  std::size_t best = 0, stale = 0;
+  double best_rate = 0.0;
+  for (auto n = _config.min_batch_size; n <= _config.max_batch_size; n *= _config.growth)
+  {
+    // One untimed warm-up per size: the first call at a new shape can pay for
+    // allocations the later ones reuse.
+    if (time_call(n) < 0.0)
+      break;
+    double t = std::numeric_limits<double>::infinity();
+    for (std::size_t r = 0; r < _config.repeats; ++r)
+    {
+      const auto tr = time_call(n);
+      if (tr < 0.0)
+      {
+        t = tr;
+        break;
+      }
+      t = std::min(t, tr);
+    }
+    if (t < 0.0)
+      break;
+    const double rate =
+        static_cast<double>(n) / std::max(t, std::numeric_limits<double>::min());
+    sweep.emplace_back(n, rate);
+    if (rate > best_rate)
+    {
+      best = n;
+      best_rate = rate;
+      stale = 0;
+    }
+    else if (++stale == 2)
+      break;
+    if (t > _config.max_seconds || n > _config.max_batch_size / _config.growth)
+      break;
+  }
+  _assert(best > 0,
+          "AutotuneScheduler: calibration of `",
+          op,
+          "` could not run a chunk of ",
+          _config.min_batch_size,
+          " rows on '",
+          _device.str(),
+          "'.");
+  return best;
+}
+
+std::vector<std::pair<std::size_t, double>>
+AutotuneScheduler::sweep(const std::string & op) const
+{
+  const std::lock_guard<std::mutex> lock(_mutex);
+  const auto it = _sweeps.find(op);
+  return it != _sweeps.end() ? it->second : std::vector<std::pair<std::size_t, double>>{};
+}
+} // namespace neml2::aoti
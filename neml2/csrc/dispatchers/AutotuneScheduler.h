@@ -0,0 +1,148 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "neml2/csrc/dispatchers/WorkScheduler.h"
+
+namespace neml2::aoti
+{
+/**
+ * @brief Dispatch to a single device, chunked at a measured batch size.
+ *
+ * A @ref SimpleScheduler whose `batch_size` is not configured but chosen on the
+ * machine it runs on. `calibrate` times one call at each size of a short
+ * geometric sweep (`min_batch_size`, `min_batch_size * growth`, ... up to
+ * `max_batch_size`) and keeps the size with the best throughput (rows per
+ * second). Each operation (`forward`, `jacobian`, `param_vjp`, ...) has its own
+ * size, since their cost and memory per row differ by a large factor.
+ * @ref DispatchedModel runs the sweep for an operation on its first call when
+ * that operation has no size yet, timing that operation on the call's inputs,
+ * or explicitly through `DispatchedModel::calibrate`.
+ *
+ * The choice is cached on disk, keyed by the artifact (a stamp of its files,
+ * supplied by the caller), the operation and a fingerprint of the host
+ * (hostname, hardware threads, intra-op threads, device), so the next process
+ * on the same machine skips the sweep. A missing or unwritable cache only costs
+ * the sweep.
+ */
+class AOTI_EXPORT AutotuneScheduler : public SyncScheduler
+{
+public:
+  struct Config
+  {
+    /// Torch device string, e.g. "cpu", "cuda", or "cuda:1".
+    std::string device = "cpu";
+    /// First (smallest) chunk size of the sweep. Must be > 0.
+    std::size_t min_batch_size = 64;
+    /// Largest chunk size the sweep may try.
+    std::size_t max_batch_size = std::size_t(1) << 20;
+    /// Ratio between consecutive sizes. Must be >= 2.
+    std::size_t growth = 2;
+    /// Timed calls per size, after one untimed warm-up; the fastest counts.
+    std::size_t repeats = 3;
+    /// The sweep stops after the first size whose call takes longer than this
+    /// (seconds), or once two larger sizes in a row fail to beat the best.
+    double max_seconds = 1.0;
+    /// Cache directory. Empty picks `$NEML2_AUTOTUNE_CACHE`, else
+    /// `$XDG_CACHE_HOME/neml2/autotune`, else `~/.cache/neml2/autotune`
+    /// (`%LOCALAPPDATA%\neml2\autotune` on Windows).
+    std::string cache_dir;
+    /// Read and write the cache. Off always sweeps.
+    bool use_cache = true;
+    /// Sweep on the first dispatched call of an operation with no size yet.
+    /// That call then also runs the sweep, up to (1 + `repeats`) calls per
+    /// size. Off, such an operation takes its cached size if there is one
+    /// and otherwise runs unchunked until it is calibrated explicitly.
+    bool calibrate_on_first_call = true;
+  };
+
+  /// Seconds one call on `n` rows takes; negative when `n` rows cannot run
+  /// (e.g. out of device memory), which ends the sweep.
+  using TimeFn = std::function<double(std::size_t n)>;
+
+  explicit AutotuneScheduler(const Config & config);
+
+  at::Device device() const override { return _device; }
+  /// The calibrated chunk size of `forward`; see `batch_size(op)`.
+  std::size_t batch_size() const override { return batch_size("forward"); }
+  /// The calibrated chunk size of operation `op`; 0 (the whole batch in one
+  /// call) until then.
+  std::size_t batch_size(const std::string & op) const;
+
+  /// Whether a batch size has been chosen for `op` (swept or read from the
+  /// cache).
+  bool calibrated(const std::string & op = "forward") const;
+
+  const Config & config() const { return _config; }
+
+  /// Choose the batch size of `op`: read it from the cache entry for
+  /// `artifact_key` and `op` on this host, or sweep with `time_call` and cache
+  /// the winner. An empty `artifact_key` neither reads nor writes the cache.
+  /// `force` sweeps even when calibrated or cached. Returns the chosen size;
+  /// throws if not even `min_batch_size` rows could run.
+  std::size_t calibrate(const TimeFn & time_call,
+                        const std::string & artifact_key = "",
+                        bool force = false,
+                        const std::string & op = "forward");
+
+  /// Take `op`'s size from the cache without sweeping. Only the first lookup
+  /// per operation reads the file. Returns the size, 0 on a miss.
+  std::size_t load_cached(const std::string & artifact_key, const std::string & op = "forward");
+
+  /// `(size, rows per second)` for every size the last sweep of `op` timed;
+  /// empty when the size came from the cache.
+  std::vector<std::pair<std::size_t, double>> sweep(const std::string & op = "forward") const;
+
+  /// The cache file for `artifact_key` and `op` on this host; empty when
+  /// caching is off or no cache directory can be found.
+  std::filesystem::path cache_file(const std::string & artifact_key,
+                                   const std::string & op = "forward") const;
+
+  /// What identifies this host's performance for the cache key.
+  std::string host_fingerprint() const;
+
+private:
+  std::size_t run_sweep(const TimeFn & time_call, const std::string & op);
+  /// The cached size of `op`, 0 on a miss. Caller holds `_mutex`.
+  std::size_t read_cache(const std::string & artifact_key, const std::string & op);
+
+  at::Device _device;
+  Config _config;
+  mutable std::mutex _mutex; // serializes calibrate; guards the maps below
+  std::map<std::string, std::size_t> _batch_sizes;
+  std::map<std::string, std::vector<std::pair<std::size_t, double>>> _sweeps;
+  std::set<std::string> _looked_up;
+};
+} // namespace neml2::aoti
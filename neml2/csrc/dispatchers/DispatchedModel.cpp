@@ -22,18 +22,24 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <algorithm>
+#include <chrono>
 #include <condition_variable>
 #include <exception>
 #include <filesystem>
+#include <fstream>
 #include <functional>
+#include <map>
 #include <mutex>
 #include <queue>
+#include <sstream>
 #include <thread>
 #include <utility>
 #include <vector>
 
 #include "neml2/csrc/aoti/Exception.h"
 #include "neml2/csrc/dispatchers/AsyncScheduler.h"
+#include "neml2/csrc/dispatchers/AutotuneScheduler.h"
 #include "neml2/csrc/dispatchers/DispatchedModel.h"
 #include "neml2/csrc/dispatchers/batch_chunk.h"
 
@@ -65,6 +71,8 @@ struct DispatchedModel::Impl
         _active = model.get();
       _models.emplace(dev.str(), std::move(model));
     }
+    if (_autotune != nullptr)
+      _artifact_key = artifact_stamp(artifact_root, devs.front(), dtype);
     start_pool_if_async();
   }
 
@@ -94,10 +102,12 @@ struct DispatchedModel::Impl
 
   // --- dispatch entry points (sync vs async chosen by scheduler type) --------
 
-  std::map<std::string, at::Tensor> forward(const std::map<std::string, at::Tensor> & inputs)
+  std::map<std::string, at::Tensor> forward(const std::map<std::string, at::Tensor> & inputs,
+                                            const std::vector<at::Tensor> & substep_hint)
   {
     _assert(!inputs.empty(), "DispatchedModel::forward: inputs are empty.");
     sync_params();
+    clear_stats();
     const auto in_device = inputs.begin()->second.device();
     const int64_t b = infer_batch_size(inputs);
 
@@ -107,15 +117,24 @@ struct DispatchedModel::Impl
     {
       auto in = to_device(slice_batch(inputs, s, cnt), d);
       auto ov = chunk_param_overrides(s, cnt, b, d);
-      return to_device(_models.at(d.str())->forward(in, ov), in_device);
+      auto hint = chunk_substep_hint(substep_hint, s, cnt, d);
+      const auto & m = _models.at(d.str());
+      auto out = to_device(m->forward(in, ov, {}, hint), in_device);
+      record_stats(*m, s, in_device);
+      return out;
     };
 
     if (_async != nullptr)
       return cat_batch(run_async<std::map<std::string, at::Tensor>>(b, chunk_fn));
 
-    const int64_t chunk = chunk_extent(b);
+    const int64_t chunk = chunk_extent("forward", b, forward_rows(inputs));
     if (chunk >= b && _active->device() == in_device)
-      return _active->forward(inputs); // fast path (full batched param used as-is)
+    {
+      // fast path (full batched param and hint used as-is)
+      auto out = _active->forward(inputs, {}, {}, substep_hint);
+      record_stats(*_active, 0, in_device);
+      return out;
+    }
 
     std::vector<std::map<std::string, at::Tensor>> results;
     for (int64_t s = 0; s < b; s += chunk)
@@ -125,10 +144,14 @@ struct DispatchedModel::Impl
 
   std::pair<std::map<std::string, at::Tensor>, std::map<std::string, at::Tensor>>
   jvp(const std::map<std::string, at::Tensor> & inputs,
-      const std::map<std::string, at::Tensor> & tangents)
+      const std::map<std::string, at::Tensor> & tangents,
+      bool multi)
   {
+    // `multi` routes to jvp_multi: the K axis sits after the batch, so the
+    // same dim-0 slicing and concatenation apply.
     _assert(!inputs.empty(), "DispatchedModel::jvp: inputs are empty.");
     sync_params();
+    clear_stats();
     const auto in_device = inputs.begin()->second.device();
     const int64_t b = infer_batch_size(inputs);
 
@@ -138,7 +161,9 @@ struct DispatchedModel::Impl
       auto in = to_device(slice_batch(inputs, s, cnt), d);
       auto tan = to_device(slice_batch(tangents, s, cnt), d);
       auto ov = chunk_param_overrides(s, cnt, b, d);
-      auto [out, jout] = _models.at(d.str())->jvp(in, tan, ov);
+      const auto & m = _models.at(d.str());
+      auto [out, jout] = multi ? m->jvp_multi(in, tan, ov) : m->jvp(in, tan, ov);
+      record_stats(*m, s, in_device);
       return {to_device(out, in_device), to_device(jout, in_device)};
     };
 
@@ -147,9 +172,24 @@ struct DispatchedModel::Impl
       chunks = run_async<Pair>(b, chunk_fn);
     else
     {
-      const int64_t chunk = chunk_extent(b);
+      const auto rows_fn = [&](const at::Tensor & rows)
+      {
+        const auto d = _active->device();
+        auto in = take_rows(inputs, rows, b, d);
+        auto tan = take_rows(tangents, rows, b, d);
+        auto ov = row_overrides(rows, b, d);
+        auto [out, jout] = multi ? _active->jvp_multi(in, tan, ov) : _active->jvp(in, tan, ov);
+        (void)to_device(out, in_device);
+        return any_of(to_device(jout, in_device));
+      };
+      const int64_t chunk = chunk_extent(multi ? "jvp_multi" : "jvp", b, rows_fn);
       if (chunk >= b && _active->device() == in_device)
-        return _active->jvp(inputs, tangents); // fast path
+      {
+        auto r = multi ? _active->jvp_multi(inputs, tangents)
+                       : _active->jvp(inputs, tangents); // fast path
+        record_stats(*_active, 0, in_device);
+        return r;
+      }
       for (int64_t s = 0; s < b; s += chunk)
         chunks.push_back(chunk_fn(_active->device(), s, std::min(chunk, b - s)));
     }
@@ -166,10 +206,14 @@ struct DispatchedModel::Impl
   }
 
   std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
-  jacobian(const std::map<std::string, at::Tensor> & inputs)
+  jacobian(const std::map<std::string, at::Tensor> & inputs,
+           const std::vector<std::string> & wrt_inputs,
+           const std::vector<std::string> & of_outputs,
+           const std::vector<at::Tensor> & substep_hint)
   {
     _assert(!inputs.empty(), "DispatchedModel::jacobian: inputs are empty.");
     sync_params();
+    clear_stats();
     const auto in_device = inputs.begin()->second.device();
     const int64_t b = infer_batch_size(inputs);
 
@@ -178,7 +222,10 @@ struct DispatchedModel::Impl
     {
       auto in = to_device(slice_batch(inputs, s, cnt), d);
       auto ov = chunk_param_overrides(s, cnt, b, d);
-      auto [out, j] = _models.at(d.str())->jacobian(in, ov);
+      auto hint = chunk_substep_hint(substep_hint, s, cnt, d);
+      const auto & m = _models.at(d.str());
+      auto [out, j] = m->jacobian(in, wrt_inputs, of_outputs, ov, {}, hint);
+      record_stats(*m, s, in_device);
       return {to_device(out, in_device), to_device_nested(j, in_device)};
     };
 
@@ -187,9 +234,25 @@ struct DispatchedModel::Impl
       chunks = run_async<Pair>(b, chunk_fn);
     else
     {
-      const int64_t chunk = chunk_extent(b);
+      const auto rows_fn = [&](const at::Tensor & rows)
+      {
+        const auto d = _active->device();
+        auto [out, j] = _active->jacobian(
+            take_rows(inputs, rows, b, d), wrt_inputs, of_outputs, row_overrides(rows, b, d));
+        const auto last = any_of(to_device(out, in_device));
+        for (const auto & [o, row] : to_device_nested(j, in_device))
+          if (const auto blk = any_of(row); blk.defined())
+            return blk;
+        return last;
+      };
+      const int64_t chunk = chunk_extent("jacobian", b, rows_fn);
       if (chunk >= b && _active->device() == in_device)
-        return _active->jacobian(inputs); // fast path
+      {
+        auto r = _active->jacobian(
+            inputs, wrt_inputs, of_outputs, {}, {}, substep_hint); // fast path
+        record_stats(*_active, 0, in_device);
+        return r;
+      }
       for (int64_t s = 0; s < b; s += chunk)
         chunks.push_back(chunk_fn(_active->device(), s, std::min(chunk, b - s)));
     }
@@ -226,6 +289,7 @@ struct DispatchedModel::Impl
   {
     _assert(!inputs.empty(), "DispatchedModel::param_jacobian: inputs are empty.");
     sync_params();
+    clear_stats();
     const auto in_device = inputs.begin()->second.device();
     const int64_t b = infer_batch_size(inputs);
 
@@ -234,7 +298,9 @@ struct DispatchedModel::Impl
     {
       auto in = to_device(slice_batch(inputs, s, cnt), d);
       auto ov = chunk_param_overrides(s, cnt, b, d);
-      auto [out, p] = _models.at(d.str())->param_jacobian(in, ov);
+      const auto & m = _models.at(d.str());
+      auto [out, p] = m->param_jacobian(in, ov);
+      record_stats(*m, s, in_device);
       return {to_device(out, in_device), to_device_nested(p, in_device)};
     };
 
@@ -243,9 +309,24 @@ struct DispatchedModel::Impl
       chunks = run_async<Pair>(b, chunk_fn);
     else
     {
-      const int64_t chunk = chunk_extent(b);
+      const auto rows_fn = [&](const at::Tensor & rows)
+      {
+        const auto d = _active->device();
+        auto [out, p] =
+            _active->param_jacobian(take_rows(inputs, rows, b, d), row_overrides(rows, b, d));
+        const auto last = any_of(to_device(out, in_device));
+        for (const auto & [o, row] : to_device_nested(p, in_device))
+          if (const auto blk = any_of(row); blk.defined())
+            return blk;
+        return last;
+      };
+      const int64_t chunk = chunk_extent("param_jacobian", b, rows_fn);
       if (chunk >= b && _active->device() == in_device)
-        return _active->param_jacobian(inputs); // fast path
+      {
+        auto r = _active->param_jacobian(inputs); // fast path
+        record_stats(*_active, 0, in_device);
+        return r;
+      }
       for (int64_t s = 0; s < b; s += chunk)
         chunks.push_back(chunk_fn(_active->device(), s, std::min(chunk, b - s)));
     }
@@ -285,6 +366,7 @@ struct DispatchedModel::Impl
   {
     _assert(!inputs.empty(), "DispatchedModel::param_vjp: inputs are empty.");
     sync_params();
+    clear_stats();
     const auto in_device = inputs.begin()->second.device();
     const int64_t b = infer_batch_size(inputs);
 
@@ -298,7 +380,10 @@ struct DispatchedModel::Impl
       auto in = to_device(slice_batch(inputs, s, cnt), d);
       auto cot = to_device(slice_batch(cotangents, s, cnt), d);
       auto ov = chunk_param_overrides(s, cnt, b, d);
-      return to_device(_models.at(d.str())->param_vjp(in, cot, ov), in_device);
+      const auto & m = _models.at(d.str());
+      auto grads = to_device(m->param_vjp(in, cot, ov), in_device);
+      record_stats(*m, s, in_device);
+      return grads;
     };
 
     std::vector<Ret> chunks;
@@ -306,9 +391,21 @@ struct DispatchedModel::Impl
       chunks = run_async<Ret>(b, chunk_fn);
     else
     {
-      const int64_t chunk = chunk_extent(b);
+      const auto rows_fn = [&](const at::Tensor & rows)
+      {
+        const auto d = _active->device();
+        return any_of(to_device(_active->param_vjp(take_rows(inputs, rows, b, d),
+                                                   take_rows(cotangents, rows, b, d),
+                                                   row_overrides(rows, b, d)),
+                                in_device));
+      };
+      const int64_t chunk = chunk_extent("param_vjp", b, rows_fn);
       if (chunk >= b && _active->device() == in_device)
-        return _active->param_vjp(inputs, cotangents); // fast path
+      {
+        auto grads = _active->param_vjp(inputs, cotangents); // fast path
+        record_stats(*_active, 0, in_device);
+        return grads;
+      }
       for (int64_t s = 0; s < b; s += chunk)
         chunks.push_back(chunk_fn(_active->device(), s, std::min(chunk, b - s)));
     }
@@ -356,6 +453,52 @@ struct DispatchedModel::Impl
       m->set_solver_config(config);
   }
 
+  /// Merge the last call's per-chunk statistics, in batch order: counts and
+  /// times are summed, depths maxed, per-row counts concatenated. Times are
+  /// summed across devices, so with concurrent chunks they exceed the wall time.
+  SolveStats last_solve_stats() const
+  {
+    const std::lock_guard<std::mutex> lock(_stats_mutex);
+    SolveStats merged;
+    std::vector<std::vector<at::Tensor>> rows, depths;
+    for (const auto & [s, st] : _chunk_stats)
+    {
+      if (merged.segments.empty())
+      {
+        merged.segments.resize(st.segments.size());
+        rows.resize(st.segments.size());
+        depths.resize(st.segments.size());
+      }
+      for (std::size_t k = 0; k < st.segments.size(); ++k)
+      {
+        auto & m = merged.segments[k];
+        const auto & c = st.segments[k];
+        m.unknowns = c.unknowns;
+        m.solves += c.solves;
+        m.iterations += c.iterations;
+        m.linesearch_trials += c.linesearch_trials;
+        m.matvecs += c.matvecs;
+        m.precond_rebuilds += c.precond_rebuilds;
+        m.substep_depth = std::max(m.substep_depth, c.substep_depth);
+        m.residual_seconds += c.residual_seconds;
+        m.step_seconds += c.step_seconds;
+        if (c.row_iterations.defined())
+          rows[k].push_back(c.row_iterations);
+        if (c.row_substep_depth.defined())
+          depths[k].push_back(c.row_substep_depth);
+      }
+    }
+    // Per-row counts are only meaningful when every chunk solved the segment.
+    for (std::size_t k = 0; k < rows.size(); ++k)
+    {
+      if (!rows[k].empty() && rows[k].size() == _chunk_stats.size())
+        merged.segments[k].row_iterations = at::cat(rows[k], /*dim=*/0);
+      if (!depths[k].empty() && depths[k].size() == _chunk_stats.size())
+        merged.segments[k].row_substep_depth = at::cat(depths[k], /*dim=*/0);
+    }
+    return merged;
+  }
+
   // Master promoted-parameter map (the primary device copy). Marking it dirty
   // on mutable access broadcasts it to the other device copies before the next
   // dispatch.
@@ -376,20 +519,169 @@ struct DispatchedModel::Impl
 
   Model * active() const { return _active; }
 
+  /// Run the `AutotuneScheduler` sweep for `forward` on rows of `inputs`
+  /// (repeated as needed to reach each size) on the scheduler's device.
+  std::size_t calibrate(const std::map<std::string, at::Tensor> & inputs, bool force)
+  {
+    _assert(_autotune != nullptr,
+            "DispatchedModel::calibrate: the scheduler is not an AutotuneScheduler.");
+    _assert(!inputs.empty(), "DispatchedModel::calibrate: inputs are empty.");
+    sync_params();
+    return calibrate_op("forward", infer_batch_size(inputs), forward_rows(inputs), force);
+  }
+
 private:
   void classify_scheduler()
   {
     _async = dynamic_cast<AsyncScheduler *>(_scheduler.get());
     _sync = dynamic_cast<SyncScheduler *>(_scheduler.get());
+    _autotune = dynamic_cast<AutotuneScheduler *>(_scheduler.get());
     _assert(_async != nullptr || _sync != nullptr,
             "DispatchedModel: scheduler is neither a SyncScheduler nor an AsyncScheduler.");
   }
 
-  /// Sync chunk extent along dim 0: the scheduler's batch size, clamped to the
-  /// whole batch (0 => no chunking).
-  int64_t chunk_extent(int64_t b) const
+  /// Forget the previous call's statistics (start of every dispatched op).
+  void clear_stats()
+  {
+    const std::lock_guard<std::mutex> lock(_stats_mutex);
+    _chunk_stats.clear();
+  }
+
+  /// File the statistics of the chunk starting at row `s`, just run on `m` by
+  /// the calling thread (`Model::last_solve_stats` is per thread), with its
+  /// per-row counts moved to the input device. No-op unless `collect_stats`.
+  void record_stats(const Model & m, int64_t s, at::Device in_device)
+  {
+    if (!m.solver_config().collect_stats)
+      return;
+    auto st = m.last_solve_stats();
+    for (auto & seg : st.segments)
+    {
+      if (seg.row_iterations.defined())
+        seg.row_iterations = seg.row_iterations.to(in_device);
+      if (seg.row_substep_depth.defined())
+        seg.row_substep_depth = seg.row_substep_depth.to(in_device);
+    }
+    const std::lock_guard<std::mutex> lock(_stats_mutex);
+    _chunk_stats[s] = std::move(st);
+  }
+
+  /// What identifies the artifact in the autotune cache: the shared
+  /// `metadata.json`, the dtype, and the name, size and modification time of
+  /// every binary under the primary device type's folder (the same cheap stamp
+  /// the segment loaders use instead of hashing the binaries).
+  static std::string
+  artifact_stamp(const std::filesystem::path & root, at::Device dev, at::ScalarType dtype)
+  {
+    std::ostringstream os;
+    os << dtype << '\n';
+    if (std::ifstream meta(root / "metadata.json"); meta)
+      os << meta.rdbuf() << '\n';
+    const auto leaf = root / c10::DeviceTypeName(dev.type(), /*lower_case=*/true);
+    std::vector<std::string> files;
+    std::error_code ec;
+    for (std::filesystem::recursive_directory_iterator it(leaf, ec), end; !ec && it != end;
+         it.increment(ec))
+    {
+      if (!it->is_regular_file(ec))
+        continue;
+      const auto size = std::filesystem::file_size(it->path(), ec);
+      const auto mtime = std::filesystem::last_write_time(it->path(), ec);
+      std::ostringstream f;
+      f << std::filesystem::relative(it->path(), leaf, ec).generic_string() << ' ' << size << ' '
+        << mtime.time_since_epoch().count();
+      files.push_back(f.str());
+    }
+    std::sort(files.begin(), files.end());
+    for (const auto & f : files)
+      os << f << '\n';
+    return os.str();
+  }
+
+  /// One call of a dispatched operation on `rows` (indices into its batch,
+  /// repeated as needed) of its inputs, with the results moved to the input
+  /// device. Returns one of the results, which the autotune sweep reads back
+  /// to wait for the device.
+  using RowCall = std::function<at::Tensor(const at::Tensor & rows)>;
+
+  /// `rows` of every tensor in `m` that is batched along dim 0 (extent `b`),
+  /// on `d`; unbatched tensors pass through.
+  static std::map<std::string, at::Tensor> take_rows(const std::map<std::string, at::Tensor> & m,
+                                                     const at::Tensor & rows,
+                                                     int64_t b,
+                                                     at::Device d)
+  {
+    std::map<std::string, at::Tensor> out;
+    for (const auto & [name, t] : m)
+      out.emplace(name,
+                  t.dim() >= 1 && t.size(0) == b ? t.index_select(0, rows.to(t.device())) : t);
+    return to_device(out, d);
+  }
+
+  /// `rows` of the batched parameters, as overrides on `d`.
+  std::map<std::string, at::Tensor> row_overrides(const at::Tensor & rows, int64_t b, at::Device d)
+  {
+    return take_rows(chunk_param_overrides(0, b, b, d), rows, b, d);
+  }
+
+  /// Some tensor of `m`; undefined when `m` is empty.
+  static at::Tensor any_of(const std::map<std::string, at::Tensor> & m)
   {
-    const auto n = _sync->batch_size();
+    return m.empty() ? at::Tensor() : m.begin()->second;
+  }
+
+  RowCall forward_rows(const std::map<std::string, at::Tensor> & inputs)
+  {
+    return [this, &inputs](const at::Tensor & rows)
+    {
+      const auto b = infer_batch_size(inputs);
+      const auto d = _active->device();
+      return any_of(to_device(
+          _active->forward(take_rows(inputs, rows, b, d), row_overrides(rows, b, d)),
+          inputs.begin()->second.device()));
+    };
+  }
+
+  /// Run the `AutotuneScheduler` sweep for operation `op` of a batch of `b`
+  /// rows, timing `call` on the active model.
+  std::size_t calibrate_op(const std::string & op, int64_t b, const RowCall & call, bool force)
+  {
+    const auto time_call = [&](std::size_t n) -> double
+    {
+      const auto rows = at::arange(static_cast<int64_t>(n), at::TensorOptions(at::kLong)) % b;
+      try
+      {
+        const auto t0 = std::chrono::steady_clock::now();
+        // The copy back to the input device is part of every chunk; reading one
+        // value waits for a device that is still running.
+        if (const auto last = call(rows); last.defined() && last.numel() > 0)
+          (void)last.reshape({-1})[0].item<double>();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+      }
+      catch (const c10::OutOfMemoryError &)
+      {
+        return -1.0;
+      }
+    };
+    const auto n = _autotune->calibrate(time_call, _artifact_key, force, op);
+    clear_stats(); // the sweep's calls are not a dispatched call
+    return n;
+  }
+
+  /// Sync chunk extent along dim 0 for operation `op`: the scheduler's batch
+  /// size, clamped to the whole batch (0 => no chunking). An `AutotuneScheduler`
+  /// with no size for `op` yet sweeps it with `call` first, or only reads its
+  /// cache when `calibrate_on_first_call` is off.
+  int64_t chunk_extent(const std::string & op, int64_t b, const RowCall & call)
+  {
+    if (_autotune != nullptr && !_autotune->calibrated(op))
+    {
+      if (_autotune->config().calibrate_on_first_call)
+        (void)calibrate_op(op, b, call, /*force=*/false);
+      else
+        (void)_autotune->load_cached(_artifact_key, op);
+    }
+    const auto n = _autotune != nullptr ? _autotune->batch_size(op) : _sync->batch_size();
     if (n == 0 || static_cast<int64_t>(n) >= b)
       return b;
     return static_cast<int64_t>(n);
@@ -462,6 +754,27 @@ private:
     return ov;
   }
 
+  /// The caller's `substep_hint` for the chunk `[s, s+cnt)`: each segment's
+  /// per-row levels narrowed to the chunk's rows and moved to device `d`, like
+  /// a batched parameter. Undefined entries stay undefined.
+  static std::vector<at::Tensor>
+  chunk_substep_hint(const std::vector<at::Tensor> & hint, int64_t s, int64_t cnt, at::Device d)
+  {
+    std::vector<at::Tensor> out;
+    out.reserve(hint.size());
+    for (const auto & h : hint)
+    {
+      if (!h.defined())
+      {
+        out.emplace_back();
+        continue;
+      }
+      auto sl = h.narrow(0, s, cnt);
+      out.push_back(sl.device() == d ? sl : sl.to(d));
+    }
+    return out;
+  }
+
   // --- async thread-per-device pool ------------------------------------------
 
   /// Dispatch the b-row batch across the async pool: pull (device, chunk) from
@@ -496,6 +809,7 @@ private:
 
     try
     {
+      _async->begin_batch(static_cast<std::size_t>(b));
       for (int64_t start = 0; start < b;)
       {
         // Once any chunk has failed, stop scheduling new work; the in-flight
@@ -663,8 +977,12 @@ private:
   }
 
   std::shared_ptr<WorkScheduler> _scheduler;
-  SyncScheduler * _sync = nullptr;   // non-null for the sync path
-  AsyncScheduler * _async = nullptr; // non-null for the async path
+  SyncScheduler * _sync = nullptr;         // non-null for the sync path
+  AsyncScheduler * _async = nullptr;       // non-null for the async path
+  AutotuneScheduler * _autotune = nullptr; // non-null when the sync path autotunes
+  // The autotune cache key of the artifact (`artifact_stamp`); empty when the
+  // model was handed over already loaded, which leaves the cache unused.
+  std::string _artifact_key;
 
   // device-string -> Model (one per scheduler device). `_active` is the primary
   // (first device): metadata source + master promoted-parameter copy.
@@ -672,6 +990,11 @@ private:
   Model * _active = nullptr;
   bool _params_dirty = false;
 
+  // Solve statistics of the last dispatched call, keyed by chunk start row.
+  // Filled by the workers (`record_stats`), merged on query.
+  mutable std::mutex _stats_mutex;
+  std::map<int64_t, SolveStats> _chunk_stats;
+
   // Async pool (unused / empty in the sync path).
   std::map<std::string, std::queue<std::function<void()>>> _tasks;
   std::mutex _qmutex;
@@ -706,22 +1029,40 @@ DispatchedModel & DispatchedModel::operator=(DispatchedModel &&) noexcept = defa
 // concurrent ones via AggregateError); this also covers main-thread work outside
 // the workers -- parameter sync, batch slicing, and the final concatenation.
 std::map<std::string, at::Tensor>
-DispatchedModel::forward(const std::map<std::string, at::Tensor> & inputs) const
+DispatchedModel::forward(const std::map<std::string, at::Tensor> & inputs,
+                         const std::vector<at::Tensor> & substep_hint) const
 {
-  return _guarded([&] { return _impl->forward(inputs); });
+  return _guarded([&] { return _impl->forward(inputs, substep_hint); });
 }
 
 std::pair<std::map<std::string, at::Tensor>, std::map<std::string, at::Tensor>>
 DispatchedModel::jvp(const std::map<std::string, at::Tensor> & inputs,
                      const std::map<std::string, at::Tensor> & tangents) const
 {
-  return _guarded([&] { return _impl->jvp(inputs, tangents); });
+  return _guarded([&] { return _impl->jvp(inputs, tangents, false); });
+}
+
+std::pair<std::map<std::string, at::Tensor>, std::map<std::string, at::Tensor>>
+DispatchedModel::jvp_multi(const std::map<std::string, at::Tensor> & inputs,
+                           const std::map<std::string, at::Tensor> & tangents) const
+{
+  return _guarded([&] { return _impl->jvp(inputs, tangents, true); });
+}
+
+std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
+DispatchedModel::jacobian(const std::map<std::string, at::Tensor> & inputs,
+                          const std::vector<at::Tensor> & substep_hint) const
+{
+  return _guarded([&] { return _impl->jacobian(inputs, {}, {}, substep_hint); });
 }
 
 std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
-DispatchedModel::jacobian(const std::map<std::string, at::Tensor> & inputs) const
+DispatchedModel::jacobian(const std::map<std::string, at::Tensor> & inputs,
+                          const std::vector<std::string> & wrt_inputs,
+                          const std::vector<std::string> & of_outputs,
+                          const std::vector<at::Tensor> & substep_hint) const
 {
-  return _guarded([&] { return _impl->jacobian(inputs); });
+  return _guarded([&] { return _impl->jacobian(inputs, wrt_inputs, of_outputs, substep_hint); });
 }
 
 std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
@@ -743,6 +1084,24 @@ DispatchedModel::set_solver_config(const SolverConfig & config)
   _impl->set_solver_config(config);
 }
 
+const SolverConfig &
+DispatchedModel::solver_config() const noexcept
+{
+  return _impl->active()->solver_config();
+}
+
+SolveStats
+DispatchedModel::last_solve_stats() const
+{
+  return _impl->last_solve_stats();
+}
+
+std::size_t
+DispatchedModel::calibrate(const std::map<std::string, at::Tensor> & inputs, bool force)
+{
+  return _guarded([&] { return _impl->calibrate(inputs, force); });
+}
+
 const std::vector<std::string> &
 DispatchedModel::input_names() const noexcept
 {
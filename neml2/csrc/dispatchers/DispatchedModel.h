@@ -57,10 +57,10 @@ namespace neml2::aoti
  *   chunk loop on the calling thread, one device. When that device equals the
  *   input device and the batch fits in one chunk, it short-circuits to a direct
  *   `Model` call (zero overhead).
- * - an @ref AsyncScheduler (`StaticHybridScheduler`) drives a thread-per-device
- *   pool: the calling thread asks the scheduler for the next `(device, chunk)`
- *   and enqueues it; one worker per device runs its `Model` concurrently;
- *   results are reassembled in dispatch order.
+ * - an @ref AsyncScheduler (`StaticHybridScheduler`, `AdaptiveHybridScheduler`)
+ *   drives a thread-per-device pool: the calling thread asks the scheduler for
+ *   the next `(device, chunk)` and enqueues it; one worker per device runs its
+ *   `Model` concurrently; results are reassembled in dispatch order.
  *
  * This is a *distinct, same-shaped* type, **not** a subclass of `Model` (whose
  * methods are non-virtual by design): substitute it for `Model` at the source
@@ -110,14 +110,32 @@ public:
 
   /// @name Model surface (chunked + dispatched). Mirrors Model exactly.
   ///@{
-  std::map<std::string, at::Tensor> forward(const std::map<std::string, at::Tensor> & inputs) const;
+  /// `substep_hint` is sliced per chunk like a batched parameter; see
+  /// `Model::forward`. The merged `last_solve_stats()` carries the next one.
+  std::map<std::string, at::Tensor>
+  forward(const std::map<std::string, at::Tensor> & inputs,
+          const std::vector<at::Tensor> & substep_hint = {}) const;
 
   std::pair<std::map<std::string, at::Tensor>, std::map<std::string, at::Tensor>>
   jvp(const std::map<std::string, at::Tensor> & inputs,
       const std::map<std::string, at::Tensor> & tangents) const;
 
+  /// K-direction JVP, chunked + dispatched; see `Model::jvp_multi`.
+  std::pair<std::map<std::string, at::Tensor>, std::map<std::string, at::Tensor>>
+  jvp_multi(const std::map<std::string, at::Tensor> & inputs,
+            const std::map<std::string, at::Tensor> & tangents) const;
+
+  std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
+  jacobian(const std::map<std::string, at::Tensor> & inputs,
+           const std::vector<at::Tensor> & substep_hint = {}) const;
+
+  /// Subset Jacobian, chunked + dispatched; see `Model::jacobian(inputs,
+  /// wrt_inputs, of_outputs)`.
   std::pair<std::map<std::string, at::Tensor>, VariablePairJacobian>
-  jacobian(const std::map<std::string, at::Tensor> & inputs) const;
+  jacobian(const std::map<std::string, at::Tensor> & inputs,
+           const std::vector<std::string> & wrt_inputs,
+           const std::vector<std::string> & of_outputs,
+           const std::vector<at::Tensor> & substep_hint = {}) const;
 
   /// Evaluate + dense parameter Jacobian, chunked + dispatched. Returns
   /// `{outputs, P}` with `P[out_name][param_qname]` at `(*B, *out_base,
@@ -136,6 +154,20 @@ public:
 
   /// Configure the implicit-segment Newton solve (forwarded to every Model).
   void set_solver_config(const SolverConfig & config);
+  /// The Newton configuration in effect (every device copy shares it).
+  const SolverConfig & solver_config() const noexcept;
+  /// Solve statistics of the last dispatched call, merged over its chunks in
+  /// batch order; see `Model::last_solve_stats`. Needs
+  /// `SolverConfig::collect_stats`.
+  SolveStats last_solve_stats() const;
+
+  /// Choose the `forward` chunk size of an `AutotuneScheduler` by sweeping
+  /// `forward` on rows of `inputs` (see `AutotuneScheduler::calibrate`). Each
+  /// other operation keeps its own size, which its first dispatched call sweeps
+  /// on its own inputs when none is calibrated or cached (unless
+  /// `calibrate_on_first_call` is off). `force` sweeps even then. Returns the
+  /// chosen size; throws for any other scheduler.
+  std::size_t calibrate(const std::map<std::string, at::Tensor> & inputs, bool force = false);
 
   /// @name Metadata + parameter surface.
   /// Metadata forwards to the primary device copy (all copies agree);
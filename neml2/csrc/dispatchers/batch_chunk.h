@@ -36,6 +36,7 @@
 // rank 0). Slicing acts on dim 0; broadcast/unbatched entries pass through.
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <string>
@@ -116,6 +117,37 @@ scatter_batch_(std::map<std::string, at::Tensor> & dst,
   }
 }
 
+/// Positional form of ``index_select_batch`` for a tensor list (per-group
+/// unknowns / residuals, a system's bound givens). Entries whose dim-0 extent is
+/// the full batch ``b`` are indexed; the rest (rank 0, or a broadcast dim 0) pass
+/// through whole. Inverse: the positional ``scatter_batch_``.
+inline std::vector<at::Tensor>
+index_select_batch(const std::vector<at::Tensor> & v, const at::Tensor & idx, int64_t b)
+{
+  std::vector<at::Tensor> out;
+  out.reserve(v.size());
+  for (const auto & t : v)
+    out.push_back(t.dim() >= 1 && t.size(0) == b ? t.index_select(0, idx).contiguous() : t);
+  return out;
+}
+
+/// Positional form of ``scatter_batch_``: write ``sub[k]`` into ``dst[k]`` at
+/// rows ``idx``, in place. Both lists must be the same length.
+inline void
+scatter_batch_(std::vector<at::Tensor> & dst,
+               const at::Tensor & idx,
+               const std::vector<at::Tensor> & sub)
+{
+  _assert(dst.size() == sub.size(),
+          "scatter_batch_: ",
+          sub.size(),
+          " tensors to scatter into ",
+          dst.size(),
+          ".");
+  for (std::size_t k = 0; k < dst.size(); ++k)
+    dst[k].index_copy_(0, idx, sub[k]);
+}
+
 /// Concatenate per-chunk value maps along dim 0, keyed by the first chunk's
 /// names. Every chunk must carry every key.
 inline std::map<std::string, at::Tensor>
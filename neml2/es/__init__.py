@@ -37,8 +37,9 @@ Layered:
   :class:`ModelNonlinearSystem`.
 - :mod:`.implicit` -- AOTI export wrappers for the implicit-segment Newton
   path: operator graphs (:class:`RHS`, :class:`Jacobian`, :class:`JacobianGiven`,
-  :class:`DrDParam`) + solve graphs (:class:`LinearSolve`, :class:`LinearSolveIFT`,
-  :class:`LinearSolveParam`); the linear solve is un-baked from the operators.
+  :class:`DrDParam`) + solve graphs (:class:`LinearSolve`, :class:`LinearFactor` /
+  :class:`LinearSolveFactored`, :class:`LinearSolveIFT`, :class:`LinearSolveParam`);
+  the linear solve is un-baked from the operators.
 """
 
 from .assembled import AssembledMatrix, AssembledVector, norm, norm_sq
@@ -48,7 +49,9 @@ from .implicit import (
     DrDParam,
     Jacobian,
     JacobianGiven,
+    LinearFactor,
     LinearSolve,
+    LinearSolveFactored,
     LinearSolveIFT,
     LinearSolveParam,
     Matvec,
@@ -69,6 +72,8 @@ __all__ = [
     "Jacobian",
     "Matvec",
     "LinearSolve",
+    "LinearFactor",
+    "LinearSolveFactored",
     "JacobianGiven",
     "LinearSolveIFT",
     "DrDParam",
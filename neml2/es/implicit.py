@@ -50,6 +50,11 @@ Solve graphs (consume operators; no assembly):
 
 - :class:`LinearSolve`     -- ``(*A_blocks, *b_groups) -> (*du_groups)`` (Newton
                               step ``du = A^{-1} b`` via the configured solver).
+- :class:`LinearFactor` / :class:`LinearSolveFactored` -- ``(A) -> (LU, pivots)``
+                              and ``(LU, pivots, b) -> (du,)``: a single-group
+                              ``DenseLU`` :class:`LinearSolve` split in two, so
+                              the runtime can keep the factors while it reuses
+                              the Jacobian (``jacobian_refresh``).
 - :class:`LinearSolveIFT`  -- ``(*A_blocks, *B_blocks) -> *blocks`` (IFT
                               ``du/dg = -A^{-1} B``, one block per ``(unknown,
                               given)`` pair via ``AssembledMatrix.disassemble``;
@@ -666,6 +671,29 @@ class LinearSolve(_SystemModule):
         return _vector_to_per_group_raws(du)
 
 
+class LinearFactor(nn.Module):
+    """``(A_block,) -> (LU, pivots)``: the factor half of a :class:`LinearSolve`
+    under ``DenseLU`` with a single residual and unknown group.
+
+    Takes the lone ``A`` block :class:`Jacobian` emits, ``(*B, *sub, n, n)``;
+    leading axes batch as independent LUs, exactly as ``DenseLU`` solves them.
+    """
+
+    def forward(self, A: torch.Tensor) -> tuple[torch.Tensor, torch.Tensor]:
+        LU, piv = torch.linalg.lu_factor(A)
+        return LU, piv
+
+
+class LinearSolveFactored(nn.Module):
+    """``(LU, pivots, b_group) -> (du_group,)``: the solve half paired with
+    :class:`LinearFactor`, two triangular solves against the kept factors."""
+
+    def forward(
+        self, LU: torch.Tensor, piv: torch.Tensor, b: torch.Tensor
+    ) -> tuple[torch.Tensor, ...]:
+        return (torch.linalg.lu_solve(LU, piv, b.unsqueeze(-1)).squeeze(-1),)
+
+
 class JacobianGiven(_SystemModule):
     """Exportable ``∂r/∂g`` operator graph -- the IFT's given-side Jacobian.
 
@@ -35,7 +35,8 @@ a baked direct solve.
 
 The preconditioner and cache-strategy are two orthogonal axes (which ``M^-1``
 approximates ``A^-1`` vs how often it is rebuilt across Newton iterations); both
-are strings validated here to mirror the C++ ``parse_*`` in ``krylov.h``.
+are strings validated here to mirror the C++ ``parse_*`` in ``krylov.h``. So is
+the forcing term, which sets how tightly each inner solve is converged.
 """
 
 from __future__ import annotations
@@ -46,6 +47,7 @@ if TYPE_CHECKING:
     from .preconditioners import Preconditioner
 
 _CACHE_STRATEGIES = ("none", "chord", "max_its")
+_FORCING_TERMS = ("fixed", "ew1", "ew2")
 
 
 def _validate_choice(value: str, allowed: tuple[str, ...], field: str) -> str:
@@ -82,6 +84,10 @@ class _KrylovSolver:
         preconditioner: Preconditioner | None = None,
         cache_strategy: str = "none",
         cache_max_its: int = 10,
+        forcing: str = "fixed",
+        forcing_max: float = 0.9,
+        recycle: int = 0,
+        compact_fraction: float = 0.0,
     ) -> None:
         from .preconditioners import NoPreconditioner  # noqa: PLC0415
 
@@ -94,6 +100,21 @@ class _KrylovSolver:
         self.preconditioner: Preconditioner = preconditioner or NoPreconditioner()
         self.cache_strategy = _validate_choice(cache_strategy, _CACHE_STRATEGIES, "cache_strategy")
         self.cache_max_its = int(cache_max_its)
+        #: Inner-tolerance policy across Newton iterations: ``fixed`` (always
+        #: ``rel_tol``) or an Eisenstat-Walker forcing term (``ew1`` / ``ew2``)
+        #: capped at ``forcing_max``, with ``rel_tol`` as the floor.
+        self.forcing = _validate_choice(forcing, _FORCING_TERMS, "forcing")
+        self.forcing_max = float(forcing_max)
+        #: GMRES recycle-space width: the number of directions carried from one
+        #: inner solve to the next to deflate it (0 = off; BiCGStab ignores it).
+        self.recycle = int(recycle)
+        if self.recycle < 0:
+            raise ValueError(f"recycle must be >= 0, got {self.recycle}")
+        #: In-loop compaction: once this share of the rows still iterating has
+        #: converged, the inner solve continues on the rest only (0 = off).
+        self.compact_fraction = float(compact_fraction)
+        if not 0.0 <= self.compact_fraction <= 1.0:
+            raise ValueError(f"compact_fraction must be in [0, 1], got {self.compact_fraction}")
 
     def krylov_config(self) -> dict:
         """Config forwarded to ``krylov_solve_eager`` (kwargs) and the C++
@@ -108,6 +129,10 @@ class _KrylovSolver:
             "rel_tol": self.rel_tol,
             "cache_strategy": self.cache_strategy,
             "cache_max_its": self.cache_max_its,
+            "forcing": self.forcing,
+            "forcing_max": self.forcing_max,
+            "recycle": self.recycle,
+            "compact_fraction": self.compact_fraction,
         }
 
     def linear_solve_config(self) -> dict:
@@ -94,6 +94,27 @@ class BiCGStab(_KrylovSolver):
             "Iteration bar that triggers a preconditioner rebuild under the max_its cache strategy",
             default=10,
         ),
+        option(
+            "forcing",
+            str,
+            "Inner relative tolerance across Newton iterations: fixed (always "
+            "rel_tol) | ew1 | ew2 (Eisenstat-Walker forcing terms: loose far from "
+            "the root, tightening to rel_tol near it)",
+            default="fixed",
+        ),
+        option(
+            "forcing_max",
+            float,
+            "Upper bound on the Eisenstat-Walker forcing term",
+            default=0.9,
+        ),
+        option(
+            "compact_fraction",
+            float,
+            "Share of the still-iterating batch rows that must have converged before "
+            "the inner solve drops them and continues on the rest; 0 disables compaction",
+            default=0.0,
+        ),
     )
 
     @classmethod
@@ -106,6 +127,9 @@ class BiCGStab(_KrylovSolver):
             preconditioner=factory.get_solver(pc_name) if pc_name else None,
             cache_strategy=node.param_optional_str("cache_strategy", "none"),
             cache_max_its=node.param_optional_int("cache_max_its", 10),
+            forcing=node.param_optional_str("forcing", "fixed"),
+            forcing_max=node.param_optional_float("forcing_max", 0.9),
+            compact_fraction=node.param_optional_float("compact_fraction", 0.0),
         )
 
 
@@ -94,6 +94,34 @@ class GMRES(_KrylovSolver):
             "Iteration bar that triggers a preconditioner rebuild under the max_its cache strategy",
             default=10,
         ),
+        option(
+            "forcing",
+            str,
+            "Inner relative tolerance across Newton iterations: fixed (always "
+            "rel_tol) | ew1 | ew2 (Eisenstat-Walker forcing terms: loose far from "
+            "the root, tightening to rel_tol near it)",
+            default="fixed",
+        ),
+        option(
+            "forcing_max",
+            float,
+            "Upper bound on the Eisenstat-Walker forcing term",
+            default=0.9,
+        ),
+        option(
+            "recycle",
+            int,
+            "Number of Krylov directions carried from one inner solve to the next "
+            "(across restarts and Newton iterations) to deflate it; 0 disables recycling",
+            default=0,
+        ),
+        option(
+            "compact_fraction",
+            float,
+            "Share of the still-iterating batch rows that must have converged before "
+            "the inner solve drops them and continues on the rest; 0 disables compaction",
+            default=0.0,
+        ),
     )
 
     @classmethod
@@ -107,6 +135,10 @@ class GMRES(_KrylovSolver):
             preconditioner=factory.get_solver(pc_name) if pc_name else None,
             cache_strategy=node.param_optional_str("cache_strategy", "none"),
             cache_max_its=node.param_optional_int("cache_max_its", 10),
+            forcing=node.param_optional_str("forcing", "fixed"),
+            forcing_max=node.param_optional_float("forcing_max", 0.9),
+            recycle=node.param_optional_int("recycle", 0),
+            compact_fraction=node.param_optional_float("compact_fraction", 0.0),
         )
 
 
@@ -0,0 +1,250 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Unit test for the AdaptiveHybridScheduler throughput-balancing policy. Pure
+// scheduler logic -- no Model, no GPU: the two "devices" are CPU worker threads
+// (device strings are only parsed) whose throttled model sleeps a fixed time
+// per item, one 5x slower than the other. The same batch runs under a
+// StaticHybridScheduler whose priority wrongly favors the slow worker, and the
+// tail (last finish minus first finish) of both policies is reported.
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include <c10/core/Device.h>
+
+#include "neml2/csrc/dispatchers/AdaptiveHybridScheduler.h"
+#include "neml2/csrc/dispatchers/StaticHybridScheduler.h"
+
+#include "test_util.h"
+
+using namespace neml2::aoti;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+struct Timing
+{
+  double makespan_ms;
+  double tail_ms;
+};
+
+// Drive `s` through the DispatchedModel async protocol for a batch of `b`
+// items, with one worker thread per device sleeping `per_item` per item.
+Timing
+run_batch(AsyncScheduler & s,
+          const std::vector<at::Device> & devs,
+          const std::vector<std::chrono::microseconds> & per_item,
+          std::size_t b)
+{
+  std::mutex qm;
+  std::condition_variable qcv;
+  std::vector<std::queue<std::size_t>> queues(devs.size());
+  bool stop = false;
+  const auto t0 = Clock::now();
+  std::vector<Clock::time_point> finished(devs.size(), t0);
+
+  std::vector<std::thread> workers;
+  for (std::size_t k = 0; k < devs.size(); ++k)
+    workers.emplace_back(
+        [&, k]
+        {
+          while (true)
+          {
+            std::size_t n = 0;
+            {
+              std::unique_lock<std::mutex> lock(qm);
+              qcv.wait(lock, [&] { return stop || !queues[k].empty(); });
+              if (queues[k].empty())
+                return;
+              n = queues[k].front();
+              queues[k].pop();
+            }
+            std::this_thread::sleep_for(per_item[k] * n);
+            {
+              std::lock_guard<std::mutex> lock(qm);
+              finished[k] = Clock::now();
+            }
+            s.completed_work(devs[k], n);
+          }
+        });
+
+  s.begin_batch(b);
+  for (std::size_t start = 0; start < b;)
+  {
+    at::Device dev = at::kCPU;
+    std::size_t n = 0;
+    s.schedule_work(dev, n);
+    const auto count = std::min(n, b - start);
+    const auto k =
+        static_cast<std::size_t>(std::find(devs.begin(), devs.end(), dev) - devs.begin());
+    s.dispatched_work(dev, count);
+    {
+      std::lock_guard<std::mutex> lock(qm);
+      queues[k].push(count);
+    }
+    qcv.notify_all();
+    start += count;
+  }
+  s.wait_for_completion();
+  const auto end = Clock::now();
+  {
+    std::lock_guard<std::mutex> lock(qm);
+    stop = true;
+  }
+  qcv.notify_all();
+  for (auto & w : workers)
+    w.join();
+
+  const auto first = *std::min_element(finished.begin(), finished.end());
+  const auto ms = [](Clock::duration d)
+  { return std::chrono::duration<double, std::milli>(d).count(); };
+  return {ms(end - t0), ms(end - first)};
+}
+} // namespace
+
+int
+main()
+{
+  // Sizing without measurements: equal shares, one probe chunk per device.
+  {
+    AdaptiveHybridScheduler::Config cfg;
+    cfg.devices = {"cuda:0", "cuda:1"};
+    cfg.batch_sizes = {8};
+    cfg.capacities = {16};
+    AdaptiveHybridScheduler s(cfg);
+    NEML2_CHECK(s.devices().size() == 2);
+
+    at::Device dev = at::kCPU;
+    std::size_t n = 0;
+    s.begin_batch(12);
+    // #1: both idle, shares 6 each -> first device, a 6-item chunk.
+    s.schedule_work(dev, n);
+    NEML2_CHECK(dev == at::Device("cuda:0") && n == 6);
+    s.dispatched_work(dev, n);
+    // #2: cuda:0 is probing (one chunk until measured) -> cuda:1 takes the rest.
+    s.schedule_work(dev, n);
+    NEML2_CHECK(dev == at::Device("cuda:1") && n == 6);
+    s.dispatched_work(dev, n);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    s.completed_work(at::Device("cuda:0"), 6);
+    s.completed_work(at::Device("cuda:1"), 6);
+    s.wait_for_completion();
+    const auto r = s.throughputs();
+    NEML2_CHECK(r.size() == 2 && r[0] > 0.0 && r[1] > 0.0);
+
+    // Without begin_batch the remaining work is unknown: full chunks.
+    s.schedule_work(dev, n);
+    NEML2_CHECK(n == 8);
+  }
+
+  // Throttled workers: cuda:0 takes 50 us per item, cuda:1 10 us.
+  {
+    const std::vector<at::Device> devs = {at::Device("cuda:0"), at::Device("cuda:1")};
+    const std::vector<std::chrono::microseconds> per_item = {std::chrono::microseconds(50),
+                                                             std::chrono::microseconds(10)};
+    const std::size_t b = 4096;
+
+    StaticHybridScheduler::Config scfg;
+    scfg.devices = {"cuda:0", "cuda:1"};
+    scfg.batch_sizes = {128};
+    scfg.capacities = {256};
+    scfg.priorities = {2.0, 1.0}; // favors the slow worker
+    StaticHybridScheduler fixed(scfg);
+    const auto st = run_batch(fixed, devs, per_item, b);
+
+    AdaptiveHybridScheduler::Config acfg;
+    acfg.devices = {"cuda:0", "cuda:1"};
+    acfg.batch_sizes = {128};
+    acfg.capacities = {256};
+    acfg.min_batch_size = 16;
+    AdaptiveHybridScheduler adaptive(acfg);
+    (void)run_batch(adaptive, devs, per_item, b); // learns the throughputs
+    const auto r = adaptive.throughputs();
+    NEML2_CHECK(r[1] > 2.0 * r[0]);
+    const auto ad = run_batch(adaptive, devs, per_item, b);
+
+    std::printf("static:   makespan %.1f ms, tail %.1f ms\n", st.makespan_ms, st.tail_ms);
+    std::printf("adaptive: makespan %.1f ms, tail %.1f ms\n", ad.makespan_ms, ad.tail_ms);
+    std::printf("tail reduced by %.1f ms (%.0f%%)\n",
+                st.tail_ms - ad.tail_ms,
+                100.0 * (1.0 - ad.tail_ms / st.tail_ms));
+    NEML2_CHECK(ad.tail_ms < st.tail_ms);
+    NEML2_CHECK(ad.makespan_ms < st.makespan_ms);
+  }
+
+  // Config validation.
+  auto build = [](AdaptiveHybridScheduler::Config c)
+  { return std::make_shared<AdaptiveHybridScheduler>(c); };
+
+  { // empty devices
+    AdaptiveHybridScheduler::Config c;
+    c.batch_sizes = {1};
+    NEML2_CHECK_THROWS(build(c));
+  }
+  { // duplicate device
+    AdaptiveHybridScheduler::Config c;
+    c.devices = {"cuda:0", "cuda:0"};
+    c.batch_sizes = {1};
+    NEML2_CHECK_THROWS(build(c));
+  }
+  { // more than one CPU
+    AdaptiveHybridScheduler::Config c;
+    c.devices = {"cpu", "cpu:0"};
+    c.batch_sizes = {1};
+    NEML2_CHECK_THROWS(build(c));
+  }
+  { // capacity < batch_size
+    AdaptiveHybridScheduler::Config c;
+    c.devices = {"cuda:0"};
+    c.batch_sizes = {8};
+    c.capacities = {4};
+    NEML2_CHECK_THROWS(build(c));
+  }
+  { // smoothing outside (0, 1]
+    AdaptiveHybridScheduler::Config c;
+    c.devices = {"cuda:0"};
+    c.batch_sizes = {8};
+    c.smoothing = 0.0;
+    NEML2_CHECK_THROWS(build(c));
+  }
+  { // min_batch_size 0
+    AdaptiveHybridScheduler::Config c;
+    c.devices = {"cuda:0"};
+    c.batch_sizes = {8};
+    c.min_batch_size = 0;
+    NEML2_CHECK_THROWS(build(c));
+  }
+
+  return 0;
+}
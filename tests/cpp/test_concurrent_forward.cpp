@@ -0,0 +1,162 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+// Re-entrant calls on one Model: several threads drive forward / jacobian /
+// jvp concurrently on a single shared instance, each with its own inputs,
+// batch size, initial guess, Jacobian subset and Workspace, and every result
+// must match the same call made serially. Run under the ThreadSanitizer build
+// type to check for races as well as wrong answers.
+//
+// argv[1] is the fixture (collection) dir; the artifact is the one-unknown
+// implicit_simple scenario shared with test_forward_memo.
+
+#include <exception>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ATen/ATen.h>
+
+#include "neml2/csrc/aoti/Model.h"
+
+#include "test_util.h"
+
+using namespace neml2::aoti;
+
+namespace
+{
+using TensorMap = std::map<std::string, at::Tensor>;
+
+struct Case
+{
+  TensorMap ins;
+  TensorMap tangents;
+  std::vector<std::string> wrt;
+  TensorMap fwd;
+  VariablePairJacobian jac;
+  VariablePairJacobian sub;
+  TensorMap dout;
+};
+
+bool
+same(const TensorMap & a, const TensorMap & b)
+{
+  if (a.size() != b.size())
+    return false;
+  for (const auto & [k, t] : a)
+    if (!at::allclose(b.at(k), t, 1e-12, 1e-14))
+      return false;
+  return true;
+}
+
+bool
+same(const VariablePairJacobian & a, const VariablePairJacobian & b)
+{
+  if (a.size() != b.size())
+    return false;
+  for (const auto & [o, row] : a)
+    if (!same(row, b.at(o)))
+      return false;
+  return true;
+}
+} // namespace
+
+int
+main(int argc, char ** argv)
+{
+  NEML2_CHECK(argc >= 2); // argv[1] = the fixture (collection) dir
+  const int nthreads = 4;
+  const int rounds = 8;
+
+  LoadOptions load;
+  load.runners = 2; // fewer runners than callers, so some calls queue
+  Model model(std::string(argv[1]) + "/model", at::kCPU, at::kDouble, load);
+  NEML2_CHECK(model.input_names().size() > 1);
+
+  // Per-thread problems at different batch sizes, with serial references.
+  const auto opts = at::TensorOptions().dtype(model.dtype()).device(model.device());
+  std::vector<Case> cases(nthreads);
+  for (int t = 0; t < nthreads; ++t)
+  {
+    auto & c = cases[t];
+    const int64_t b = 3 + t;
+    for (std::size_t k = 0; k < model.input_names().size(); ++k)
+    {
+      std::vector<int64_t> shape{b};
+      const auto & base = model.input_base_shapes()[k];
+      shape.insert(shape.end(), base.begin(), base.end());
+      c.ins[model.input_names()[k]] = at::rand(shape, opts) + 0.5;
+      c.tangents[model.input_names()[k]] = at::rand(shape, opts);
+    }
+    c.wrt = {model.input_names()[t % model.input_names().size()]};
+    c.fwd = model.forward(c.ins);
+    c.jac = model.jacobian(c.ins).second;
+    c.sub = model.jacobian(c.ins, c.wrt, {}).second;
+    c.dout = model.jvp(c.ins, c.tangents).second;
+  }
+
+  std::vector<int> status(nthreads, 0);
+  std::vector<std::thread> pool;
+  for (int t = 0; t < nthreads; ++t)
+    pool.emplace_back(
+        [&, t]
+        {
+          const auto run = [&]() -> int
+          {
+            const auto & c = cases[t];
+            Model::Workspace ws;
+            for (int r = 0; r < rounds; ++r)
+            {
+              NEML2_CHECK(same(model.forward(c.ins, {}, {{"x", c.fwd.at("x")}}), c.fwd));
+              NEML2_CHECK(same(model.jacobian(c.ins, ws).second, c.jac));
+              NEML2_CHECK(same(model.jacobian(c.ins, c.wrt, {}).second, c.sub));
+              NEML2_CHECK(same(model.jvp(c.ins, c.tangents, ws).second, c.dout));
+            }
+            // The workspace was this thread's alone, so every call after the
+            // first at this shape was served from it.
+            NEML2_CHECK(ws.hits() > 0);
+            return 0;
+          };
+          try
+          {
+            status[t] = run();
+          }
+          catch (const std::exception & e)
+          {
+            std::fprintf(stderr, "thread %d: %s\n", t, e.what());
+            status[t] = 1;
+          }
+        });
+  for (auto & th : pool)
+    th.join();
+
+  for (int t = 0; t < nthreads; ++t)
+    NEML2_CHECK(status[t] == 0);
+
+  // A call on the main thread afterwards sees no leftover per-call state.
+  NEML2_CHECK(same(model.jacobian(cases[0].ins).second, cases[0].jac));
+  return 0;
+}
@@ -32,11 +32,14 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <ATen/ATen.h>
 
 #include "neml2/csrc/aoti/Exception.h"
 #include "neml2/csrc/aoti/Model.h"
+#include "neml2/csrc/aoti/log.h"
+#include "neml2/csrc/dispatchers/AutotuneScheduler.h"
 #include "neml2/csrc/dispatchers/DispatchedModel.h"
 #include "neml2/csrc/dispatchers/SimpleScheduler.h"
 #include "neml2/csrc/dispatchers/StaticHybridScheduler.h"
@@ -97,6 +100,62 @@ main(int argc, char ** argv)
   const auto ref_pjac = ref.param_jacobian(inputs);
   const auto ref_pvjp = ref.param_vjp(inputs, cotangents);
 
+  // A binding created in reversed input order takes the tensors positionally in
+  // that order and returns outputs in output_names() order.
+  {
+    std::vector<std::string> order(ref.input_names().rbegin(), ref.input_names().rend());
+    const auto bound = ref.bind(order);
+    std::vector<at::Tensor> positional;
+    for (const auto & name : order)
+      positional.push_back(inputs.at(name));
+    const auto outs = bound.forward(positional);
+    NEML2_CHECK(outs.size() == ref.output_names().size());
+    for (std::size_t j = 0; j < outs.size(); ++j)
+      NEML2_CHECK(at::allclose(outs[j], ref_out.at(ref.output_names()[j]), 1e-12, 1e-14));
+    NEML2_CHECK_THROWS(bound.forward({}));
+    NEML2_CHECK_THROWS(ref.bind({"not_an_input"}));
+  }
+
+  // A second sharing Model over the same artifact reuses the loaders the
+  // first one built (the info summary reports them as shared); a Model with
+  // the default options builds its own.
+  {
+    namespace L = neml2::aoti::log;
+    std::vector<std::string> lines;
+    L::set_default_level(L::Channel::Model, L::Level::Info);
+    L::set_sink([&](L::Level, const std::string & line) { lines.push_back(line); });
+    LoadOptions pooled;
+    pooled.share = true;
+    Model first(artifact_root, at::kCPU, at::kDouble, pooled);
+    Model twin(artifact_root, at::kCPU, at::kDouble, pooled);
+    Model solo(artifact_root, at::kCPU, at::kDouble);
+    L::reset_sink();
+    L::reset_defaults();
+    NEML2_CHECK(lines.size() == 3);
+    NEML2_CHECK(lines[0].find(" 0 shared") != std::string::npos);
+    NEML2_CHECK(lines[1].find(" 0 shared") == std::string::npos);
+    NEML2_CHECK(lines[2].find(" 0 shared") != std::string::npos);
+    const auto tout = twin.forward(inputs);
+    for (const auto & name : ref.output_names())
+      NEML2_CHECK(at::allclose(tout.at(name), ref_out.at(name), 1e-12, 1e-14));
+  }
+
+  // Parallel + lazy loading builds the same model: the deferred derivative
+  // graphs are built on their first call and agree with the eager reference.
+  {
+    LoadOptions load;
+    load.parallel = true;
+    load.lazy = true;
+    Model lazy(artifact_root, at::kCPU, at::kDouble, load);
+    const auto lout = lazy.forward(inputs);
+    for (const auto & name : ref.output_names())
+      NEML2_CHECK(at::allclose(lout.at(name), ref_out.at(name), 1e-12, 1e-14));
+    const auto [lpout, lpjac] = lazy.param_jacobian(inputs);
+    for (const auto & [o, row] : std::get<1>(ref_pjac))
+      for (const auto & [p, blk] : row)
+        NEML2_CHECK(at::allclose(lpjac.at(o).at(p), blk, 1e-12, 1e-14));
+  }
+
   // Chunked dispatch must match for every chunk size, including ones that do
   // not evenly divide the batch, the exact-batch case, and the no-chunk
   // sentinel (0).
@@ -282,6 +341,54 @@ main(int argc, char ** argv)
       NEML2_CHECK(at::allclose(out.at(name), ref2_out.at(name), 1e-8, 1e-10));
   }
 
+  // AutotuneScheduler: the first call of each operation sweeps chunk sizes for
+  // that operation on its own inputs and still matches the reference; a second
+  // scheduler on this host reads the sizes from the cache, and with
+  // calibrate_on_first_call off a call never sweeps. calibrate() needs an
+  // AutotuneScheduler.
+  {
+    const auto cache = std::filesystem::temp_directory_path() / "neml2_test_dispatcher_autotune";
+    std::filesystem::remove_all(cache);
+    AutotuneScheduler::Config cfg;
+    cfg.min_batch_size = 2;
+    cfg.max_batch_size = 16;
+    cfg.repeats = 1;
+    cfg.cache_dir = cache.string();
+    auto tuner = std::make_shared<AutotuneScheduler>(cfg);
+    DispatchedModel disp(artifact_root, tuner);
+    NEML2_CHECK(!tuner->calibrated());
+    const auto out = disp.forward(inputs);
+    NEML2_CHECK(tuner->calibrated() && !tuner->sweep().empty());
+    NEML2_CHECK(tuner->batch_size() >= 2 && tuner->batch_size() <= 16);
+    for (const auto & name : ref.output_names())
+      NEML2_CHECK(at::allclose(out.at(name), ref_out.at(name), 1e-8, 1e-10));
+    NEML2_CHECK(!tuner->calibrated("jacobian"));
+    const auto [jout, j] = disp.jacobian(inputs);
+    NEML2_CHECK(tuner->calibrated("jacobian") && !tuner->sweep("jacobian").empty());
+    for (const auto & o : ref.output_names())
+      for (const auto & i : ref.input_names())
+        NEML2_CHECK(at::allclose(j.at(o).at(i), std::get<1>(ref_jac).at(o).at(i), 1e-8, 1e-10));
+
+    auto again = std::make_shared<AutotuneScheduler>(cfg);
+    DispatchedModel disp2(artifact_root, again);
+    NEML2_CHECK(disp2.calibrate(inputs) == tuner->batch_size());
+    NEML2_CHECK(again->sweep().empty());
+
+    cfg.calibrate_on_first_call = false;
+    auto lookup = std::make_shared<AutotuneScheduler>(cfg);
+    DispatchedModel disp3(artifact_root, lookup);
+    (void)disp3.jacobian(inputs);
+    NEML2_CHECK(lookup->batch_size("jacobian") == tuner->batch_size("jacobian"));
+    NEML2_CHECK(lookup->sweep("jacobian").empty());
+    (void)disp3.param_vjp(inputs, cotangents); // nothing cached: unchunked, no sweep
+    NEML2_CHECK(!lookup->calibrated("param_vjp") && lookup->sweep("param_vjp").empty());
+    std::filesystem::remove_all(cache);
+
+    DispatchedModel plain(artifact_root,
+                          std::make_shared<SimpleScheduler>(SimpleScheduler::Config{"cpu", 4}));
+    NEML2_CHECK_THROWS(plain.calibrate(inputs));
+  }
+
   // Public API surface: the (Model, scheduler) constructor, move semantics, and
   // the trivial accessors -- kept exercised so they don't silently rot.
   {
@@ -0,0 +1,83 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Model::forward_into: writes the same values forward() returns into
+// caller-owned storage, reusing that storage across calls; a missing or
+// mis-shaped preallocated output is rejected.
+//
+// argv[1] is the dispatcher fixture's artifact folder (forward_promoted, cpu).
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <ATen/ATen.h>
+
+#include "neml2/csrc/aoti/Model.h"
+
+#include "test_util.h"
+
+using namespace neml2::aoti;
+
+int
+main(int argc, char ** argv)
+{
+  NEML2_CHECK(argc >= 2); // argv[1] = the fixture artifact root (holds metadata.json + cpu/)
+  const std::string artifact_root = argv[1];
+
+  at::manual_seed(0);
+
+  Model model(artifact_root, at::kCPU, at::kDouble);
+  const int64_t b = 10;
+  const auto opts = at::TensorOptions().dtype(model.dtype()).device(model.device());
+  std::map<std::string, at::Tensor> inputs;
+  for (std::size_t i = 0; i < model.input_names().size(); ++i)
+  {
+    std::vector<int64_t> shape{b};
+    const auto & base = model.input_base_shapes()[i];
+    shape.insert(shape.end(), base.begin(), base.end());
+    inputs.emplace(model.input_names()[i], at::randn(shape, opts));
+  }
+  const auto ref_out = model.forward(inputs);
+
+  std::map<std::string, at::Tensor> prealloc;
+  for (const auto & [name, t] : ref_out)
+    prealloc.emplace(name, at::empty_like(t));
+  const auto * storage = prealloc.begin()->second.data_ptr();
+  for (int rep = 0; rep < 2; ++rep)
+  {
+    model.forward_into(inputs, prealloc);
+    for (const auto & name : model.output_names())
+      NEML2_CHECK(at::allclose(prealloc.at(name), ref_out.at(name), 1e-12, 1e-14));
+  }
+  NEML2_CHECK(prealloc.begin()->second.data_ptr() == storage);
+
+  NEML2_CHECK_THROWS(model.forward_into(inputs, {}));
+  std::map<std::string, at::Tensor> wrong;
+  for (const auto & [name, t] : ref_out)
+    wrong.emplace(name, at::empty({b + 1}, t.options()));
+  NEML2_CHECK_THROWS(model.forward_into(inputs, wrong));
+
+  return 0;
+}
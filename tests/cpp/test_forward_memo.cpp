@@ -0,0 +1,128 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Model::set_forward_memo: with the memo on, a jacobian() / jvp() on the very
+// tensors the preceding forward() saw must skip the implicit segment's Newton
+// solve (observed on the `newton` log channel, which opens a banner per solve at
+// info) and still return exactly what a memo-less model returns. An in-place
+// edit of an input, or a fresh tensor with equal values, must re-solve.
+//
+// argv[1] is the fixture (collection) dir; the artifact is the one-unknown
+// implicit_simple scenario compiled with `-d :`.
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <ATen/ATen.h>
+
+#include "neml2/csrc/aoti/Model.h"
+#include "neml2/csrc/aoti/log.h"
+
+#include "test_util.h"
+
+using namespace neml2::aoti;
+namespace L = neml2::aoti::log;
+
+int
+main(int argc, char ** argv)
+{
+  NEML2_CHECK(argc >= 2); // argv[1] = the fixture (collection) dir
+  const std::string artifact_root = std::string(argv[1]) + "/model";
+
+  Model plain(artifact_root, at::kCPU, at::kDouble);
+  Model memo(artifact_root, at::kCPU, at::kDouble);
+  memo.set_forward_memo(true);
+
+  const int64_t b = 5;
+  const auto opts = at::TensorOptions().dtype(memo.dtype()).device(memo.device());
+  std::map<std::string, at::Tensor> ins;
+  for (std::size_t k = 0; k < memo.input_names().size(); ++k)
+  {
+    std::vector<int64_t> shape{b};
+    const auto & base = memo.input_base_shapes()[k];
+    shape.insert(shape.end(), base.begin(), base.end());
+    ins[memo.input_names()[k]] = at::rand(shape, opts) + 0.5;
+  }
+  std::map<std::string, at::Tensor> tangents;
+  for (const auto & [name, t] : ins)
+    tangents[name] = at::rand_like(t);
+
+  // Lines on the newton channel during one call, i.e. whether it solved.
+  std::vector<std::string> lines;
+  L::set_default_level(L::Channel::Newton, L::Level::Info);
+  L::set_sink([&](L::Level, const std::string & line) { lines.push_back(line); });
+  auto solves = [&](auto && call)
+  {
+    lines.clear();
+    call();
+    return lines.size();
+  };
+
+  auto check_jac = [&](const VariablePairJacobian & got, const VariablePairJacobian & want)
+  {
+    for (const auto & [o, row] : want)
+      for (const auto & [i, blk] : row)
+        if (!at::allclose(got.at(o).at(i), blk, 1e-12, 1e-14))
+          return false;
+    return true;
+  };
+
+  const auto [ref_out, ref_jac] = plain.jacobian(ins);
+  const auto [ref_jout, ref_jvp] = plain.jvp(ins, tangents);
+
+  NEML2_CHECK(solves([&] { memo.forward(ins); }) > 0);
+
+  VariablePairJacobian jac;
+  std::map<std::string, at::Tensor> jout, jvp;
+  NEML2_CHECK(solves([&] { jac = memo.jacobian(ins).second; }) == 0);
+  NEML2_CHECK(check_jac(jac, ref_jac));
+  NEML2_CHECK(solves([&] { std::tie(jout, jvp) = memo.jvp(ins, tangents); }) == 0);
+  for (const auto & [o, t] : ref_jvp)
+    NEML2_CHECK(at::allclose(jvp.at(o), t, 1e-12, 1e-14));
+  for (const auto & [o, t] : ref_jout)
+    NEML2_CHECK(at::allclose(jout.at(o), t, 1e-12, 1e-14));
+
+  // Equal values in a different tensor: not the same call.
+  auto copies = ins;
+  for (auto & [name, t] : copies)
+    t = t.clone();
+  NEML2_CHECK(solves([&] { memo.jacobian(copies); }) > 0);
+
+  // An in-place edit bumps the version counter, so the memo no longer matches.
+  memo.forward(ins);
+  ins.begin()->second.mul_(1.5);
+  NEML2_CHECK(solves([&] { jac = memo.jacobian(ins).second; }) > 0);
+  NEML2_CHECK(check_jac(jac, plain.jacobian(ins).second));
+
+  // Turning the memo off drops it.
+  memo.forward(ins);
+  memo.set_forward_memo(false);
+  NEML2_CHECK(solves([&] { memo.jacobian(ins); }) > 0);
+
+  L::reset_sink();
+  L::reset_defaults();
+  return 0;
+}
@@ -0,0 +1,141 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// forward(..., initial_guess): a guess equal to the converged unknowns must let
+// the implicit segment's Newton solve stop at its first residual check (the
+// `newton` channel reports "iters=0"), an unbatched guess must broadcast over
+// the call batch, NaN rows must fall back to the predictor, forward_into and a
+// Binding must take the guess too, and a key that is not an unknown must be
+// rejected.
+//
+// argv[1] is the fixture (collection) dir; the artifact is the one-unknown
+// implicit_simple scenario shared with test_forward_memo.
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <ATen/ATen.h>
+
+#include "neml2/csrc/aoti/Model.h"
+#include "neml2/csrc/aoti/log.h"
+
+#include "test_util.h"
+
+using namespace neml2::aoti;
+namespace L = neml2::aoti::log;
+
+int
+main(int argc, char ** argv)
+{
+  NEML2_CHECK(argc >= 2); // argv[1] = the fixture (collection) dir
+  Model model(std::string(argv[1]) + "/model", at::kCPU, at::kDouble);
+  NEML2_CHECK(model.unknown_names() == std::vector<std::string>{"x"});
+
+  const int64_t b = 5;
+  const auto opts = at::TensorOptions().dtype(model.dtype()).device(model.device());
+  std::map<std::string, at::Tensor> ins;
+  for (std::size_t k = 0; k < model.input_names().size(); ++k)
+  {
+    std::vector<int64_t> shape{b};
+    const auto & base = model.input_base_shapes()[k];
+    shape.insert(shape.end(), base.begin(), base.end());
+    ins[model.input_names()[k]] = at::rand(shape, opts) + 0.5;
+  }
+
+  std::vector<std::string> lines;
+  L::set_default_level(L::Channel::Newton, L::Level::Info);
+  L::set_sink([&](L::Level, const std::string & line) { lines.push_back(line); });
+  auto at_predictor = [&]
+  {
+    for (const auto & l : lines)
+      if (l.find("(iters=0,") != std::string::npos)
+        return true;
+    return false;
+  };
+
+  const auto ref = model.forward(ins);
+
+  lines.clear();
+  auto out = model.forward(ins, {}, {{"x", ref.at("x")}});
+  NEML2_CHECK(at_predictor());
+  NEML2_CHECK(at::allclose(out.at("x"), ref.at("x"), 1e-12, 1e-14));
+
+  // A guess that is off still converges to the same answer.
+  lines.clear();
+  out = model.forward(ins, {}, {{"x", at::zeros({}, opts)}});
+  NEML2_CHECK(at::allclose(out.at("x"), ref.at("x"), 1e-10, 1e-12));
+
+  // Rows left NaN start from the predictor and reach the same answer.
+  auto rows = ref.at("x").clone();
+  rows.narrow(0, 1, 2).fill_(std::numeric_limits<double>::quiet_NaN());
+  out = model.forward(ins, {}, {{"x", rows}});
+  NEML2_CHECK(at::allclose(out.at("x"), ref.at("x"), 1e-10, 1e-12));
+
+  // forward_into and a Binding take the same guess.
+  lines.clear();
+  std::map<std::string, at::Tensor> into;
+  for (const auto & [n, t] : ref)
+    into[n] = at::empty_like(t);
+  model.forward_into(ins, into, {}, {{"x", ref.at("x")}});
+  NEML2_CHECK(at_predictor());
+  NEML2_CHECK(at::allclose(into.at("x"), ref.at("x"), 1e-12, 1e-14));
+
+  lines.clear();
+  std::vector<at::Tensor> positional;
+  for (const auto & n : model.input_names())
+    positional.push_back(ins.at(n));
+  const auto bound = model.bind(model.input_names()).forward(positional, {}, {{"x", ref.at("x")}});
+  NEML2_CHECK(at_predictor());
+  const auto & onames = model.output_names();
+  const auto j =
+      static_cast<std::size_t>(std::find(onames.begin(), onames.end(), "x") - onames.begin());
+  NEML2_CHECK(at::allclose(bound[j], ref.at("x"), 1e-12, 1e-14));
+
+  // The jacobian path takes the same guess.
+  lines.clear();
+  const auto [jout, J] = model.jacobian(ins, {}, {{"x", ref.at("x")}});
+  NEML2_CHECK(at_predictor());
+  NEML2_CHECK(at::allclose(jout.at("x"), ref.at("x"), 1e-12, 1e-14));
+  NEML2_CHECK(!J.empty());
+
+  {
+    bool fatal = false;
+    try
+    {
+      (void)model.forward(ins, {}, {{"not_an_unknown", ref.at("x")}});
+    }
+    catch (const FatalError & e)
+    {
+      fatal = !e.recoverable();
+    }
+    NEML2_CHECK(fatal);
+  }
+
+  L::reset_sink();
+  L::reset_defaults();
+  return 0;
+}
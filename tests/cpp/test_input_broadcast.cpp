@@ -67,5 +67,29 @@ main(int argc, char ** argv)
   const auto outputs = m.jacobian(ins).first;
   NEML2_CHECK(at::allclose(outputs.at("C"), A + 5.0 + offset));
 
+  // The second call at the same layout replays the cached broadcast plan; it
+  // must still see the new values.
+  const auto B2 = at::full({}, -1.0, opts);
+  NEML2_CHECK(at::allclose(m.jacobian({{"A", A}, {"B", B2}}).first.at("C"), A - 1.0 + offset));
+
+  // A different batch, and the same sizes with different strides, re-plan.
+  const auto A3 = at::arange(2 * b, opts);
+  NEML2_CHECK(at::allclose(m.forward({{"A", A3}, {"B", B}}).at("C"), A3 + 5.0 + offset));
+  const auto A_strided = A3.slice(0, 0, 2 * b, 2);
+  NEML2_CHECK(at::allclose(m.jacobian({{"A", A_strided}, {"B", B}}).first.at("C"),
+                           A_strided + 5.0 + offset));
+
+  // Incompatible batches right after a cached good call are still rejected.
+  bool fatal = false;
+  try
+  {
+    (void)m.forward({{"A", A}, {"B", at::ones({b + 1}, opts)}});
+  }
+  catch (const FatalError & e)
+  {
+    fatal = !e.recoverable();
+  }
+  NEML2_CHECK(fatal);
+
   return 0;
 }
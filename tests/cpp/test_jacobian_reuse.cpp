@@ -0,0 +1,114 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// SolverConfig::jacobian_refresh: modified Newton (refresh every 2 iterations)
+// and chord Newton (assemble once) must converge to the full-Newton answer, and
+// the chord solve must take more iterations, which shows the Jacobian was in
+// fact reused. The tangent comes from the implicit-function theorem at the
+// converged state, so `jacobian` must not depend on the setting either.
+//
+// argv[1] is the fixture (collection) dir; the artifact is implicit_substep_nl,
+// whose residual x - x~1 - (t - t~1) x^3 is nonlinear in the unknown.
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <ATen/ATen.h>
+
+#include "neml2/csrc/aoti/Model.h"
+#include "neml2/csrc/aoti/log.h"
+
+#include "test_util.h"
+
+using namespace neml2::aoti;
+namespace L = neml2::aoti::log;
+
+int
+main(int argc, char ** argv)
+{
+  NEML2_CHECK(argc >= 2); // argv[1] = the fixture (collection) dir
+  Model model(std::string(argv[1]) + "/model", at::kCPU, at::kDouble);
+  NEML2_CHECK(model.unknown_names() == std::vector<std::string>{"x"});
+
+  // A small step (t - t~1 = 0.1) from x~1 in [0.5, 1) converges without
+  // substepping under every refresh setting.
+  const int64_t b = 8;
+  const auto opts = at::TensorOptions().dtype(model.dtype()).device(model.device());
+  std::map<std::string, at::Tensor> ins;
+  for (std::size_t k = 0; k < model.input_names().size(); ++k)
+  {
+    const auto & name = model.input_names()[k];
+    std::vector<int64_t> shape{b};
+    const auto & base = model.input_base_shapes()[k];
+    shape.insert(shape.end(), base.begin(), base.end());
+    if (name == "t")
+      ins[name] = at::full(shape, 1.1, opts);
+    else if (name == "t~1")
+      ins[name] = at::full(shape, 1.0, opts);
+    else
+      ins[name] = 0.5 * at::rand(shape, opts) + 0.5;
+  }
+
+  std::size_t iterations = 0;
+  L::set_default_level(L::Channel::Newton, L::Level::Debug);
+  L::set_sink(
+      [&](L::Level, const std::string & line)
+      {
+        if (line.find("ITERATION") != std::string::npos &&
+            line.find("LS ITERATION") == std::string::npos)
+          ++iterations;
+      });
+
+  auto cfg = model.solver_config();
+  cfg.miters = 100;
+  auto solve_with = [&](std::size_t refresh)
+  {
+    cfg.jacobian_refresh = refresh;
+    model.set_solver_config(cfg);
+    iterations = 0;
+    return model.forward(ins).at("x");
+  };
+
+  const auto ref = solve_with(1);
+  const auto full_iters = iterations;
+  const auto [ref_out, ref_J] = model.jacobian(ins);
+
+  const auto modified = solve_with(2);
+  NEML2_CHECK(at::allclose(modified, ref, 1e-8, 1e-10));
+
+  const auto chord = solve_with(0);
+  NEML2_CHECK(at::allclose(chord, ref, 1e-8, 1e-10));
+  NEML2_CHECK(iterations > full_iters);
+
+  const auto [out, J] = model.jacobian(ins);
+  NEML2_CHECK(at::allclose(out.at("x"), ref_out.at("x"), 1e-8, 1e-10));
+  for (const auto & [o, row] : ref_J)
+    for (const auto & [i, blk] : row)
+      NEML2_CHECK(at::allclose(J.at(o).at(i), blk, 1e-6, 1e-10));
+
+  L::reset_sink();
+  L::reset_defaults();
+  return 0;
+}
@@ -0,0 +1,127 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Model::jvp_multi: K tangent directions in one call must match K separate
+// jvp() calls slice by slice, with a single Newton solve for the lot (counted
+// off the `newton` channel's per-solve begin banner). Missing tangents are zero
+// in every direction, and tangents with disagreeing K are rejected.
+//
+// argv[1] is the fixture (collection) dir; the artifact is the implicit_simple
+// scenario compiled with `-d :`.
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <ATen/ATen.h>
+
+#include "neml2/csrc/aoti/Model.h"
+#include "neml2/csrc/aoti/log.h"
+
+#include "test_util.h"
+
+using namespace neml2::aoti;
+namespace L = neml2::aoti::log;
+
+int
+main(int argc, char ** argv)
+{
+  NEML2_CHECK(argc >= 2); // argv[1] = the fixture (collection) dir
+  Model model(std::string(argv[1]) + "/model", at::kCPU, at::kDouble);
+
+  const int64_t b = 4, k = 3;
+  const auto opts = at::TensorOptions().dtype(model.dtype()).device(model.device());
+  std::map<std::string, at::Tensor> ins, tangents;
+  for (std::size_t i = 0; i < model.input_names().size(); ++i)
+  {
+    const auto & base = model.input_base_shapes()[i];
+    std::vector<int64_t> shape{b}, tshape{b, k};
+    shape.insert(shape.end(), base.begin(), base.end());
+    tshape.insert(tshape.end(), base.begin(), base.end());
+    ins[model.input_names()[i]] = at::rand(shape, opts) + 0.5;
+    tangents[model.input_names()[i]] = at::randn(tshape, opts);
+  }
+
+  std::size_t begins = 0;
+  L::set_default_level(L::Channel::Newton, L::Level::Info);
+  L::set_sink(
+      [&](L::Level, const std::string & line)
+      {
+        if (line.find("---- begin") != std::string::npos)
+          ++begins;
+      });
+
+  const auto [out, jout] = model.jvp_multi(ins, tangents);
+  NEML2_CHECK(begins == 1);
+  const auto ref_out = model.forward(ins);
+  for (const auto & [o, t] : ref_out)
+    NEML2_CHECK(at::allclose(out.at(o), t, 1e-12, 1e-14));
+
+  for (int64_t d = 0; d < k; ++d)
+  {
+    std::map<std::string, at::Tensor> td;
+    for (const auto & [name, t] : tangents)
+      td[name] = t.select(1, d);
+    const auto ref = model.jvp(ins, td).second;
+    for (const auto & [o, t] : ref)
+    {
+      NEML2_CHECK(jout.at(o).size(1) == k);
+      NEML2_CHECK(at::allclose(jout.at(o).select(1, d), t, 1e-10, 1e-12));
+    }
+  }
+
+  // Only one tangent: the rest are zero.
+  {
+    const auto & first = model.input_names().front();
+    const auto multi = model.jvp_multi(ins, {{first, tangents.at(first)}}).second;
+    for (int64_t d = 0; d < k; ++d)
+    {
+      const auto ref = model.jvp(ins, {{first, tangents.at(first).select(1, d)}}).second;
+      for (const auto & [o, t] : ref)
+        NEML2_CHECK(at::allclose(multi.at(o).select(1, d), t, 1e-10, 1e-12));
+    }
+  }
+
+  // Disagreeing direction counts.
+  if (model.input_names().size() > 1)
+  {
+    auto bad = tangents;
+    auto & t = bad.at(model.input_names().back());
+    t = at::cat({t, t}, 1);
+    bool fatal = false;
+    try
+    {
+      (void)model.jvp_multi(ins, bad);
+    }
+    catch (const FatalError & e)
+    {
+      fatal = !e.recoverable();
+    }
+    NEML2_CHECK(fatal);
+  }
+
+  L::reset_sink();
+  L::reset_defaults();
+  return 0;
+}
@@ -28,6 +28,7 @@
 // the functor interface in isolation against `at::linalg_solve`.
 
 #include <cstdio>
+#include <utility>
 
 #include <ATen/ATen.h>
 
@@ -209,7 +210,7 @@ check_dense_solve()
                   xv_direct.norm().clamp_min(1e-30).item<double>() <
               1e-8);
 
-  // Matrix RHS -> (B, N, M) (solved column by column), vs the batched direct solve.
+  // Matrix RHS -> (B, N, M) (block GMRES), vs the batched direct solve.
   auto Bmat = at::randn({Bsz, n, M}, opts);
   auto Xm = krylov_solve_dense(A, Bmat, cfg);
   NEML2_CHECK(Xm.sizes() == Bmat.sizes());
@@ -237,6 +238,47 @@ check_dense_solve_n1()
   return 0;
 }
 
+// Matrix RHS through block GMRES: every column shares one basis, so a full-width
+// cycle needs at most N / M block steps. Also covers a zero column, a
+// restart width that forces restarts, more columns than unknowns (solved in
+// groups), and BiCGStab with the columns folded into the batch.
+int
+check_block_gmres()
+{
+  at::manual_seed(7);
+  const auto opts = at::TensorOptions().dtype(at::kDouble);
+  const int64_t Bsz = 4, n = 10, M = 5;
+  auto A = make_operator(Bsz, n, opts);
+  auto Bmat = at::randn({Bsz, n, M}, opts);
+  Bmat.select(-1, 2).zero_();
+  const auto rel_err = [](const at::Tensor & X, const at::Tensor & ref)
+  { return (X - ref).norm().item<double>() / ref.norm().clamp_min(1e-30).item<double>(); };
+
+  KrylovConfig cfg;
+  cfg.rel_tol = 1e-11;
+  auto res = block_gmres(A, Bmat, cfg);
+  NEML2_CHECK(res.du.sizes() == Bmat.sizes());
+  NEML2_CHECK(res.converged.all().item<bool>());
+  NEML2_CHECK(res.max_iters <= n / M);
+  NEML2_CHECK(rel_err(res.du, at::linalg_solve(A, Bmat)) < 1e-8);
+  NEML2_CHECK(res.du.select(-1, 2).abs().max().item<double>() == 0.0);
+
+  // One block per cycle: converges across restarts.
+  cfg.restart = 1;
+  cfg.max_its = 200;
+  NEML2_CHECK(rel_err(krylov_solve_dense(A, Bmat, cfg), at::linalg_solve(A, Bmat)) < 1e-8);
+
+  // More columns than unknowns.
+  cfg.restart = 40;
+  auto Bwide = at::randn({Bsz, n, n + 3}, opts);
+  NEML2_CHECK(rel_err(krylov_solve_dense(A, Bwide, cfg), at::linalg_solve(A, Bwide)) < 1e-8);
+
+  cfg.method = KrylovMethod::BiCGStab;
+  cfg.rel_tol = 1e-10;
+  NEML2_CHECK(rel_err(krylov_solve_dense(A, Bmat, cfg), at::linalg_solve(A, Bmat)) < 1e-7);
+  return 0;
+}
+
 // String -> enum parsing (valid values + rejection of an unknown one).
 int
 check_parse()
@@ -250,6 +292,11 @@ check_parse()
   NEML2_CHECK(parse_cache_strategy("chord", c) && c == CacheStrategy::Chord);
   NEML2_CHECK(parse_cache_strategy("max_its", c) && c == CacheStrategy::MaxLinearIters);
   NEML2_CHECK(!parse_cache_strategy("bogus", c));
+  ForcingTerm f = ForcingTerm::Fixed;
+  NEML2_CHECK(parse_forcing_term("ew1", f) && f == ForcingTerm::EW1);
+  NEML2_CHECK(parse_forcing_term("ew2", f) && f == ForcingTerm::EW2);
+  NEML2_CHECK(parse_forcing_term("fixed", f) && f == ForcingTerm::Fixed);
+  NEML2_CHECK(!parse_forcing_term("ew3", f));
   return 0;
 }
 
@@ -277,6 +324,38 @@ check_nonconvergence()
   return 0;
 }
 
+// A per-element relative tolerance (the forcing-term path): each element stops
+// at its own tolerance, and `resid` reports the residual the stop test saw.
+int
+check_per_element_tol()
+{
+  at::manual_seed(5);
+  const auto opts = at::TensorOptions().dtype(at::kDouble);
+  const int64_t Bsz = 6, n = 20;
+  auto A = make_operator(Bsz, n, opts);
+  auto b = at::randn({Bsz, n}, opts);
+  const MatvecFn matvec = [&A](const at::Tensor & v) { return apply_dense(A, v); };
+  const PrecondFn identity = [](const at::Tensor & v) { return v; };
+  const auto rtol = at::tensor({1e-1, 1e-9, 1e-1, 1e-9, 1e-2, 1e-6}, opts);
+  for (const auto method : {KrylovMethod::GMRES, KrylovMethod::BiCGStab})
+  {
+    KrylovConfig cfg;
+    cfg.method = method;
+    cfg.restart = n;
+    cfg.max_its = 8 * n;
+    cfg.rel_tol = 1.0; // ignored: the tensor tolerance replaces it
+    auto res = krylov_solve(matvec, identity, b, cfg, {}, rtol);
+    NEML2_CHECK(res.converged.all().item<bool>());
+    NEML2_CHECK(res.resid.sizes() == rtol.sizes());
+    NEML2_CHECK((res.resid / b.norm(2, -1) < rtol).all().item<bool>());
+    // The tight elements are solved to the direct answer; the loose ones are not.
+    auto x_direct = at::linalg_solve(A, b.unsqueeze(-1)).squeeze(-1);
+    const auto err = (res.du - x_direct).norm(2, -1) / x_direct.norm(2, -1);
+    NEML2_CHECK(err[1].item<double>() < 1e-8 && err[3].item<double>() < 1e-8);
+  }
+  return 0;
+}
+
 // The optional per-inner-iteration logging hook (LinearLogFn) must fire for both
 // methods -- the NonlinearSystem layer uses it to trace the `linear` channel.
 int
@@ -309,6 +388,87 @@ check_on_iter_hook()
   }
   return 0;
 }
+
+// In-loop compaction (compact_fraction): a batch of easy, near-identity rows plus
+// two stiff ones. Once the easy rows converge the solve continues on the stiff
+// rows only, through the restrict functor: the same answer for fewer
+// row-matvecs. A restrict functor that declines keeps the full batch; GMRES
+// with a recycle space hands every row back a space of the full batch.
+int
+check_compaction()
+{
+  at::manual_seed(13);
+  const auto opts = at::TensorOptions().dtype(at::kDouble);
+  const int64_t Bsz = 8, n = 20;
+  auto A = make_operator(Bsz, n, opts);
+  const auto stiff = at::diag(at::linspace(0.05, 1.0, n, opts)) + 0.02 * at::randn({n, n}, opts);
+  A.select(0, 6).copy_(stiff);
+  A.select(0, 7).copy_(stiff.transpose(0, 1));
+  auto b = at::randn({Bsz, n}, opts);
+
+  int64_t rows = 0; // rows pushed through a matvec, summed over calls
+  const MatvecFn matvec = [&](const at::Tensor & v)
+  {
+    rows += v.size(0);
+    return apply_dense(A, v);
+  };
+  const PrecondFn identity = [](const at::Tensor & v) { return v; };
+  const KrylovRestrictFn restrict_ops = [&](const at::Tensor & idx)
+  {
+    const auto As = A.index_select(0, idx);
+    const MatvecFn sub = [&rows, As](const at::Tensor & v)
+    {
+      rows += v.size(0);
+      return apply_dense(As, v);
+    };
+    return std::make_pair(sub, identity);
+  };
+  const KrylovRestrictFn decline = [](const at::Tensor &)
+  { return std::pair<MatvecFn, PrecondFn>{}; };
+
+  for (const auto method : {KrylovMethod::GMRES, KrylovMethod::BiCGStab})
+  {
+    KrylovConfig cfg;
+    cfg.method = method;
+    cfg.restart = n;
+    cfg.max_its = 20 * n;
+    cfg.rel_tol = 1e-8;
+    rows = 0;
+    auto full = krylov_solve(matvec, identity, b, cfg);
+    const int64_t rows_full = rows;
+    NEML2_CHECK(full.converged.all().item<bool>());
+
+    cfg.compact_fraction = 0.5;
+    rows = 0;
+    auto res = krylov_solve(matvec, identity, b, cfg, {}, {}, nullptr, restrict_ops);
+    NEML2_CHECK(res.du.sizes() == b.sizes());
+    NEML2_CHECK(res.converged.sizes() == full.converged.sizes());
+    NEML2_CHECK(res.resid.sizes() == full.resid.sizes());
+    NEML2_CHECK(res.converged.all().item<bool>());
+    NEML2_CHECK(rel_residual(A, res.du, b) < 1e-6);
+    NEML2_CHECK(rows < rows_full);
+
+    rows = 0;
+    auto kept = krylov_solve(matvec, identity, b, cfg, {}, {}, nullptr, decline);
+    NEML2_CHECK(rows == rows_full);
+    NEML2_CHECK((kept.du - full.du).abs().max().item<double>() < 1e-12);
+  }
+
+  // Restarts with a recycle space: compaction drops rows mid-cycle and between
+  // cycles, and the space handed back still covers the whole batch.
+  KrylovConfig cfg;
+  cfg.restart = 4;
+  cfg.max_its = 40 * n;
+  cfg.rel_tol = 1e-8;
+  cfg.recycle = 2;
+  cfg.compact_fraction = 0.5;
+  KrylovRecycle rc;
+  auto res = krylov_solve(matvec, identity, b, cfg, {}, {}, &rc, restrict_ops);
+  NEML2_CHECK(res.converged.all().item<bool>());
+  NEML2_CHECK(rel_residual(A, res.du, b) < 1e-6);
+  NEML2_CHECK(rc.U.defined() && rc.U.size(0) == Bsz && rc.U.size(1) == n);
+  return 0;
+}
 } // namespace
 
 int
@@ -341,15 +501,23 @@ main()
   NEML2_CHECK(check_flatten() == 0);
 
   // Dense assembled-operator solve (the C++ iterative-sensitivity path): vector +
-  // matrix RHS, the N=1 edge case, string->enum parsing, and non-convergence.
+  // matrix RHS, the N=1 edge case, block GMRES, string->enum parsing, and
+  // non-convergence.
   NEML2_CHECK(check_dense_solve() == 0);
   NEML2_CHECK(check_dense_solve_n1() == 0);
+  NEML2_CHECK(check_block_gmres() == 0);
   NEML2_CHECK(check_parse() == 0);
   NEML2_CHECK(check_nonconvergence() == 0);
 
   // The per-inner-iteration logging hook fires for both methods.
   NEML2_CHECK(check_on_iter_hook() == 0);
 
+  // Per-element tolerances, as the Eisenstat-Walker forcing terms pass them.
+  NEML2_CHECK(check_per_element_tol() == 0);
+
+  // In-loop compaction of converged rows.
+  NEML2_CHECK(check_compaction() == 0);
+
   std::printf("test_krylov: all checks passed\n");
   return 0;
 }
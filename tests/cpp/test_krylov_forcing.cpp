@@ -0,0 +1,159 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Standalone test for the Eisenstat-Walker forcing terms (`KrylovConfig::forcing`,
+// consumed by KrylovNonlinearSystem::step). A hand-built batched system with
+//
+//   r(u) = A u + u^3 / 2 - c,
+//
+// A a near-identity dense operator, is solved by Newton with an unpreconditioned
+// GMRES inner solve under each forcing term. EW1 and EW2 must reach the same
+// root as the fixed inner tolerance with fewer matvecs in total.
+
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <ATen/ATen.h>
+
+#include "neml2/csrc/aoti/krylov.h"
+#include "neml2/csrc/aoti/newton.h"
+#include "neml2/csrc/aoti/nonlinear_system_krylov.h"
+
+#include "test_util.h"
+
+using namespace neml2::aoti;
+
+namespace
+{
+// One DENSE group of size n; counts matvec calls (one per inner iteration).
+class CubicSystem : public KrylovNonlinearSystem
+{
+public:
+  CubicSystem(at::Tensor A, at::Tensor c, const KrylovConfig & cfg, std::shared_ptr<int64_t> mvs)
+    : KrylovNonlinearSystem({GroupLayout{"dense", {}}}, {GroupLayout{"dense", {}}}, cfg),
+      _A(std::move(A)),
+      _c(std::move(c)),
+      _mvs(std::move(mvs))
+  {
+  }
+
+protected:
+  std::vector<at::Tensor> residual_raw(const std::vector<at::Tensor> & u) const override
+  {
+    const auto uu = u[0].expand_as(_c);
+    return {_c - at::einsum("bnm,bm->bn", {_A, uu}) - 0.5 * uu.pow(3)};
+  }
+
+  std::vector<at::Tensor> matvec_raw(const std::vector<at::Tensor> & u,
+                                     const std::vector<at::Tensor> & v) const override
+  {
+    ++*_mvs;
+    const auto uu = u[0].expand_as(_c);
+    return {at::einsum("bnm,bm->bn", {_A, v[0]}) + 1.5 * uu.pow(2) * v[0]};
+  }
+
+  bool has_preconditioner() const override { return false; }
+  std::vector<at::Tensor> precond_setup_raw(const std::vector<at::Tensor> &) const override
+  {
+    return {};
+  }
+  at::Tensor precond_apply_raw(const std::vector<at::Tensor> &,
+                               const at::Tensor & r_flat) const override
+  {
+    return r_flat;
+  }
+
+private:
+  at::Tensor _A;
+  at::Tensor _c;
+  std::shared_ptr<int64_t> _mvs;
+};
+
+SolverConfig
+make_cfg()
+{
+  SolverConfig cfg;
+  cfg.atol = 1.0e-12;
+  cfg.rtol = 1.0e-10;
+  cfg.miters = 40;
+  return cfg;
+}
+} // namespace
+
+int
+main()
+{
+  at::manual_seed(31);
+  const auto opts = at::TensorOptions().dtype(at::kDouble);
+  const int64_t B = 4, n = 12;
+  const auto A = 0.3 / std::sqrt(static_cast<double>(n)) * at::randn({B, n, n}, opts) +
+                 at::eye(n, opts);
+  const auto c = 0.5 + 1.5 * at::rand({B, n}, opts);
+  const auto u0 = at::zeros({B, n}, opts);
+
+  KrylovConfig kcfg;
+  kcfg.restart = n;
+  kcfg.max_its = 10 * n;
+  kcfg.rel_tol = 1.0e-4;
+
+  auto mvs = std::make_shared<int64_t>(0);
+  const auto ref = Newton(make_cfg()).solve(CubicSystem(A, c, kcfg, mvs), {u0});
+  NEML2_CHECK(ref.converged);
+  const auto fixed_mvs = *mvs;
+
+  for (const auto forcing : {ForcingTerm::EW1, ForcingTerm::EW2})
+  {
+    kcfg.forcing = forcing;
+    *mvs = 0;
+    const auto res = Newton(make_cfg()).solve(CubicSystem(A, c, kcfg, mvs), {u0});
+    std::printf("forcing %d: %zu iterations, %lld matvecs (fixed: %zu, %lld)\n",
+                static_cast<int>(forcing),
+                res.iterations,
+                static_cast<long long>(*mvs),
+                ref.iterations,
+                static_cast<long long>(fixed_mvs));
+    NEML2_CHECK(res.converged);
+    NEML2_CHECK(at::allclose(res.u[0], ref.u[0], 1e-8, 1e-10));
+    NEML2_CHECK(*mvs < fixed_mvs);
+  }
+
+  // A forcing_max below rel_tol pins eta to rel_tol: the fixed solve, matvec for
+  // matvec. With collect_stats the solve reports the same count.
+  kcfg.forcing = ForcingTerm::EW2;
+  kcfg.forcing_max = 0.0;
+  *mvs = 0;
+  auto stats_cfg = make_cfg();
+  stats_cfg.collect_stats = true;
+  const auto pinned = Newton(stats_cfg).solve(CubicSystem(A, c, kcfg, mvs), {u0});
+  NEML2_CHECK(pinned.converged);
+  NEML2_CHECK(*mvs == fixed_mvs);
+  NEML2_CHECK(static_cast<int64_t>(pinned.stats.matvecs) == fixed_mvs);
+  NEML2_CHECK(pinned.stats.precond_rebuilds == 0);
+
+  std::printf("OK\n");
+  return 0;
+}
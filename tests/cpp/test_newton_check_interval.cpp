@@ -0,0 +1,169 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+// Standalone numerics test for `SolverConfig::check_interval` in `Newton::solve`
+// and `Newton::solve_masked` (newton.cpp). A hand-built batched cube-root system
+// r(u) = u^3 - a, whose rows converge after different numbers of iterations,
+// is solved with a check every iteration and with a check every k iterations.
+// The sync-free mode must reach the same roots, report an iteration count on a
+// check boundary, leave rows it froze in place, and still throw on a
+// non-finite row. Its line search reads the stop test back on check boundaries
+// only.
+
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+#include <ATen/ATen.h>
+
+#include "neml2/csrc/aoti/Exception.h"
+#include "neml2/csrc/aoti/newton.h"
+#include "neml2/csrc/aoti/nonlinear_system.h"
+
+#include "test_util.h"
+
+using namespace neml2::aoti;
+
+namespace
+{
+// Row-wise r(u) = u^3 - a as a single DENSE group of size 1. Solver conventions
+// (see NonlinearSystem): residual() returns b = -r and step() solves A du = b
+// with A = 3u^2.
+class CubeRootSystem : public NonlinearSystem
+{
+public:
+  explicit CubeRootSystem(at::Tensor a)
+    : _a(std::move(a)),
+      _layout{GroupLayout{"dense", {}}}
+  {
+  }
+
+  std::vector<at::Tensor> residual(const std::vector<at::Tensor> & u) const override
+  {
+    return {_a - u[0] * u[0] * u[0]};
+  }
+
+  std::pair<std::vector<at::Tensor>, std::vector<at::Tensor>>
+  step(const std::vector<at::Tensor> & u) const override
+  {
+    auto b = residual(u);
+    std::vector<at::Tensor> du{b[0] / (3.0 * u[0] * u[0])};
+    return {std::move(du), std::move(b)};
+  }
+
+  const std::vector<GroupLayout> & unknown_layout() const override { return _layout; }
+  const std::vector<GroupLayout> & residual_layout() const override { return _layout; }
+
+private:
+  at::Tensor _a;
+  std::vector<GroupLayout> _layout;
+};
+
+SolverConfig
+make_cfg(std::size_t check_interval, std::size_t ls_max_iters)
+{
+  SolverConfig cfg;
+  cfg.atol = 1.0e-12;
+  cfg.rtol = 1.0e-12;
+  cfg.miters = 60;
+  cfg.ls_max_iters = ls_max_iters;
+  cfg.check_interval = check_interval;
+  return cfg;
+}
+} // namespace
+
+int
+main()
+{
+  const auto opts = at::TensorOptions().dtype(at::kDouble);
+  // Roots 1, 2, 3, 10 from u0 = 1: the first row starts converged, the last
+  // takes the most iterations.
+  const auto a = at::tensor({1.0, 8.0, 27.0, 1000.0}, opts).unsqueeze(-1);
+  const auto root = at::tensor({1.0, 2.0, 3.0, 10.0}, opts).unsqueeze(-1);
+  const auto u0 = at::ones({4, 1}, opts);
+  CubeRootSystem sys(a);
+
+  for (const std::size_t ls : {std::size_t(1), std::size_t(4)})
+  {
+    const auto ref = Newton(make_cfg(1, ls)).solve(sys, {u0});
+    NEML2_CHECK(at::allclose(ref.u[0], root, 1e-10, 1e-12));
+
+    for (const std::size_t k : {std::size_t(2), std::size_t(3), std::size_t(8)})
+    {
+      const auto res = Newton(make_cfg(k, ls)).solve(sys, {u0});
+      std::printf("ls=%zu k=%zu: iters %zu (every-iteration check: %zu)\n",
+                  ls,
+                  k,
+                  res.iterations,
+                  ref.iterations);
+      NEML2_CHECK(res.converged);
+      NEML2_CHECK(at::allclose(res.u[0], root, 1e-10, 1e-12));
+      // Convergence is only observed on a check boundary, never before the
+      // every-iteration solve saw it.
+      NEML2_CHECK(res.iterations % k == 0);
+      NEML2_CHECK(res.iterations >= ref.iterations);
+      NEML2_CHECK(res.iterations < ref.iterations + k);
+      // The row that started at its root was frozen and never moved.
+      NEML2_CHECK(res.u[0][0].item<double>() == 1.0);
+
+      // With k >= ls_max_iters - 1 the line search never reads its stop test
+      // back, so every update runs the full trial budget.
+      if (ls > 1 && k + 1 >= ls)
+      {
+        auto cfg = make_cfg(k, ls);
+        cfg.collect_stats = true;
+        const auto counted = Newton(cfg).solve(sys, {u0});
+        NEML2_CHECK(counted.stats.linesearch_trials == counted.iterations * (ls - 1));
+        NEML2_CHECK(at::equal(counted.u[0], res.u[0]));
+      }
+
+      const auto masked = Newton(make_cfg(k, ls)).solve_masked(sys, {u0});
+      NEML2_CHECK(masked.converged);
+      NEML2_CHECK(masked.converged_mask.all().item<bool>());
+      NEML2_CHECK(at::allclose(masked.u[0], root, 1e-10, 1e-12));
+      NEML2_CHECK(masked.iterations % k == 0);
+    }
+  }
+
+  // A row that blows up (du = b / 0 at u = 0) is still reported at the next
+  // check as a recoverable failure.
+  {
+    auto bad = u0.clone();
+    bad[2] = 0.0;
+    bool threw = false;
+    try
+    {
+      (void)Newton(make_cfg(4, 1)).solve(sys, {bad});
+    }
+    catch (const ConvergenceError & e)
+    {
+      threw = e.recoverable();
+    }
+    NEML2_CHECK(threw);
+  }
+
+  std::printf("OK\n");
+  return 0;
+}
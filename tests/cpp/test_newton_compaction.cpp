@@ -0,0 +1,173 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+// Standalone numerics test for active-set compaction in `Newton::solve_masked`
+// (`SolverConfig::compact_fraction`, newton.cpp). A hand-built batched
+// cube-root system r(u) = u^3 - a, where most rows converge quickly and a few
+// take many iterations, is solved with and without compaction. Compaction must
+// give the same iterate and mask, evaluate fewer rows in total, and fall back to
+// the full batch for a system that cannot be restricted.
+
+#include <cstdio>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <ATen/ATen.h>
+
+#include "neml2/csrc/aoti/newton.h"
+#include "neml2/csrc/aoti/nonlinear_system.h"
+
+#include "test_util.h"
+
+using namespace neml2::aoti;
+
+namespace
+{
+// Row-wise r(u) = u^3 - a as a single DENSE group of size 1, counting the rows
+// each residual / step call evaluates. `restrictable` false leaves
+// `restrict_rows` at the base-class default.
+class CubeRootSystem : public NonlinearSystem
+{
+public:
+  CubeRootSystem(at::Tensor a, bool restrictable, std::shared_ptr<int64_t> rows_seen)
+    : _a(std::move(a)),
+      _restrictable(restrictable),
+      _rows_seen(std::move(rows_seen)),
+      _layout{GroupLayout{"dense", {}}}
+  {
+  }
+
+  std::vector<at::Tensor> residual(const std::vector<at::Tensor> & u) const override
+  {
+    *_rows_seen += u[0].size(0);
+    return {_a - u[0] * u[0] * u[0]};
+  }
+
+  std::pair<std::vector<at::Tensor>, std::vector<at::Tensor>>
+  step(const std::vector<at::Tensor> & u) const override
+  {
+    auto b = residual(u);
+    std::vector<at::Tensor> du{b[0] / (3.0 * u[0] * u[0])};
+    return {std::move(du), std::move(b)};
+  }
+
+  const std::vector<GroupLayout> & unknown_layout() const override { return _layout; }
+  const std::vector<GroupLayout> & residual_layout() const override { return _layout; }
+
+  std::unique_ptr<NonlinearSystem> restrict_rows(const at::Tensor & idx,
+                                                 int64_t batch) const override
+  {
+    if (!_restrictable || _a.size(0) != batch)
+      return nullptr;
+    return std::make_unique<CubeRootSystem>(_a.index_select(0, idx), true, _rows_seen);
+  }
+
+private:
+  at::Tensor _a;
+  bool _restrictable;
+  std::shared_ptr<int64_t> _rows_seen;
+  std::vector<GroupLayout> _layout;
+};
+
+SolverConfig
+make_cfg(double compact_fraction, std::size_t check_interval = 1)
+{
+  SolverConfig cfg;
+  cfg.atol = 1.0e-12;
+  cfg.rtol = 1.0e-12;
+  cfg.miters = 60;
+  cfg.compact_fraction = compact_fraction;
+  cfg.check_interval = check_interval;
+  return cfg;
+}
+} // namespace
+
+int
+main()
+{
+  const auto opts = at::TensorOptions().dtype(at::kDouble);
+  // 64 rows with roots near 1 (a handful of iterations from u0 = 1) and every
+  // 16th row with root 40 (many more iterations).
+  const int64_t n = 64;
+  auto a = at::linspace(1.0, 1.5, n, opts);
+  a.index_put_({at::arange(0, n, 16)}, 64000.0);
+  a = a.unsqueeze(-1);
+  const auto u0 = at::ones({n, 1}, opts);
+
+  auto solve = [&](const SolverConfig & cfg, bool restrictable, int64_t & rows_seen)
+  {
+    auto counter = std::make_shared<int64_t>(0);
+    CubeRootSystem sys(a, restrictable, counter);
+    auto res = Newton(cfg).solve_masked(sys, {u0});
+    rows_seen = *counter;
+    return res;
+  };
+
+  int64_t full_rows = 0;
+  const auto ref = solve(make_cfg(0.0), true, full_rows);
+  NEML2_CHECK(ref.converged);
+  NEML2_CHECK(at::allclose(ref.u[0] * ref.u[0] * ref.u[0], a, 1e-10, 1e-10));
+
+  for (const std::size_t k : {std::size_t(1), std::size_t(3)})
+  {
+    int64_t compact_rows = 0;
+    const auto res = solve(make_cfg(0.5, k), true, compact_rows);
+    std::printf("check_interval=%zu: rows evaluated %lld (full batch: %lld)\n",
+                k,
+                static_cast<long long>(compact_rows),
+                static_cast<long long>(full_rows));
+    NEML2_CHECK(res.converged);
+    NEML2_CHECK(res.converged_mask.sizes() == ref.converged_mask.sizes());
+    NEML2_CHECK(res.converged_mask.all().item<bool>());
+    NEML2_CHECK(res.u[0].sizes() == ref.u[0].sizes());
+    NEML2_CHECK(at::allclose(res.u[0], ref.u[0], 1e-12, 1e-14));
+    NEML2_CHECK(compact_rows < full_rows);
+  }
+
+  // A system that cannot be restricted keeps the full batch and the same answer.
+  {
+    int64_t rows = 0;
+    const auto res = solve(make_cfg(0.5), false, rows);
+    NEML2_CHECK(res.converged);
+    NEML2_CHECK(at::allclose(res.u[0], ref.u[0], 1e-12, 1e-14));
+    NEML2_CHECK(rows == full_rows);
+  }
+
+  // A non-finite row is dropped with the finished ones and reported unconverged.
+  {
+    auto bad = u0.clone();
+    bad[5] = 0.0;
+    auto counter = std::make_shared<int64_t>(0);
+    CubeRootSystem sys(a, true, counter);
+    const auto res = Newton(make_cfg(0.5)).solve_masked(sys, {bad});
+    NEML2_CHECK(!res.converged);
+    NEML2_CHECK(!res.converged_mask[5].item<bool>());
+    NEML2_CHECK(res.converged_mask.sum().item<int64_t>() == n - 1);
+  }
+
+  std::printf("OK\n");
+  return 0;
+}
@@ -0,0 +1,151 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Standalone test for the Newton solve statistics (`SolverConfig::collect_stats`,
+// newton.cpp). A hand-built batched scalar system,
+//
+//   r(u) = u + u^3 - c,
+//
+// needs more iterations the larger c is. With statistics off the result carries
+// none; with them on, the per-row iteration counts must place the slowest row at
+// the solve's iteration count and a row that starts at its root at zero, the
+// line-search trials must be counted, and compaction must not change the
+// per-row counts of the masked solve.
+
+#include <cstdio>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <ATen/ATen.h>
+
+#include "neml2/csrc/aoti/newton.h"
+#include "neml2/csrc/aoti/nonlinear_system.h"
+
+#include "test_util.h"
+
+using namespace neml2::aoti;
+
+namespace
+{
+// One DENSE group of size 1. residual() returns b = -r; step() solves the
+// scalar Newton update in closed form.
+class CubicSystem : public NonlinearSystem
+{
+public:
+  explicit CubicSystem(at::Tensor c)
+    : _c(std::move(c)),
+      _layout{GroupLayout{"dense", {}}}
+  {
+  }
+
+  std::vector<at::Tensor> residual(const std::vector<at::Tensor> & u) const override
+  {
+    return {_c - u[0] - u[0].pow(3)};
+  }
+
+  std::pair<std::vector<at::Tensor>, std::vector<at::Tensor>>
+  step(const std::vector<at::Tensor> & u) const override
+  {
+    auto b = residual(u);
+    std::vector<at::Tensor> du{b[0] / (1.0 + 3.0 * u[0].pow(2))};
+    return {std::move(du), std::move(b)};
+  }
+
+  const std::vector<GroupLayout> & unknown_layout() const override { return _layout; }
+  const std::vector<GroupLayout> & residual_layout() const override { return _layout; }
+
+  std::unique_ptr<NonlinearSystem> restrict_rows(const at::Tensor & idx,
+                                                 int64_t /*batch*/) const override
+  {
+    return std::make_unique<CubicSystem>(_c.index_select(0, idx));
+  }
+
+private:
+  at::Tensor _c;
+  std::vector<GroupLayout> _layout;
+};
+
+SolverConfig
+make_cfg(bool stats, double compact_fraction = 0.0)
+{
+  SolverConfig cfg;
+  cfg.atol = 1.0e-12;
+  cfg.rtol = 1.0e-12;
+  cfg.miters = 50;
+  cfg.collect_stats = stats;
+  cfg.compact_fraction = compact_fraction;
+  return cfg;
+}
+} // namespace
+
+int
+main()
+{
+  const auto opts = at::TensorOptions().dtype(at::kDouble);
+  const int64_t n = 6;
+  const auto c = at::tensor({0.0, 0.1, 1.0, 10.0, 100.0, 1000.0}, opts).unsqueeze(-1);
+  const auto u0 = at::zeros({n, 1}, opts);
+  const CubicSystem sys(c);
+
+  // Off: nothing is recorded.
+  const auto off = Newton(make_cfg(false)).solve(sys, {u0});
+  NEML2_CHECK(off.converged);
+  NEML2_CHECK(!off.stats.row_iterations.defined());
+  NEML2_CHECK(off.stats.step_seconds == 0.0 && off.stats.residual_seconds == 0.0);
+
+  const auto res = Newton(make_cfg(true)).solve(sys, {u0});
+  const auto & rows = res.stats.row_iterations;
+  NEML2_CHECK(res.converged);
+  NEML2_CHECK(at::equal(res.u[0], off.u[0]));
+  NEML2_CHECK(rows.defined() && rows.scalar_type() == at::kLong);
+  std::printf("solve: %zu iterations, slowest row %lld\n",
+              res.iterations,
+              static_cast<long long>(rows.max().item<int64_t>()));
+  NEML2_CHECK(rows.sizes().equals({n}));
+  NEML2_CHECK(rows[0].item<int64_t>() == 0);
+  NEML2_CHECK(rows.max().item<int64_t>() == static_cast<int64_t>(res.iterations));
+  NEML2_CHECK(rows[n - 1].item<int64_t>() > rows[1].item<int64_t>());
+  NEML2_CHECK(res.stats.step_seconds > 0.0 && res.stats.residual_seconds > 0.0);
+  NEML2_CHECK(res.stats.linesearch_trials == 0);
+  NEML2_CHECK(res.stats.matvecs == 0 && res.stats.precond_rebuilds == 0);
+
+  // Every iteration of a line-searched solve tries at least one step length.
+  auto ls_cfg = make_cfg(true);
+  ls_cfg.ls_max_iters = 5;
+  const auto ls = Newton(ls_cfg).solve(sys, {u0});
+  NEML2_CHECK(ls.converged);
+  NEML2_CHECK(ls.stats.linesearch_trials >= ls.iterations);
+
+  // The masked solve counts the same rows with and without compaction.
+  const auto masked = Newton(make_cfg(true)).solve_masked(sys, {u0});
+  const auto compact = Newton(make_cfg(true, 0.3)).solve_masked(sys, {u0});
+  NEML2_CHECK(masked.converged && compact.converged);
+  NEML2_CHECK(
+      masked.stats.row_iterations.max().item<int64_t>() == static_cast<int64_t>(masked.iterations));
+  NEML2_CHECK(at::equal(compact.stats.row_iterations, masked.stats.row_iterations));
+
+  std::printf("OK\n");
+  return 0;
+}
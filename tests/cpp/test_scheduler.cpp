@@ -22,6 +22,10 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <cstddef>
+#include <filesystem>
+
+#include "neml2/csrc/dispatchers/AutotuneScheduler.h"
 #include "neml2/csrc/dispatchers/MPISimpleScheduler.h"
 #include "neml2/csrc/dispatchers/SimpleScheduler.h"
 
@@ -134,5 +138,97 @@ main()
     NEML2_CHECK_THROWS(parse_mpi_devices({"cuda", "cuda:0"}));   // mixed (other order)
   }
 
+  // AutotuneScheduler: the sweep against a synthetic cost model (0.1 ms per
+  // call plus 1 us per row, 2 us per row past 1024 rows), so the best
+  // throughput is at 1024 rows. No model, no timing noise.
+  {
+    std::size_t calls = 0;
+    const auto cost = [&](std::size_t n)
+    {
+      ++calls;
+      return 1e-4 + static_cast<double>(n) * (n <= 1024 ? 1e-6 : 2e-6);
+    };
+    const auto cache = std::filesystem::temp_directory_path() / "neml2_test_scheduler_autotune";
+    std::filesystem::remove_all(cache);
+
+    AutotuneScheduler::Config cfg;
+    cfg.repeats = 2;
+    cfg.cache_dir = cache.string();
+    AutotuneScheduler s(cfg);
+    NEML2_CHECK(s.device().is_cpu());
+    NEML2_CHECK(!s.calibrated() && s.batch_size() == 0); // whole batch until calibrated
+    NEML2_CHECK(s.calibrate(cost, "artifact-A") == 1024);
+    NEML2_CHECK(s.calibrated() && s.batch_size() == 1024);
+    // 64 ... 1024 improve; 2048 and 4096 do not, which ends the sweep.
+    NEML2_CHECK(s.sweep().size() == 7);
+    NEML2_CHECK(calls == 7 * 3); // a warm-up and two timed calls per size
+    NEML2_CHECK(std::filesystem::exists(s.cache_file("artifact-A")));
+
+    // Calibrated: a second calibrate is free unless forced.
+    calls = 0;
+    NEML2_CHECK(s.calibrate(cost, "artifact-A") == 1024 && calls == 0);
+    NEML2_CHECK(s.calibrate(cost, "artifact-A", /*force=*/true) == 1024 && calls > 0);
+
+    // A fresh scheduler on this host reads the cached size without sweeping ...
+    calls = 0;
+    AutotuneScheduler cached(cfg);
+    NEML2_CHECK(cached.calibrate(cost, "artifact-A") == 1024 && calls == 0);
+    NEML2_CHECK(cached.sweep().empty());
+    // ... but another artifact, or no artifact key at all, sweeps.
+    AutotuneScheduler other(cfg);
+    NEML2_CHECK(other.calibrate(cost, "artifact-B") == 1024 && calls > 0);
+    NEML2_CHECK(other.cache_file("").empty());
+
+    // Each operation has its own size and cache entry: a Jacobian row that
+    // costs 8x a forward row peaks at 128 rows, and tuning it leaves the
+    // forward size alone.
+    const auto jac_cost = [&](std::size_t n) { return cost(8 * n); };
+    NEML2_CHECK(!cached.calibrated("jacobian") && cached.batch_size("jacobian") == 0);
+    NEML2_CHECK(cached.calibrate(jac_cost, "artifact-A", false, "jacobian") == 128);
+    NEML2_CHECK(cached.batch_size("jacobian") == 128 && cached.batch_size() == 1024);
+    NEML2_CHECK(!cached.sweep("jacobian").empty());
+    NEML2_CHECK(cached.cache_file("artifact-A", "jacobian") != cached.cache_file("artifact-A"));
+    // Without sweeping, a size comes only from the cache, and a miss stays a
+    // miss (the file is read once).
+    AutotuneScheduler lookup(cfg);
+    calls = 0;
+    NEML2_CHECK(lookup.load_cached("artifact-A", "jacobian") == 128 && calls == 0);
+    NEML2_CHECK(lookup.calibrated("jacobian") && !lookup.calibrated());
+    NEML2_CHECK(lookup.load_cached("artifact-A", "param_vjp") == 0);
+    NEML2_CHECK(!lookup.calibrated("param_vjp") && lookup.batch_size("param_vjp") == 0);
+    cfg.use_cache = false;
+    NEML2_CHECK(AutotuneScheduler(cfg).cache_file("artifact-A").empty());
+    std::filesystem::remove_all(cache);
+
+    // A size that cannot run (negative time) ends the sweep at the last good one.
+    AutotuneScheduler oom(cfg);
+    NEML2_CHECK(oom.calibrate([&](std::size_t n) { return n >= 512 ? -1.0 : cost(n); }) == 256);
+    // ... and if not even the smallest runs, calibration fails.
+    AutotuneScheduler none(cfg);
+    NEML2_CHECK_THROWS(none.calibrate([](std::size_t) { return -1.0; }));
+    NEML2_CHECK(!none.calibrated());
+
+    // The sweep stops at max_batch_size and after a call slower than max_seconds.
+    cfg.max_batch_size = 256;
+    NEML2_CHECK(AutotuneScheduler(cfg).calibrate(cost) == 256);
+    cfg.max_batch_size = std::size_t(1) << 20;
+    cfg.max_seconds = 2e-4; // 64 rows take 1.64e-4 s, 128 rows 2.28e-4 s
+    NEML2_CHECK(AutotuneScheduler(cfg).calibrate(cost) == 128);
+
+    // Config validation.
+    AutotuneScheduler::Config bad;
+    bad.min_batch_size = 0;
+    NEML2_CHECK_THROWS(AutotuneScheduler{bad});
+    bad = {};
+    bad.max_batch_size = 32; // < min_batch_size
+    NEML2_CHECK_THROWS(AutotuneScheduler{bad});
+    bad = {};
+    bad.growth = 1;
+    NEML2_CHECK_THROWS(AutotuneScheduler{bad});
+    bad = {};
+    bad.repeats = 0;
+    NEML2_CHECK_THROWS(AutotuneScheduler{bad});
+  }
+
   return 0;
 }
@@ -0,0 +1,168 @@
+// Copyright 2024, UChicago Argonne, LLC
+// All Rights Reserved
+// Software Name: NEML2 -- the New Engineering material Model Library, version 2
+// By: Argonne National Laboratory
+// OPEN SOURCE LICENSE (MIT)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// SolverConfig::substep_method = ADAPTIVE: on a batch that mixes easy rows (the
+// full step converges) with hard ones (it does not), the per-row schedule must
+// leave the easy rows at their single-shot answer, carry the hard rows to the
+// end of the increment, and chain a tangent that matches finite differences of
+// the adaptive forward. An unknown method is rejected, and so is an initial
+// guess for the substepping segment.
+//
+// The per-row depth recorded in the statistics, handed back as the next call's
+// `substep_hint`, must start each row at that depth: an all-zero hint runs the
+// adaptive schedule unchanged. The hint must relax again: on an easy next call
+// a previously hard row reports a coarser level than its hint.
+//
+// With `substep_workers`, the two hard rows bisect as concurrent sub-batches and
+// must reproduce the serial values, tangent and per-row statistics.
+//
+// argv[1] is the fixture (collection) dir; the artifact is implicit_substep_nl,
+// whose residual x - x~1 - (t - t~1) x^3 fails single shot for t - t~1 = 8.
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <ATen/ATen.h>
+
+#include "neml2/csrc/aoti/Exception.h"
+#include "neml2/csrc/aoti/Model.h"
+
+#include "test_util.h"
+
+using namespace neml2::aoti;
+
+int
+main(int argc, char ** argv)
+{
+  NEML2_CHECK(argc >= 2); // argv[1] = the fixture (collection) dir
+  Model model(std::string(argv[1]) + "/model", at::kCPU, at::kDouble);
+
+  // Rows 0 and 2 are easy (dt = 1), rows 1 and 3 hard (dt = 8 and 6).
+  const auto opts = at::TensorOptions().dtype(model.dtype()).device(model.device());
+  std::map<std::string, at::Tensor> ins{
+      {"x", at::full({4}, 0.2, opts)},
+      {"x~1", at::full({4}, 0.2, opts)},
+      {"t", at::tensor({1.0, 8.0, 1.0, 6.0}, opts)},
+      {"t~1", at::zeros({4}, opts)},
+  };
+
+  auto cfg = model.solver_config();
+  cfg.collect_stats = true;
+  auto forward_with = [&](const std::string & method)
+  {
+    cfg.substep_method = method;
+    model.set_solver_config(cfg);
+    return model.forward(ins).at("x");
+  };
+
+  const auto bisect = forward_with("BISECT");
+  const auto adaptive = forward_with("ADAPTIVE");
+  NEML2_CHECK(at::isfinite(adaptive).all().item<bool>());
+
+  // The easy rows converge in the first round and never see a sub-span.
+  const auto easy = at::tensor({0L, 2L}, opts.dtype(at::kLong));
+  NEML2_CHECK(at::allclose(adaptive.index_select(0, easy), bisect.index_select(0, easy)));
+  // The hard rows reach the end of the increment, further than the easy ones.
+  NEML2_CHECK(adaptive[1].item<double>() > adaptive[0].item<double>());
+  NEML2_CHECK(adaptive[3].item<double>() > adaptive[2].item<double>());
+
+  const auto & stats = model.last_solve_stats();
+  NEML2_CHECK(stats.segments.size() == 1);
+  NEML2_CHECK(stats.segments[0].substep_depth > 0);
+  NEML2_CHECK(stats.segments[0].substep_depth <= 8); // max_substepping_level of the artifact
+
+  // The chained tangent of the adaptive schedule against central differences.
+  const auto [out, J] = model.jacobian(ins);
+  NEML2_CHECK(at::allclose(out.at("x"), adaptive, 1e-12, 1e-14));
+  const double h = 1e-6;
+  for (const std::string name : {"x~1", "t", "t~1"})
+  {
+    auto plus = ins, minus = ins;
+    plus[name] = ins.at(name) + h;
+    minus[name] = ins.at(name) - h;
+    const auto fd = (model.forward(plus).at("x") - model.forward(minus).at("x")) / (2 * h);
+    NEML2_CHECK(at::allclose(J.at("x").at(name).reshape(fd.sizes()), fd, 1e-5, 1e-6));
+  }
+
+  // Per-row depth: zero for the easy rows, the deepest level for a hard one.
+  (void)forward_with("BISECT");
+  const auto depth = model.last_solve_stats().segments[0].row_substep_depth;
+  NEML2_CHECK(depth.defined() && depth.sizes().equals({4}));
+  NEML2_CHECK(depth[0].item<int64_t>() == 0 && depth[2].item<int64_t>() == 0);
+  NEML2_CHECK(depth[1].item<int64_t>() > 0 && depth[3].item<int64_t>() > 0);
+  NEML2_CHECK(depth.max().item<int64_t>() ==
+              static_cast<int64_t>(model.last_solve_stats().segments[0].substep_depth));
+
+  // A hint selects the per-row schedule; at level 0 it is the adaptive one.
+  const auto zero_hint = model.forward(ins, {}, {}, {at::zeros_like(depth)}).at("x");
+  NEML2_CHECK(at::allclose(zero_hint, adaptive, 1e-12, 1e-14));
+
+  // Hinted rows start at their previous depth and still reach the end.
+  const auto hinted = model.forward(ins, {}, {}, {depth}).at("x");
+  NEML2_CHECK(at::isfinite(hinted).all().item<bool>());
+  NEML2_CHECK(at::allclose(hinted.index_select(0, easy), bisect.index_select(0, easy)));
+  NEML2_CHECK(hinted[1].item<double>() > hinted[0].item<double>());
+  const auto hinted_depth = model.last_solve_stats().segments[0].row_substep_depth;
+  NEML2_CHECK((hinted_depth.index_select(0, easy) == 0).all().item<bool>());
+
+  // On an easy next call the hard rows start at their hint, grow back after
+  // two converged sub-steps and report a coarser level: the hint relaxes.
+  auto calm = ins;
+  calm["t"] = at::ones({4}, opts);
+  (void)model.forward(calm, {}, {}, {depth});
+  const auto relaxed = model.last_solve_stats().segments[0].row_substep_depth;
+  const auto hard = at::tensor({1L, 3L}, opts.dtype(at::kLong));
+  NEML2_CHECK((relaxed.index_select(0, hard) < depth.index_select(0, hard)).all().item<bool>());
+  NEML2_CHECK((relaxed <= depth).all().item<bool>());
+
+  // A hint must cover the batch.
+  NEML2_CHECK_THROWS(model.forward(ins, {}, {}, {at::zeros({3}, depth.options())}));
+
+  // A segment that substeps cannot take an initial guess.
+  NEML2_CHECK_THROWS(model.forward(ins, {}, {{"x", bisect}}));
+
+  // Concurrent sub-batches: one hard row per worker.
+  (void)forward_with("BISECT");
+  const auto serial_stats = model.last_solve_stats().segments[0];
+  const auto [serial_out, serial_J] = model.jacobian(ins);
+  cfg.substep_workers = 2;
+  cfg.substep_split_rows = 1;
+  const auto split = forward_with("BISECT");
+  NEML2_CHECK(at::allclose(split, bisect, 1e-12, 1e-14));
+  const auto & split_stats = model.last_solve_stats().segments[0];
+  NEML2_CHECK(split_stats.substep_depth == serial_stats.substep_depth);
+  NEML2_CHECK(at::equal(split_stats.row_substep_depth, serial_stats.row_substep_depth));
+  NEML2_CHECK(at::equal(split_stats.row_iterations, serial_stats.row_iterations));
+  const auto [split_out, split_J] = model.jacobian(ins);
+  NEML2_CHECK(at::allclose(split_out.at("x"), serial_out.at("x"), 1e-12, 1e-14));
+  for (const auto & [i, blk] : serial_J.at("x"))
+    NEML2_CHECK(at::allclose(split_J.at("x").at(i), blk, 1e-10, 1e-12));
+  cfg.substep_workers = 0;
+
+  cfg.substep_method = "PID";
+  model.set_solver_config(cfg);
+  NEML2_CHECK_THROWS(model.forward(ins));
+  return 0;
+}
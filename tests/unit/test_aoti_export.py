@@ -150,8 +150,8 @@ def test_predict_forward_artifacts_emit_order():
 
 def test_predict_implicit_artifacts_emit_order():
     """The implicit predictor mirrors the compile_model calls in
-    _compile_implicit_segment: residual, jacobian, solve, then optional
-    ift/pift/predictor."""
+    _compile_implicit_segment: residual, jacobian, solve (+ the split LU pair),
+    then optional ift/pift/predictor."""
     from neml2.cli.aoti_export import _predict_implicit_artifacts
 
     assert _predict_implicit_artifacts(
@@ -169,6 +169,24 @@ def test_predict_implicit_artifacts_emit_order():
         "m_solve_param.pt2",
         "m_predictor.pt2",
     ]
+    # A single-group DenseLU solve follows solve with its split LU pair.
+    assert _predict_implicit_artifacts(
+        "m",
+        iterative=False,
+        precond_on=False,
+        emit_ift=True,
+        emit_pift=False,
+        has_predictor=False,
+        lu_factored=True,
+    ) == [
+        "m_residual.pt2",
+        "m_jacobian.pt2",
+        "m_solve.pt2",
+        "m_factor.pt2",
+        "m_solve_factored.pt2",
+        "m_jacobian_given.pt2",
+        "m_solve_ift.pt2",
+    ]
 
 
 def test_predict_implicit_artifacts_krylov():
@@ -156,11 +156,21 @@ _CONFIGS = [
     GMRES(restart=1),  # forces multiple restarts on the 2-D system
     BiCGStab(),
     BiCGStab(preconditioner=BlockJacobiPreconditioner(), cache_strategy="chord"),
+    # Eisenstat-Walker forcing terms: looser inner solves, same Newton root.
+    GMRES(forcing="ew1"),
+    BiCGStab(preconditioner=JacobiPreconditioner(), forcing="ew2"),
+    # Recycled GMRES: deflated restarts and Newton steps, same Newton root.
+    GMRES(restart=2, recycle=2),
+    # In-loop compaction is accepted on the eager route, which solves the full batch.
+    BiCGStab(compact_fraction=0.5),
 ]
 
 
 def _config_id(s) -> str:
-    return f"{type(s).__name__}-{s.preconditioner.kind}-{s.cache_strategy}"
+    return (
+        f"{type(s).__name__}-{s.preconditioner.kind}-{s.cache_strategy}-{s.forcing}"
+        f"-{s.recycle}-{s.compact_fraction}"
+    )
 
 
 @pytest.mark.parametrize("solver", _CONFIGS, ids=_config_id)